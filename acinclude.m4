@@ -1,8 +1,176 @@
 dnl Checks for required headers and functions
 dnl
-dnl Version: 20170909
+dnl Version: 20181019
 
 dnl Function to detect if libfwsi dependencies are available
 AC_DEFUN([AX_LIBFWSI_CHECK_LOCAL],
   [dnl No additional checks.
   ])
+
+dnl Function to detect if a parser should be compiled out
+dnl The parser is compiled out if --disable-$1-parser is passed to configure
+AC_DEFUN([AX_LIBFWSI_CHECK_ENABLE_PARSER],
+  [AX_COMMON_ARG_ENABLE(
+    [$1-parser],
+    [$2_parser],
+    [$3 parser],
+    [yes])
+
+  AS_IF(
+    [test "x$ac_cv_enable_$2_parser" = xno],
+    [AC_DEFINE(
+      [LIBFWSI_WITHOUT_$4_PARSER],
+      [1],
+      [Define to 1 to compile out the $3 parser.])
+
+    AC_SUBST(
+      [LIBFWSI_WITHOUT_$4_PARSER],
+      [1])
+    ],
+    [AC_SUBST(
+      [LIBFWSI_WITHOUT_$4_PARSER],
+      [0])
+    ])
+  ])
+
+dnl Function to detect which item and extension block parsers should be compiled out
+AC_DEFUN([AX_LIBFWSI_CHECK_ENABLE_PARSERS],
+  [dnl Item parsers
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [cdburn],
+    [cdburn],
+    [CD burn item],
+    [CDBURN])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [compressed-folder],
+    [compressed_folder],
+    [compressed folder item],
+    [COMPRESSED_FOLDER])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [control-panel],
+    [control_panel],
+    [control panel item],
+    [CONTROL_PANEL])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [control-panel-category],
+    [control_panel_category],
+    [control panel category item],
+    [CONTROL_PANEL_CATEGORY])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [control-panel-cpl-file],
+    [control_panel_cpl_file],
+    [control panel CPL file item],
+    [CONTROL_PANEL_CPL_FILE])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [delegate],
+    [delegate],
+    [delegate item],
+    [DELEGATE])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [file-entry],
+    [file_entry],
+    [file entry item],
+    [FILE_ENTRY])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [game-folder],
+    [game_folder],
+    [game folder item],
+    [GAME_FOLDER])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [mtp-file-entry],
+    [mtp_file_entry],
+    [MTP file entry item],
+    [MTP_FILE_ENTRY])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [mtp-volume],
+    [mtp_volume],
+    [MTP volume item],
+    [MTP_VOLUME])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [network-location],
+    [network_location],
+    [network location item],
+    [NETWORK_LOCATION])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [root-folder],
+    [root_folder],
+    [root folder item],
+    [ROOT_FOLDER])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [uri],
+    [uri],
+    [URI item],
+    [URI])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [users-property-view],
+    [users_property_view],
+    [users property view item],
+    [USERS_PROPERTY_VIEW])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [volume],
+    [volume],
+    [volume item],
+    [VOLUME])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [unknown-0x74],
+    [unknown_0x74],
+    [unknown 0x74 item],
+    [UNKNOWN_0X74])
+
+  dnl Extension block parsers
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0000],
+    [extension_block_0xbeef0000],
+    [extension block 0xbeef0000],
+    [EXTENSION_BLOCK_0XBEEF0000])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0001],
+    [extension_block_0xbeef0001],
+    [extension block 0xbeef0001],
+    [EXTENSION_BLOCK_0XBEEF0001])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0003],
+    [extension_block_0xbeef0003],
+    [extension block 0xbeef0003],
+    [EXTENSION_BLOCK_0XBEEF0003])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0004],
+    [extension_block_0xbeef0004],
+    [extension block 0xbeef0004],
+    [EXTENSION_BLOCK_0XBEEF0004])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0005],
+    [extension_block_0xbeef0005],
+    [extension block 0xbeef0005],
+    [EXTENSION_BLOCK_0XBEEF0005])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0006],
+    [extension_block_0xbeef0006],
+    [extension block 0xbeef0006],
+    [EXTENSION_BLOCK_0XBEEF0006])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef000a],
+    [extension_block_0xbeef000a],
+    [extension block 0xbeef000a],
+    [EXTENSION_BLOCK_0XBEEF000A])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0013],
+    [extension_block_0xbeef0013],
+    [extension block 0xbeef0013],
+    [EXTENSION_BLOCK_0XBEEF0013])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0014],
+    [extension_block_0xbeef0014],
+    [extension block 0xbeef0014],
+    [EXTENSION_BLOCK_0XBEEF0014])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0019],
+    [extension_block_0xbeef0019],
+    [extension block 0xbeef0019],
+    [EXTENSION_BLOCK_0XBEEF0019])
+  AX_LIBFWSI_CHECK_ENABLE_PARSER(
+    [extension-block-0xbeef0025],
+    [extension_block_0xbeef0025],
+    [extension block 0xbeef0025],
+    [EXTENSION_BLOCK_0XBEEF0025])
+  ])
@@ -0,0 +1,169 @@
+/*
+ * Allocator functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* The allocator falls back to the memory macros of common/memory.h
+ */
+#define LIBFWSI_ALLOCATOR_USE_SYSTEM_MEMORY
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_libcerror.h"
+
+/* The allocator, where NULL functions indicate the system memory functions are used
+ */
+static libfwsi_allocator_t libfwsi_allocator = { NULL, NULL, NULL, NULL };
+
+/* Sets the allocator used for all memory allocated by the library
+ * The allocate, reallocate and free functions must either all be set or all be NULL,
+ * where NULL restores the system memory functions
+ * The reallocate function must allocate a new buffer if the buffer is NULL
+ * The allocator must not be changed while objects of the library exist
+ * and is not protected against concurrent modification
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_set_allocator(
+     void *(*allocate_function)(
+              void *context,
+              size_t size ),
+     void *(*reallocate_function)(
+              void *context,
+              void *buffer,
+              size_t size ),
+     void (*free_function)(
+            void *context,
+            void *buffer ),
+     void *context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_set_allocator";
+
+	if( ( allocate_function == NULL )
+	 && ( reallocate_function == NULL )
+	 && ( free_function == NULL ) )
+	{
+		libfwsi_allocator.allocate_function   = NULL;
+		libfwsi_allocator.reallocate_function = NULL;
+		libfwsi_allocator.free_function       = NULL;
+		libfwsi_allocator.context             = NULL;
+
+		return( 1 );
+	}
+	if( allocate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( reallocate_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reallocate function.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free function.",
+		 function );
+
+		return( -1 );
+	}
+	libfwsi_allocator.allocate_function   = allocate_function;
+	libfwsi_allocator.reallocate_function = reallocate_function;
+	libfwsi_allocator.free_function       = free_function;
+	libfwsi_allocator.context             = context;
+
+	return( 1 );
+}
+
+/* Allocates memory using the allocator
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libfwsi_allocator_allocate(
+       size_t size )
+{
+	if( libfwsi_allocator.allocate_function != NULL )
+	{
+		return( libfwsi_allocator.allocate_function(
+		         libfwsi_allocator.context,
+		         size ) );
+	}
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates memory using the allocator
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libfwsi_allocator_reallocate(
+       void *buffer,
+       size_t size )
+{
+	if( libfwsi_allocator.reallocate_function != NULL )
+	{
+		return( libfwsi_allocator.reallocate_function(
+		         libfwsi_allocator.context,
+		         buffer,
+		         size ) );
+	}
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory using the allocator
+ */
+void libfwsi_allocator_free(
+      void *buffer )
+{
+	if( buffer == NULL )
+	{
+		return;
+	}
+	if( libfwsi_allocator.free_function != NULL )
+	{
+		libfwsi_allocator.free_function(
+		 libfwsi_allocator.context,
+		 buffer );
+	}
+	else
+	{
+		memory_free(
+		 buffer );
+	}
+}
+
@@ -0,0 +1,114 @@
+/*
+ * Allocator functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_ALLOCATOR_H )
+#define _LIBFWSI_ALLOCATOR_H
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_allocator libfwsi_allocator_t;
+
+struct libfwsi_allocator
+{
+	/* The allocate function
+	 */
+	void *(*allocate_function)(
+	         void *context,
+	         size_t size );
+
+	/* The reallocate function
+	 */
+	void *(*reallocate_function)(
+	         void *context,
+	         void *buffer,
+	         size_t size );
+
+	/* The free function
+	 */
+	void (*free_function)(
+	       void *context,
+	       void *buffer );
+
+	/* The context passed to the functions
+	 */
+	void *context;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_set_allocator(
+     void *(*allocate_function)(
+              void *context,
+              size_t size ),
+     void *(*reallocate_function)(
+              void *context,
+              void *buffer,
+              size_t size ),
+     void (*free_function)(
+            void *context,
+            void *buffer ),
+     void *context,
+     libcerror_error_t **error );
+
+void *libfwsi_allocator_allocate(
+       size_t size );
+
+void *libfwsi_allocator_reallocate(
+       void *buffer,
+       size_t size );
+
+void libfwsi_allocator_free(
+      void *buffer );
+
+/* Route the memory macros of common/memory.h through the allocator
+ * so that all allocations made by the library use the allocator
+ */
+#if !defined( LIBFWSI_ALLOCATOR_USE_SYSTEM_MEMORY )
+
+#undef memory_allocate
+#undef memory_reallocate
+#undef memory_free
+
+#define memory_allocate( size ) \
+	libfwsi_allocator_allocate( size )
+
+#define memory_reallocate( buffer, size ) \
+	libfwsi_allocator_reallocate( (void *) buffer, size )
+
+#define memory_free( buffer ) \
+	libfwsi_allocator_free( (void *) buffer )
+
+#endif /* !defined( LIBFWSI_ALLOCATOR_USE_SYSTEM_MEMORY ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ALLOCATOR_H ) */
+
@@ -0,0 +1,1106 @@
+/*
+ * Shell item list carver functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBFWSI_CARVER_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_carver.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+/* Determines if a byte is a plausible class type indicator of the first shell item of a list
+ */
+#define libfwsi_carver_is_class_type( byte_value ) \
+	( ( ( byte_value ) == 0x1f ) \
+	 || ( ( ( byte_value ) >= 0x20 ) && ( ( byte_value ) <= 0x4f ) ) \
+	 || ( ( byte_value ) == 0x52 ) \
+	 || ( ( byte_value ) == 0x61 ) \
+	 || ( ( byte_value ) == 0x71 ) )
+
+/* Creates a carver
+ * Make sure the value carver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_initialize(
+     libfwsi_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_initialize";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = memory_allocate_structure(
+	                   libfwsi_internal_carver_t );
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_carver,
+	     0,
+	     sizeof( libfwsi_internal_carver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carver.",
+		 function );
+
+		goto on_error;
+	}
+	internal_carver->maximum_list_size = LIBFWSI_CARVER_DEFAULT_MAXIMUM_LIST_SIZE;
+
+	*carver = (libfwsi_carver_t *) internal_carver;
+
+	return( 1 );
+
+on_error:
+	if( internal_carver != NULL )
+	{
+		memory_free(
+		 internal_carver );
+	}
+	return( -1 );
+}
+
+/* Frees a carver
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_free(
+     libfwsi_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_free";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		internal_carver = (libfwsi_internal_carver_t *) *carver;
+		*carver         = NULL;
+
+		if( internal_carver->buffer != NULL )
+		{
+			memory_free(
+			 internal_carver->buffer );
+		}
+		if( internal_carver->results != NULL )
+		{
+			memory_free(
+			 internal_carver->results );
+		}
+		memory_free(
+		 internal_carver );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum list size
+ * Shell item lists that start within the maximum list size of the end of the data
+ * passed to libfwsi_carver_scan_data are scanned once more data is available
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_set_maximum_list_size(
+     libfwsi_carver_t *carver,
+     size_t maximum_list_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_set_maximum_list_size";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( ( maximum_list_size < ( LIBFWSI_CARVER_MINIMUM_ITEM_SIZE + 2 ) )
+	 || ( maximum_list_size > (size_t) ( SSIZE_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum list size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->maximum_list_size = maximum_list_size;
+
+	return( 1 );
+}
+
+/* Sets the validate flags
+ * LIBFWSI_VALIDATE_FLAG_REQUIRE_TERMINATOR is always applied
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_set_validate_flags(
+     libfwsi_carver_t *carver,
+     uint32_t validate_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_set_validate_flags";
+	uint32_t supported_flags                   = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	supported_flags = LIBFWSI_VALIDATE_FLAG_REQUIRE_TERMINATOR
+	                | LIBFWSI_VALIDATE_FLAG_STRICT_EXTENSION_BLOCKS;
+
+	if( ( validate_flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported validate flags: 0x%08" PRIx32 ".",
+		 function,
+		 validate_flags );
+
+		return( -1 );
+	}
+	internal_carver->validate_flags = validate_flags;
+
+	return( 1 );
+}
+
+/* Determines if the data at a specific offset is a candidate shell item list
+ * Returns 1 if the data is a candidate or 0 if not
+ */
+int libfwsi_carver_check_candidate(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset )
+{
+	uint16_t shell_item_size = 0;
+
+	if( ( data_size - data_offset ) < ( LIBFWSI_CARVER_MINIMUM_ITEM_SIZE + 2 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ data_offset ] ),
+	 shell_item_size );
+
+	if( ( shell_item_size < LIBFWSI_CARVER_MINIMUM_ITEM_SIZE )
+	 || ( (size_t) shell_item_size > ( data_size - data_offset - 2 ) ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Finds the next candidate shell item list
+ * A candidate starts with a 16-bit size smaller than 512 followed by a plausible class type indicator
+ * Only candidates that start before the end offset are returned
+ * Returns the offset of the candidate or the end offset if no candidate was found
+ */
+size_t libfwsi_carver_find_candidate(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset,
+        size_t end_offset )
+{
+	size_t class_type_offset = 0;
+	size_t end_class_offset  = 0;
+	uint8_t byte_value       = 0;
+
+#if defined( LIBFWSI_CARVER_HAVE_SSE2 )
+	__m128i class_types      = _mm_setzero_si128();
+	__m128i match_values     = _mm_setzero_si128();
+	__m128i previous_values  = _mm_setzero_si128();
+	__m128i range_values     = _mm_setzero_si128();
+	__m128i values           = _mm_setzero_si128();
+	int match_mask           = 0;
+	int match_index          = 0;
+#endif
+
+	if( end_offset > data_size )
+	{
+		end_offset = data_size;
+	}
+	/* The class type indicator is stored 2 bytes after the start of the candidate
+	 */
+	if( ( end_offset < 2 )
+	 || ( data_offset >= ( end_offset - 2 ) ) )
+	{
+		return( end_offset );
+	}
+	class_type_offset = data_offset + 2;
+	end_class_offset  = end_offset + 2;
+
+	if( end_class_offset > data_size )
+	{
+		end_class_offset = data_size;
+	}
+#if defined( LIBFWSI_CARVER_HAVE_SSE2 )
+	/* Check 16 class type indicators at a time, together with the upper byte of their size
+	 */
+	while( ( end_class_offset - class_type_offset ) >= 16 )
+	{
+		values          = _mm_loadu_si128( (const __m128i *) &( data[ class_type_offset ] ) );
+		previous_values = _mm_loadu_si128( (const __m128i *) &( data[ class_type_offset - 1 ] ) );
+
+		/* Class types 0x20 - 0x4f
+		 */
+		range_values = _mm_sub_epi8( values, _mm_set1_epi8( 0x20 ) );
+		class_types  = _mm_cmpeq_epi8( _mm_min_epu8( range_values, _mm_set1_epi8( 0x2f ) ), range_values );
+
+		class_types = _mm_or_si128( class_types, _mm_cmpeq_epi8( values, _mm_set1_epi8( 0x1f ) ) );
+		class_types = _mm_or_si128( class_types, _mm_cmpeq_epi8( values, _mm_set1_epi8( 0x52 ) ) );
+		class_types = _mm_or_si128( class_types, _mm_cmpeq_epi8( values, _mm_set1_epi8( 0x61 ) ) );
+		class_types = _mm_or_si128( class_types, _mm_cmpeq_epi8( values, _mm_set1_epi8( 0x71 ) ) );
+
+		/* Upper byte of the size 0x00 or 0x01
+		 */
+		match_values = _mm_cmpeq_epi8( _mm_min_epu8( previous_values, _mm_set1_epi8( 0x01 ) ), previous_values );
+		match_values = _mm_and_si128( match_values, class_types );
+
+		match_mask = _mm_movemask_epi8( match_values );
+
+		for( match_index = 0;
+		     match_mask != 0;
+		     match_index++ )
+		{
+			if( ( match_mask & 1 ) != 0 )
+			{
+				if( ( class_type_offset + match_index - 2 ) >= end_offset )
+				{
+					return( end_offset );
+				}
+				if( libfwsi_carver_check_candidate(
+				     data,
+				     data_size,
+				     class_type_offset + match_index - 2 ) != 0 )
+				{
+					return( class_type_offset + match_index - 2 );
+				}
+			}
+			match_mask >>= 1;
+		}
+		class_type_offset += 16;
+	}
+#endif /* defined( LIBFWSI_CARVER_HAVE_SSE2 ) */
+
+	while( class_type_offset < end_class_offset )
+	{
+		byte_value = data[ class_type_offset ];
+
+		if( ( data[ class_type_offset - 1 ] <= 0x01 )
+		 && libfwsi_carver_is_class_type( byte_value ) )
+		{
+			if( ( class_type_offset - 2 ) >= end_offset )
+			{
+				break;
+			}
+			if( libfwsi_carver_check_candidate(
+			     data,
+			     data_size,
+			     class_type_offset - 2 ) != 0 )
+			{
+				return( class_type_offset - 2 );
+			}
+		}
+		class_type_offset++;
+	}
+	return( end_offset );
+}
+
+/* Scans a buffer for shell item lists that start before the end offset
+ * The buffer offset is the offset of the buffer relative to the start of the scanned data
+ * The scan starts at the scan offset, which is set to the offset of the first unscanned byte
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_carver_scan_buffer(
+     libfwsi_internal_carver_t *internal_carver,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     off64_t buffer_offset,
+     size_t end_offset,
+     size_t *scan_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfwsi_internal_carver_scan_buffer";
+	size_t candidate_size   = 0;
+	size_t safe_scan_offset = 0;
+	int number_of_items     = 0;
+	int result              = 0;
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_scan_offset = *scan_offset;
+
+	while( safe_scan_offset < end_offset )
+	{
+		safe_scan_offset = libfwsi_carver_find_candidate(
+		                    buffer,
+		                    buffer_size,
+		                    safe_scan_offset,
+		                    end_offset );
+
+		if( safe_scan_offset >= end_offset )
+		{
+			break;
+		}
+		candidate_size = buffer_size - safe_scan_offset;
+
+		if( candidate_size > internal_carver->maximum_list_size )
+		{
+			candidate_size = internal_carver->maximum_list_size;
+		}
+		result = libfwsi_item_list_validate(
+		          &( buffer[ safe_scan_offset ] ),
+		          candidate_size,
+		          internal_carver->validate_flags | LIBFWSI_VALIDATE_FLAG_REQUIRE_TERMINATOR,
+		          &candidate_size,
+		          &number_of_items,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to validate candidate shell item list.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      || ( number_of_items == 0 ) )
+		{
+			safe_scan_offset += 1;
+
+			continue;
+		}
+		if( libfwsi_internal_carver_append_result(
+		     internal_carver,
+		     buffer_offset + (off64_t) safe_scan_offset,
+		     candidate_size,
+		     number_of_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append result.",
+			 function );
+
+			return( -1 );
+		}
+		safe_scan_offset += candidate_size;
+	}
+	if( safe_scan_offset > buffer_size )
+	{
+		safe_scan_offset = buffer_size;
+	}
+	*scan_offset = safe_scan_offset;
+
+	return( 1 );
+}
+
+/* Resizes the buffer to contain at least a specific number of bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_carver_resize_buffer(
+     libfwsi_internal_carver_t *internal_carver,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "libfwsi_internal_carver_resize_buffer";
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size <= internal_carver->allocated_buffer_size )
+	{
+		return( 1 );
+	}
+	buffer = (uint8_t *) memory_reallocate(
+	                      internal_carver->buffer,
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->buffer                = buffer;
+	internal_carver->allocated_buffer_size = buffer_size;
+
+	return( 1 );
+}
+
+/* Appends a result
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_carver_append_result(
+     libfwsi_internal_carver_t *internal_carver,
+     off64_t offset,
+     size_t size,
+     int number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_carver_result_t *carver_result = NULL;
+	libfwsi_carver_result_t *results       = NULL;
+	static char *function                  = "libfwsi_internal_carver_append_result";
+	size_t results_size                    = 0;
+	int number_of_allocated_results        = 0;
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_carver->number_of_results >= internal_carver->number_of_allocated_results )
+	{
+		if( internal_carver->number_of_allocated_results == 0 )
+		{
+			number_of_allocated_results = 16;
+		}
+		else if( internal_carver->number_of_allocated_results < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_results = internal_carver->number_of_allocated_results * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of results value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		results_size = sizeof( libfwsi_carver_result_t ) * (size_t) number_of_allocated_results;
+
+		results = (libfwsi_carver_result_t *) memory_reallocate(
+		                                       internal_carver->results,
+		                                       results_size );
+
+		if( results == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize results.",
+			 function );
+
+			return( -1 );
+		}
+		internal_carver->results                     = results;
+		internal_carver->number_of_allocated_results = number_of_allocated_results;
+	}
+	carver_result = &( internal_carver->results[ internal_carver->number_of_results ] );
+
+	carver_result->offset          = offset;
+	carver_result->size            = size;
+	carver_result->number_of_items = number_of_items;
+
+	internal_carver->number_of_results += 1;
+
+	return( 1 );
+}
+
+/* Scans data for shell item lists
+ * The data is treated as the continuation of the data of previous calls, where
+ * the last maximum list size bytes are retained until more data is available
+ * Call libfwsi_carver_scan_final after the last data to scan the retained data
+ * The results are appended to the results of previous calls
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_scan_data(
+     libfwsi_carver_t *carver,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_scan_data";
+	off64_t data_start_offset                  = 0;
+	size_t copy_size                           = 0;
+	size_t data_offset                         = 0;
+	size_t maximum_list_size                   = 0;
+	size_t retained_size                       = 0;
+	size_t scan_offset                         = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) ( SSIZE_MAX - internal_carver->buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	data_start_offset = internal_carver->buffer_offset + (off64_t) internal_carver->buffer_size;
+	maximum_list_size = internal_carver->maximum_list_size;
+
+	if( internal_carver->buffer_size > 0 )
+	{
+		/* Candidates in the retained data can extend at most the maximum list size
+		 * into the data, hence only that part of the data is copied into the buffer
+		 */
+		copy_size = data_size;
+
+		if( copy_size > maximum_list_size )
+		{
+			copy_size = maximum_list_size;
+		}
+		if( libfwsi_internal_carver_resize_buffer(
+		     internal_carver,
+		     internal_carver->buffer_size + copy_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( internal_carver->buffer[ internal_carver->buffer_size ] ),
+		     data,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		retained_size                 = internal_carver->buffer_size;
+		internal_carver->buffer_size += copy_size;
+
+		if( copy_size < maximum_list_size )
+		{
+			/* The buffer is scanned once it contains twice the maximum list size,
+			 * so that the unscanned data never overlaps with the data it is moved over
+			 */
+			if( internal_carver->buffer_size < ( 2 * maximum_list_size ) )
+			{
+				return( 1 );
+			}
+			if( libfwsi_internal_carver_scan_buffer(
+			     internal_carver,
+			     internal_carver->buffer,
+			     internal_carver->buffer_size,
+			     internal_carver->buffer_offset,
+			     internal_carver->buffer_size - maximum_list_size,
+			     &scan_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan buffer.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     internal_carver->buffer,
+			     &( internal_carver->buffer[ scan_offset ] ),
+			     internal_carver->buffer_size - scan_offset ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy unscanned data to start of buffer.",
+				 function );
+
+				return( -1 );
+			}
+			internal_carver->buffer_offset += (off64_t) scan_offset;
+			internal_carver->buffer_size   -= scan_offset;
+
+			return( 1 );
+		}
+		/* The buffer contains the maximum list size bytes of the data
+		 * hence all candidates in the retained data can be scanned
+		 */
+		if( libfwsi_internal_carver_scan_buffer(
+		     internal_carver,
+		     internal_carver->buffer,
+		     internal_carver->buffer_size,
+		     internal_carver->buffer_offset,
+		     retained_size,
+		     &scan_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset = scan_offset - retained_size;
+
+		internal_carver->buffer_offset = data_start_offset;
+		internal_carver->buffer_size   = 0;
+	}
+	/* The data is scanned in place, candidates that start within the maximum list size
+	 * of the end of the data are scanned once more data is available
+	 */
+	if( ( data_size - data_offset ) > maximum_list_size )
+	{
+		if( libfwsi_internal_carver_scan_buffer(
+		     internal_carver,
+		     data,
+		     data_size,
+		     data_start_offset,
+		     data_size - maximum_list_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	copy_size = data_size - data_offset;
+
+	if( copy_size > 0 )
+	{
+		if( libfwsi_internal_carver_resize_buffer(
+		     internal_carver,
+		     copy_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     internal_carver->buffer,
+		     &( data[ data_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_carver->buffer_offset = data_start_offset + (off64_t) data_offset;
+	internal_carver->buffer_size   = copy_size;
+
+	return( 1 );
+}
+
+/* Scans the data retained by previous calls to libfwsi_carver_scan_data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_scan_final(
+     libfwsi_carver_t *carver,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_scan_final";
+	size_t scan_offset                         = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( internal_carver->buffer_size > 0 )
+	{
+		if( libfwsi_internal_carver_scan_buffer(
+		     internal_carver,
+		     internal_carver->buffer,
+		     internal_carver->buffer_size,
+		     internal_carver->buffer_offset,
+		     internal_carver->buffer_size,
+		     &scan_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_carver->buffer_offset += (off64_t) internal_carver->buffer_size;
+	internal_carver->buffer_size    = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of results
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_get_number_of_results(
+     libfwsi_carver_t *carver,
+     int *number_of_results,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_get_number_of_results";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( number_of_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of results.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_results = internal_carver->number_of_results;
+
+	return( 1 );
+}
+
+/* Retrieves a specific result
+ * The offset is relative to the start of the data passed to the first call of libfwsi_carver_scan_data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_get_result(
+     libfwsi_carver_t *carver,
+     int result_index,
+     off64_t *offset,
+     size_t *size,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_carver_result_t *carver_result     = NULL;
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_get_result";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_carver->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	carver_result = &( internal_carver->results[ result_index ] );
+
+	*offset          = carver_result->offset;
+	*size            = carver_result->size;
+	*number_of_items = carver_result->number_of_items;
+
+	return( 1 );
+}
+
+/* Clears the results
+ * The results are retained until they are cleared or the carver is freed, to limit
+ * the memory used when scanning a large amount of data retrieve and clear the results
+ * after every call to libfwsi_carver_scan_data
+ * The memory of the results is reused for the results of subsequent scans
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_carver_clear_results(
+     libfwsi_carver_t *carver,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libfwsi_carver_clear_results";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libfwsi_internal_carver_t *) carver;
+
+	internal_carver->number_of_results = 0;
+
+	return( 1 );
+}
+
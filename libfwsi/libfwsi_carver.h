@@ -0,0 +1,194 @@
+/*
+ * Shell item list carver functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_CARVER_H )
+#define _LIBFWSI_CARVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default maximum size of a carved shell item list
+ * This is also the number of bytes retained between successive scans
+ */
+#define LIBFWSI_CARVER_DEFAULT_MAXIMUM_LIST_SIZE	65536
+
+/* The minimum size of the first shell item of a carved shell item list
+ */
+#define LIBFWSI_CARVER_MINIMUM_ITEM_SIZE		0x14
+
+typedef struct libfwsi_carver_result libfwsi_carver_result_t;
+
+struct libfwsi_carver_result
+{
+	/* The offset of the shell item list relative to the start of the scanned data
+	 */
+	off64_t offset;
+
+	/* The size of the shell item list including the terminator
+	 */
+	size_t size;
+
+	/* The number of items
+	 */
+	int number_of_items;
+};
+
+typedef struct libfwsi_internal_carver libfwsi_internal_carver_t;
+
+struct libfwsi_internal_carver
+{
+	/* The buffer containing data that has not been scanned
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The allocated buffer size
+	 */
+	size_t allocated_buffer_size;
+
+	/* The offset of the start of the buffer relative to the start of the scanned data
+	 */
+	off64_t buffer_offset;
+
+	/* The maximum list size
+	 */
+	size_t maximum_list_size;
+
+	/* The validate flags
+	 */
+	uint32_t validate_flags;
+
+	/* The results
+	 */
+	libfwsi_carver_result_t *results;
+
+	/* The number of results
+	 */
+	int number_of_results;
+
+	/* The number of allocated results
+	 */
+	int number_of_allocated_results;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_initialize(
+     libfwsi_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_free(
+     libfwsi_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_set_maximum_list_size(
+     libfwsi_carver_t *carver,
+     size_t maximum_list_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_set_validate_flags(
+     libfwsi_carver_t *carver,
+     uint32_t validate_flags,
+     libcerror_error_t **error );
+
+int libfwsi_carver_check_candidate(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset );
+
+size_t libfwsi_carver_find_candidate(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset,
+        size_t end_offset );
+
+int libfwsi_internal_carver_scan_buffer(
+     libfwsi_internal_carver_t *internal_carver,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     off64_t buffer_offset,
+     size_t end_offset,
+     size_t *scan_offset,
+     libcerror_error_t **error );
+
+int libfwsi_internal_carver_resize_buffer(
+     libfwsi_internal_carver_t *internal_carver,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libfwsi_internal_carver_append_result(
+     libfwsi_internal_carver_t *internal_carver,
+     off64_t offset,
+     size_t size,
+     int number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_scan_data(
+     libfwsi_carver_t *carver,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_scan_final(
+     libfwsi_carver_t *carver,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_get_number_of_results(
+     libfwsi_carver_t *carver,
+     int *number_of_results,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_get_result(
+     libfwsi_carver_t *carver,
+     int result_index,
+     off64_t *offset,
+     size_t *size,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_carver_clear_results(
+     libfwsi_carver_t *carver,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_CARVER_H ) */
+
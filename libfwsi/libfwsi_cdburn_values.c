@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_cdburn_values.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
@@ -131,6 +132,8 @@ int libfwsi_cdburn_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_CDBURN_PARSER )
+
 /* Reads the CD burn values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -271,3 +274,5 @@ int libfwsi_cdburn_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_CDBURN_PARSER ) */
+
@@ -48,12 +48,16 @@ int libfwsi_cdburn_values_free(
      libfwsi_cdburn_values_t **cdburn_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_CDBURN_PARSER )
+
 int libfwsi_cdburn_values_read_data(
      libfwsi_cdburn_values_t *cdburn_values,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_CDBURN_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
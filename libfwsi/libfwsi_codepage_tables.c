@@ -0,0 +1,1305 @@
+/*
+ * Codepage tables
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_codepage.h"
+#include "libfwsi_codepage_tables.h"
+#include "libfwsi_codepage_windows_932.h"
+#include "libfwsi_codepage_windows_936.h"
+#include "libfwsi_codepage_windows_949.h"
+#include "libfwsi_codepage_windows_950.h"
+
+/* Codepage ASCII byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_ascii_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd };
+
+/* Codepage ASCII byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_ascii_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 } };
+
+/* Codepage Windows 874 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_874_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x2026, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0x00a0, 0x0e01, 0x0e02, 0x0e03, 0x0e04, 0x0e05, 0x0e06, 0x0e07,
+	0x0e08, 0x0e09, 0x0e0a, 0x0e0b, 0x0e0c, 0x0e0d, 0x0e0e, 0x0e0f,
+	0x0e10, 0x0e11, 0x0e12, 0x0e13, 0x0e14, 0x0e15, 0x0e16, 0x0e17,
+	0x0e18, 0x0e19, 0x0e1a, 0x0e1b, 0x0e1c, 0x0e1d, 0x0e1e, 0x0e1f,
+	0x0e20, 0x0e21, 0x0e22, 0x0e23, 0x0e24, 0x0e25, 0x0e26, 0x0e27,
+	0x0e28, 0x0e29, 0x0e2a, 0x0e2b, 0x0e2c, 0x0e2d, 0x0e2e, 0x0e2f,
+	0x0e30, 0x0e31, 0x0e32, 0x0e33, 0x0e34, 0x0e35, 0x0e36, 0x0e37,
+	0x0e38, 0x0e39, 0x0e3a, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x0e3f,
+	0x0e40, 0x0e41, 0x0e42, 0x0e43, 0x0e44, 0x0e45, 0x0e46, 0x0e47,
+	0x0e48, 0x0e49, 0x0e4a, 0x0e4b, 0x0e4c, 0x0e4d, 0x0e4e, 0x0e4f,
+	0x0e50, 0x0e51, 0x0e52, 0x0e53, 0x0e54, 0x0e55, 0x0e56, 0x0e57,
+	0x0e58, 0x0e59, 0x0e5a, 0x0e5b, 0xfffd, 0xfffd, 0xfffd, 0xfffd };
+
+/* Codepage Windows 874 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_874_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xe0, 0xb8, 0x81, 3 }, { 0xe0, 0xb8, 0x82, 3 }, { 0xe0, 0xb8, 0x83, 3 },
+	{ 0xe0, 0xb8, 0x84, 3 }, { 0xe0, 0xb8, 0x85, 3 }, { 0xe0, 0xb8, 0x86, 3 }, { 0xe0, 0xb8, 0x87, 3 },
+	{ 0xe0, 0xb8, 0x88, 3 }, { 0xe0, 0xb8, 0x89, 3 }, { 0xe0, 0xb8, 0x8a, 3 }, { 0xe0, 0xb8, 0x8b, 3 },
+	{ 0xe0, 0xb8, 0x8c, 3 }, { 0xe0, 0xb8, 0x8d, 3 }, { 0xe0, 0xb8, 0x8e, 3 }, { 0xe0, 0xb8, 0x8f, 3 },
+	{ 0xe0, 0xb8, 0x90, 3 }, { 0xe0, 0xb8, 0x91, 3 }, { 0xe0, 0xb8, 0x92, 3 }, { 0xe0, 0xb8, 0x93, 3 },
+	{ 0xe0, 0xb8, 0x94, 3 }, { 0xe0, 0xb8, 0x95, 3 }, { 0xe0, 0xb8, 0x96, 3 }, { 0xe0, 0xb8, 0x97, 3 },
+	{ 0xe0, 0xb8, 0x98, 3 }, { 0xe0, 0xb8, 0x99, 3 }, { 0xe0, 0xb8, 0x9a, 3 }, { 0xe0, 0xb8, 0x9b, 3 },
+	{ 0xe0, 0xb8, 0x9c, 3 }, { 0xe0, 0xb8, 0x9d, 3 }, { 0xe0, 0xb8, 0x9e, 3 }, { 0xe0, 0xb8, 0x9f, 3 },
+	{ 0xe0, 0xb8, 0xa0, 3 }, { 0xe0, 0xb8, 0xa1, 3 }, { 0xe0, 0xb8, 0xa2, 3 }, { 0xe0, 0xb8, 0xa3, 3 },
+	{ 0xe0, 0xb8, 0xa4, 3 }, { 0xe0, 0xb8, 0xa5, 3 }, { 0xe0, 0xb8, 0xa6, 3 }, { 0xe0, 0xb8, 0xa7, 3 },
+	{ 0xe0, 0xb8, 0xa8, 3 }, { 0xe0, 0xb8, 0xa9, 3 }, { 0xe0, 0xb8, 0xaa, 3 }, { 0xe0, 0xb8, 0xab, 3 },
+	{ 0xe0, 0xb8, 0xac, 3 }, { 0xe0, 0xb8, 0xad, 3 }, { 0xe0, 0xb8, 0xae, 3 }, { 0xe0, 0xb8, 0xaf, 3 },
+	{ 0xe0, 0xb8, 0xb0, 3 }, { 0xe0, 0xb8, 0xb1, 3 }, { 0xe0, 0xb8, 0xb2, 3 }, { 0xe0, 0xb8, 0xb3, 3 },
+	{ 0xe0, 0xb8, 0xb4, 3 }, { 0xe0, 0xb8, 0xb5, 3 }, { 0xe0, 0xb8, 0xb6, 3 }, { 0xe0, 0xb8, 0xb7, 3 },
+	{ 0xe0, 0xb8, 0xb8, 3 }, { 0xe0, 0xb8, 0xb9, 3 }, { 0xe0, 0xb8, 0xba, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe0, 0xb8, 0xbf, 3 },
+	{ 0xe0, 0xb9, 0x80, 3 }, { 0xe0, 0xb9, 0x81, 3 }, { 0xe0, 0xb9, 0x82, 3 }, { 0xe0, 0xb9, 0x83, 3 },
+	{ 0xe0, 0xb9, 0x84, 3 }, { 0xe0, 0xb9, 0x85, 3 }, { 0xe0, 0xb9, 0x86, 3 }, { 0xe0, 0xb9, 0x87, 3 },
+	{ 0xe0, 0xb9, 0x88, 3 }, { 0xe0, 0xb9, 0x89, 3 }, { 0xe0, 0xb9, 0x8a, 3 }, { 0xe0, 0xb9, 0x8b, 3 },
+	{ 0xe0, 0xb9, 0x8c, 3 }, { 0xe0, 0xb9, 0x8d, 3 }, { 0xe0, 0xb9, 0x8e, 3 }, { 0xe0, 0xb9, 0x8f, 3 },
+	{ 0xe0, 0xb9, 0x90, 3 }, { 0xe0, 0xb9, 0x91, 3 }, { 0xe0, 0xb9, 0x92, 3 }, { 0xe0, 0xb9, 0x93, 3 },
+	{ 0xe0, 0xb9, 0x94, 3 }, { 0xe0, 0xb9, 0x95, 3 }, { 0xe0, 0xb9, 0x96, 3 }, { 0xe0, 0xb9, 0x97, 3 },
+	{ 0xe0, 0xb9, 0x98, 3 }, { 0xe0, 0xb9, 0x99, 3 }, { 0xe0, 0xb9, 0x9a, 3 }, { 0xe0, 0xb9, 0x9b, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 } };
+
+/* Codepage Windows 1250 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1250_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0xfffd, 0x201a, 0xfffd, 0x201e, 0x2026, 0x2020, 0x2021,
+	0xfffd, 0x2030, 0x0160, 0x2039, 0x015a, 0x0164, 0x017d, 0x0179,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0xfffd, 0x2122, 0x0161, 0x203a, 0x015b, 0x0165, 0x017e, 0x017a,
+	0x00a0, 0x02c7, 0x02d8, 0x0141, 0x00a4, 0x0104, 0x00a6, 0x00a7,
+	0x00a8, 0x00a9, 0x015e, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x017b,
+	0x00b0, 0x00b1, 0x02db, 0x0142, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+	0x00b8, 0x0105, 0x015f, 0x00bb, 0x013d, 0x02dd, 0x013e, 0x017c,
+	0x0154, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x0139, 0x0106, 0x00c7,
+	0x010c, 0x00c9, 0x0118, 0x00cb, 0x011a, 0x00cd, 0x00ce, 0x010e,
+	0x0110, 0x0143, 0x0147, 0x00d3, 0x00d4, 0x0150, 0x00d6, 0x00d7,
+	0x0158, 0x016e, 0x00da, 0x0170, 0x00dc, 0x00dd, 0x0162, 0x00df,
+	0x0155, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x013a, 0x0107, 0x00e7,
+	0x010d, 0x00e9, 0x0119, 0x00eb, 0x011b, 0x00ed, 0x00ee, 0x010f,
+	0x0111, 0x0144, 0x0148, 0x00f3, 0x00f4, 0x0151, 0x00f6, 0x00f7,
+	0x0159, 0x016f, 0x00fa, 0x0171, 0x00fc, 0x00fd, 0x0163, 0x02d9 };
+
+/* Codepage Windows 1250 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1250_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xc5, 0x9a, 0x00, 2 }, { 0xc5, 0xa4, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc5, 0xb9, 0x00, 2 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xc5, 0x9b, 0x00, 2 }, { 0xc5, 0xa5, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0xba, 0x00, 2 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xcb, 0x87, 0x00, 2 }, { 0xcb, 0x98, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 },
+	{ 0xc2, 0xa4, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xcb, 0x9b, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 },
+	{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xc2, 0xb8, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xc4, 0xbd, 0x00, 2 }, { 0xcb, 0x9d, 0x00, 2 }, { 0xc4, 0xbe, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 },
+	{ 0xc5, 0x94, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc4, 0x82, 0x00, 2 },
+	{ 0xc3, 0x84, 0x00, 2 }, { 0xc4, 0xb9, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+	{ 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+	{ 0xc4, 0x9a, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc4, 0x8e, 0x00, 2 },
+	{ 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc5, 0x87, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+	{ 0xc3, 0x94, 0x00, 2 }, { 0xc5, 0x90, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+	{ 0xc5, 0x98, 0x00, 2 }, { 0xc5, 0xae, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc5, 0xb0, 0x00, 2 },
+	{ 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc5, 0xa2, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+	{ 0xc5, 0x95, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc4, 0x83, 0x00, 2 },
+	{ 0xc3, 0xa4, 0x00, 2 }, { 0xc4, 0xba, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+	{ 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+	{ 0xc4, 0x9b, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc4, 0x8f, 0x00, 2 },
+	{ 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc5, 0x88, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+	{ 0xc3, 0xb4, 0x00, 2 }, { 0xc5, 0x91, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+	{ 0xc5, 0x99, 0x00, 2 }, { 0xc5, 0xaf, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc5, 0xb1, 0x00, 2 },
+	{ 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc5, 0xa3, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 } };
+
+/* Codepage Windows 1251 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1251_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x0402, 0x0403, 0x201a, 0x0453, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x20ac, 0x2030, 0x0409, 0x2039, 0x040a, 0x040c, 0x040b, 0x040f,
+	0x0452, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0xfffd, 0x2122, 0x0459, 0x203a, 0x045a, 0x045c, 0x045b, 0x045f,
+	0x00a0, 0x040e, 0x045e, 0x0408, 0x00a4, 0x0490, 0x00a6, 0x00a7,
+	0x0401, 0x00a9, 0x0404, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x0407,
+	0x00b0, 0x00b1, 0x0406, 0x0456, 0x0491, 0x00b5, 0x00b6, 0x00b7,
+	0x0451, 0x2116, 0x0454, 0x00bb, 0x0458, 0x0405, 0x0455, 0x0457,
+	0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+	0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e, 0x041f,
+	0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+	0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+	0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+	0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+	0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f };
+
+/* Codepage Windows 1251 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1251_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xd0, 0x82, 0x00, 2 }, { 0xd0, 0x83, 0x00, 2 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xd1, 0x93, 0x00, 2 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xd0, 0x89, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xd0, 0x8a, 0x00, 2 }, { 0xd0, 0x8c, 0x00, 2 }, { 0xd0, 0x8b, 0x00, 2 }, { 0xd0, 0x8f, 0x00, 2 },
+	{ 0xd1, 0x92, 0x00, 2 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xd1, 0x99, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xd1, 0x9a, 0x00, 2 }, { 0xd1, 0x9c, 0x00, 2 }, { 0xd1, 0x9b, 0x00, 2 }, { 0xd1, 0x9f, 0x00, 2 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xd0, 0x8e, 0x00, 2 }, { 0xd1, 0x9e, 0x00, 2 }, { 0xd0, 0x88, 0x00, 2 },
+	{ 0xc2, 0xa4, 0x00, 2 }, { 0xd2, 0x90, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xd0, 0x81, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xd0, 0x84, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xd0, 0x87, 0x00, 2 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xd0, 0x86, 0x00, 2 }, { 0xd1, 0x96, 0x00, 2 },
+	{ 0xd2, 0x91, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xd1, 0x91, 0x00, 2 }, { 0xe2, 0x84, 0x96, 3 }, { 0xd1, 0x94, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xd1, 0x98, 0x00, 2 }, { 0xd0, 0x85, 0x00, 2 }, { 0xd1, 0x95, 0x00, 2 }, { 0xd1, 0x97, 0x00, 2 },
+	{ 0xd0, 0x90, 0x00, 2 }, { 0xd0, 0x91, 0x00, 2 }, { 0xd0, 0x92, 0x00, 2 }, { 0xd0, 0x93, 0x00, 2 },
+	{ 0xd0, 0x94, 0x00, 2 }, { 0xd0, 0x95, 0x00, 2 }, { 0xd0, 0x96, 0x00, 2 }, { 0xd0, 0x97, 0x00, 2 },
+	{ 0xd0, 0x98, 0x00, 2 }, { 0xd0, 0x99, 0x00, 2 }, { 0xd0, 0x9a, 0x00, 2 }, { 0xd0, 0x9b, 0x00, 2 },
+	{ 0xd0, 0x9c, 0x00, 2 }, { 0xd0, 0x9d, 0x00, 2 }, { 0xd0, 0x9e, 0x00, 2 }, { 0xd0, 0x9f, 0x00, 2 },
+	{ 0xd0, 0xa0, 0x00, 2 }, { 0xd0, 0xa1, 0x00, 2 }, { 0xd0, 0xa2, 0x00, 2 }, { 0xd0, 0xa3, 0x00, 2 },
+	{ 0xd0, 0xa4, 0x00, 2 }, { 0xd0, 0xa5, 0x00, 2 }, { 0xd0, 0xa6, 0x00, 2 }, { 0xd0, 0xa7, 0x00, 2 },
+	{ 0xd0, 0xa8, 0x00, 2 }, { 0xd0, 0xa9, 0x00, 2 }, { 0xd0, 0xaa, 0x00, 2 }, { 0xd0, 0xab, 0x00, 2 },
+	{ 0xd0, 0xac, 0x00, 2 }, { 0xd0, 0xad, 0x00, 2 }, { 0xd0, 0xae, 0x00, 2 }, { 0xd0, 0xaf, 0x00, 2 },
+	{ 0xd0, 0xb0, 0x00, 2 }, { 0xd0, 0xb1, 0x00, 2 }, { 0xd0, 0xb2, 0x00, 2 }, { 0xd0, 0xb3, 0x00, 2 },
+	{ 0xd0, 0xb4, 0x00, 2 }, { 0xd0, 0xb5, 0x00, 2 }, { 0xd0, 0xb6, 0x00, 2 }, { 0xd0, 0xb7, 0x00, 2 },
+	{ 0xd0, 0xb8, 0x00, 2 }, { 0xd0, 0xb9, 0x00, 2 }, { 0xd0, 0xba, 0x00, 2 }, { 0xd0, 0xbb, 0x00, 2 },
+	{ 0xd0, 0xbc, 0x00, 2 }, { 0xd0, 0xbd, 0x00, 2 }, { 0xd0, 0xbe, 0x00, 2 }, { 0xd0, 0xbf, 0x00, 2 },
+	{ 0xd1, 0x80, 0x00, 2 }, { 0xd1, 0x81, 0x00, 2 }, { 0xd1, 0x82, 0x00, 2 }, { 0xd1, 0x83, 0x00, 2 },
+	{ 0xd1, 0x84, 0x00, 2 }, { 0xd1, 0x85, 0x00, 2 }, { 0xd1, 0x86, 0x00, 2 }, { 0xd1, 0x87, 0x00, 2 },
+	{ 0xd1, 0x88, 0x00, 2 }, { 0xd1, 0x89, 0x00, 2 }, { 0xd1, 0x8a, 0x00, 2 }, { 0xd1, 0x8b, 0x00, 2 },
+	{ 0xd1, 0x8c, 0x00, 2 }, { 0xd1, 0x8d, 0x00, 2 }, { 0xd1, 0x8e, 0x00, 2 }, { 0xd1, 0x8f, 0x00, 2 } };
+
+/* Codepage Windows 1252 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1252_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0xfffd, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0xfffd, 0x017d, 0xfffd,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0xfffd, 0x017e, 0x0178,
+	0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+	0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+	0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+	0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+	0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+	0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+	0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+	0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+	0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+	0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+	0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+	0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff };
+
+/* Codepage Windows 1252 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1252_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xc5, 0x92, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xcb, 0x9c, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xc5, 0x93, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+	{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+	{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+	{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+	{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+	{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+	{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+	{ 0xc3, 0x90, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+	{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+	{ 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+	{ 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+	{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+	{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+	{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+	{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+	{ 0xc3, 0xb0, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+	{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+	{ 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+	{ 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 } };
+
+/* Codepage Windows 1253 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1253_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0xfffd, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0xfffd, 0x2030, 0xfffd, 0x2039, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0xfffd, 0x2122, 0xfffd, 0x203a, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0x00a0, 0x0385, 0x0386, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+	0x00a8, 0x00a9, 0xfffd, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x2015,
+	0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x0384, 0x00b5, 0x00b6, 0x00b7,
+	0x0388, 0x0389, 0x038a, 0x00bb, 0x038c, 0x00bd, 0x038e, 0x038f,
+	0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+	0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f,
+	0x03a0, 0x03a1, 0xfffd, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+	0x03a8, 0x03a9, 0x03aa, 0x03ab, 0x03ac, 0x03ad, 0x03ae, 0x03af,
+	0x03b0, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7,
+	0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf,
+	0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+	0x03c8, 0x03c9, 0x03ca, 0x03cb, 0x03cc, 0x03cd, 0x03ce, 0xfffd };
+
+/* Codepage Windows 1253 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1253_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xce, 0x85, 0x00, 2 }, { 0xce, 0x86, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+	{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xe2, 0x80, 0x95, 3 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+	{ 0xce, 0x84, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xce, 0x88, 0x00, 2 }, { 0xce, 0x89, 0x00, 2 }, { 0xce, 0x8a, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xce, 0x8c, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xce, 0x8e, 0x00, 2 }, { 0xce, 0x8f, 0x00, 2 },
+	{ 0xce, 0x90, 0x00, 2 }, { 0xce, 0x91, 0x00, 2 }, { 0xce, 0x92, 0x00, 2 }, { 0xce, 0x93, 0x00, 2 },
+	{ 0xce, 0x94, 0x00, 2 }, { 0xce, 0x95, 0x00, 2 }, { 0xce, 0x96, 0x00, 2 }, { 0xce, 0x97, 0x00, 2 },
+	{ 0xce, 0x98, 0x00, 2 }, { 0xce, 0x99, 0x00, 2 }, { 0xce, 0x9a, 0x00, 2 }, { 0xce, 0x9b, 0x00, 2 },
+	{ 0xce, 0x9c, 0x00, 2 }, { 0xce, 0x9d, 0x00, 2 }, { 0xce, 0x9e, 0x00, 2 }, { 0xce, 0x9f, 0x00, 2 },
+	{ 0xce, 0xa0, 0x00, 2 }, { 0xce, 0xa1, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xce, 0xa3, 0x00, 2 },
+	{ 0xce, 0xa4, 0x00, 2 }, { 0xce, 0xa5, 0x00, 2 }, { 0xce, 0xa6, 0x00, 2 }, { 0xce, 0xa7, 0x00, 2 },
+	{ 0xce, 0xa8, 0x00, 2 }, { 0xce, 0xa9, 0x00, 2 }, { 0xce, 0xaa, 0x00, 2 }, { 0xce, 0xab, 0x00, 2 },
+	{ 0xce, 0xac, 0x00, 2 }, { 0xce, 0xad, 0x00, 2 }, { 0xce, 0xae, 0x00, 2 }, { 0xce, 0xaf, 0x00, 2 },
+	{ 0xce, 0xb0, 0x00, 2 }, { 0xce, 0xb1, 0x00, 2 }, { 0xce, 0xb2, 0x00, 2 }, { 0xce, 0xb3, 0x00, 2 },
+	{ 0xce, 0xb4, 0x00, 2 }, { 0xce, 0xb5, 0x00, 2 }, { 0xce, 0xb6, 0x00, 2 }, { 0xce, 0xb7, 0x00, 2 },
+	{ 0xce, 0xb8, 0x00, 2 }, { 0xce, 0xb9, 0x00, 2 }, { 0xce, 0xba, 0x00, 2 }, { 0xce, 0xbb, 0x00, 2 },
+	{ 0xce, 0xbc, 0x00, 2 }, { 0xce, 0xbd, 0x00, 2 }, { 0xce, 0xbe, 0x00, 2 }, { 0xce, 0xbf, 0x00, 2 },
+	{ 0xcf, 0x80, 0x00, 2 }, { 0xcf, 0x81, 0x00, 2 }, { 0xcf, 0x82, 0x00, 2 }, { 0xcf, 0x83, 0x00, 2 },
+	{ 0xcf, 0x84, 0x00, 2 }, { 0xcf, 0x85, 0x00, 2 }, { 0xcf, 0x86, 0x00, 2 }, { 0xcf, 0x87, 0x00, 2 },
+	{ 0xcf, 0x88, 0x00, 2 }, { 0xcf, 0x89, 0x00, 2 }, { 0xcf, 0x8a, 0x00, 2 }, { 0xcf, 0x8b, 0x00, 2 },
+	{ 0xcf, 0x8c, 0x00, 2 }, { 0xcf, 0x8d, 0x00, 2 }, { 0xcf, 0x8e, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 } };
+
+/* Codepage Windows 1254 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1254_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0xfffd, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0xfffd, 0xfffd, 0x0178,
+	0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+	0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+	0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+	0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+	0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+	0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+	0x011e, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+	0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x0130, 0x015e, 0x00df,
+	0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+	0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+	0x011f, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+	0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x0131, 0x015f, 0x00ff };
+
+/* Codepage Windows 1254 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1254_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xc5, 0x92, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xcb, 0x9c, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xc5, 0x93, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xc5, 0xb8, 0x00, 2 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+	{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+	{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+	{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+	{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+	{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+	{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+	{ 0xc4, 0x9e, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+	{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+	{ 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+	{ 0xc3, 0x9c, 0x00, 2 }, { 0xc4, 0xb0, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+	{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+	{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+	{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+	{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+	{ 0xc4, 0x9f, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+	{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+	{ 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+	{ 0xc3, 0xbc, 0x00, 2 }, { 0xc4, 0xb1, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 } };
+
+/* Codepage Windows 1255 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1255_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0xfffd, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x02c6, 0x2030, 0xfffd, 0x2039, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0x02dc, 0x2122, 0xfffd, 0x203a, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x20aa, 0x00a5, 0x00a6, 0x00a7,
+	0x00a8, 0x00a9, 0x00d7, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+	0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+	0x00b8, 0x00b9, 0x00f7, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+	0x05b0, 0x05b1, 0x05b2, 0x05b3, 0x05b4, 0x05b5, 0x05b6, 0x05b7,
+	0x05b8, 0x05b9, 0xfffd, 0x05bb, 0x05bc, 0x05bd, 0x05be, 0x05bf,
+	0x05c0, 0x05c1, 0x05c2, 0x05c3, 0x05f0, 0x05f1, 0x05f2, 0x05f3,
+	0x05f4, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0x05d0, 0x05d1, 0x05d2, 0x05d3, 0x05d4, 0x05d5, 0x05d6, 0x05d7,
+	0x05d8, 0x05d9, 0x05da, 0x05db, 0x05dc, 0x05dd, 0x05de, 0x05df,
+	0x05e0, 0x05e1, 0x05e2, 0x05e3, 0x05e4, 0x05e5, 0x05e6, 0x05e7,
+	0x05e8, 0x05e9, 0x05ea, 0xfffd, 0xfffd, 0x200e, 0x200f, 0xfffd };
+
+/* Codepage Windows 1255 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1255_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xcb, 0x9c, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+	{ 0xe2, 0x82, 0xaa, 3 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+	{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+	{ 0xd6, 0xb0, 0x00, 2 }, { 0xd6, 0xb1, 0x00, 2 }, { 0xd6, 0xb2, 0x00, 2 }, { 0xd6, 0xb3, 0x00, 2 },
+	{ 0xd6, 0xb4, 0x00, 2 }, { 0xd6, 0xb5, 0x00, 2 }, { 0xd6, 0xb6, 0x00, 2 }, { 0xd6, 0xb7, 0x00, 2 },
+	{ 0xd6, 0xb8, 0x00, 2 }, { 0xd6, 0xb9, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xd6, 0xbb, 0x00, 2 },
+	{ 0xd6, 0xbc, 0x00, 2 }, { 0xd6, 0xbd, 0x00, 2 }, { 0xd6, 0xbe, 0x00, 2 }, { 0xd6, 0xbf, 0x00, 2 },
+	{ 0xd7, 0x80, 0x00, 2 }, { 0xd7, 0x81, 0x00, 2 }, { 0xd7, 0x82, 0x00, 2 }, { 0xd7, 0x83, 0x00, 2 },
+	{ 0xd7, 0xb0, 0x00, 2 }, { 0xd7, 0xb1, 0x00, 2 }, { 0xd7, 0xb2, 0x00, 2 }, { 0xd7, 0xb3, 0x00, 2 },
+	{ 0xd7, 0xb4, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xd7, 0x90, 0x00, 2 }, { 0xd7, 0x91, 0x00, 2 }, { 0xd7, 0x92, 0x00, 2 }, { 0xd7, 0x93, 0x00, 2 },
+	{ 0xd7, 0x94, 0x00, 2 }, { 0xd7, 0x95, 0x00, 2 }, { 0xd7, 0x96, 0x00, 2 }, { 0xd7, 0x97, 0x00, 2 },
+	{ 0xd7, 0x98, 0x00, 2 }, { 0xd7, 0x99, 0x00, 2 }, { 0xd7, 0x9a, 0x00, 2 }, { 0xd7, 0x9b, 0x00, 2 },
+	{ 0xd7, 0x9c, 0x00, 2 }, { 0xd7, 0x9d, 0x00, 2 }, { 0xd7, 0x9e, 0x00, 2 }, { 0xd7, 0x9f, 0x00, 2 },
+	{ 0xd7, 0xa0, 0x00, 2 }, { 0xd7, 0xa1, 0x00, 2 }, { 0xd7, 0xa2, 0x00, 2 }, { 0xd7, 0xa3, 0x00, 2 },
+	{ 0xd7, 0xa4, 0x00, 2 }, { 0xd7, 0xa5, 0x00, 2 }, { 0xd7, 0xa6, 0x00, 2 }, { 0xd7, 0xa7, 0x00, 2 },
+	{ 0xd7, 0xa8, 0x00, 2 }, { 0xd7, 0xa9, 0x00, 2 }, { 0xd7, 0xaa, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x8e, 3 }, { 0xe2, 0x80, 0x8f, 3 }, { 0xef, 0xbf, 0xbd, 3 } };
+
+/* Codepage Windows 1256 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1256_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0x067e, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x02c6, 0x2030, 0x0679, 0x2039, 0x0152, 0x0686, 0x0698, 0x0688,
+	0x06af, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0x06a9, 0x2122, 0x0691, 0x203a, 0x0153, 0x200c, 0x200d, 0x06ba,
+	0x00a0, 0x060c, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+	0x00a8, 0x00a9, 0x06be, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+	0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+	0x00b8, 0x00b9, 0x061b, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x061f,
+	0x06c1, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627,
+	0x0628, 0x0629, 0x062a, 0x062b, 0x062c, 0x062d, 0x062e, 0x062f,
+	0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x00d7,
+	0x0637, 0x0638, 0x0639, 0x063a, 0x0640, 0x0641, 0x0642, 0x0643,
+	0x00e0, 0x0644, 0x00e2, 0x0645, 0x0646, 0x0647, 0x0648, 0x00e7,
+	0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x0649, 0x064a, 0x00ee, 0x00ef,
+	0x064b, 0x064c, 0x064d, 0x064e, 0x00f4, 0x064f, 0x0650, 0x00f7,
+	0x0651, 0x00f9, 0x0652, 0x00fb, 0x00fc, 0x200e, 0x200f, 0x06d2 };
+
+/* Codepage Windows 1256 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1256_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xd9, 0xbe, 0x00, 2 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xd9, 0xb9, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xc5, 0x92, 0x00, 2 }, { 0xda, 0x86, 0x00, 2 }, { 0xda, 0x98, 0x00, 2 }, { 0xda, 0x88, 0x00, 2 },
+	{ 0xda, 0xaf, 0x00, 2 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xda, 0xa9, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xda, 0x91, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xc5, 0x93, 0x00, 2 }, { 0xe2, 0x80, 0x8c, 3 }, { 0xe2, 0x80, 0x8d, 3 }, { 0xda, 0xba, 0x00, 2 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xd8, 0x8c, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+	{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xda, 0xbe, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+	{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xd8, 0x9b, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xd8, 0x9f, 0x00, 2 },
+	{ 0xdb, 0x81, 0x00, 2 }, { 0xd8, 0xa1, 0x00, 2 }, { 0xd8, 0xa2, 0x00, 2 }, { 0xd8, 0xa3, 0x00, 2 },
+	{ 0xd8, 0xa4, 0x00, 2 }, { 0xd8, 0xa5, 0x00, 2 }, { 0xd8, 0xa6, 0x00, 2 }, { 0xd8, 0xa7, 0x00, 2 },
+	{ 0xd8, 0xa8, 0x00, 2 }, { 0xd8, 0xa9, 0x00, 2 }, { 0xd8, 0xaa, 0x00, 2 }, { 0xd8, 0xab, 0x00, 2 },
+	{ 0xd8, 0xac, 0x00, 2 }, { 0xd8, 0xad, 0x00, 2 }, { 0xd8, 0xae, 0x00, 2 }, { 0xd8, 0xaf, 0x00, 2 },
+	{ 0xd8, 0xb0, 0x00, 2 }, { 0xd8, 0xb1, 0x00, 2 }, { 0xd8, 0xb2, 0x00, 2 }, { 0xd8, 0xb3, 0x00, 2 },
+	{ 0xd8, 0xb4, 0x00, 2 }, { 0xd8, 0xb5, 0x00, 2 }, { 0xd8, 0xb6, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+	{ 0xd8, 0xb7, 0x00, 2 }, { 0xd8, 0xb8, 0x00, 2 }, { 0xd8, 0xb9, 0x00, 2 }, { 0xd8, 0xba, 0x00, 2 },
+	{ 0xd9, 0x80, 0x00, 2 }, { 0xd9, 0x81, 0x00, 2 }, { 0xd9, 0x82, 0x00, 2 }, { 0xd9, 0x83, 0x00, 2 },
+	{ 0xc3, 0xa0, 0x00, 2 }, { 0xd9, 0x84, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xd9, 0x85, 0x00, 2 },
+	{ 0xd9, 0x86, 0x00, 2 }, { 0xd9, 0x87, 0x00, 2 }, { 0xd9, 0x88, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+	{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+	{ 0xd9, 0x89, 0x00, 2 }, { 0xd9, 0x8a, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+	{ 0xd9, 0x8b, 0x00, 2 }, { 0xd9, 0x8c, 0x00, 2 }, { 0xd9, 0x8d, 0x00, 2 }, { 0xd9, 0x8e, 0x00, 2 },
+	{ 0xc3, 0xb4, 0x00, 2 }, { 0xd9, 0x8f, 0x00, 2 }, { 0xd9, 0x90, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+	{ 0xd9, 0x91, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xd9, 0x92, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+	{ 0xc3, 0xbc, 0x00, 2 }, { 0xe2, 0x80, 0x8e, 3 }, { 0xe2, 0x80, 0x8f, 3 }, { 0xdb, 0x92, 0x00, 2 } };
+
+/* Codepage Windows 1257 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1257_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0xfffd, 0x201a, 0xfffd, 0x201e, 0x2026, 0x2020, 0x2021,
+	0xfffd, 0x2030, 0xfffd, 0x2039, 0xfffd, 0x00a8, 0x02c7, 0x00b8,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0xfffd, 0x2122, 0xfffd, 0x203a, 0xfffd, 0x00af, 0x02db, 0xfffd,
+	0x00a0, 0xfffd, 0x00a2, 0x00a3, 0x00a4, 0xfffd, 0x00a6, 0x00a7,
+	0x00d8, 0x00a9, 0x0156, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00c6,
+	0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+	0x00f8, 0x00b9, 0x0157, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00e6,
+	0x0104, 0x012e, 0x0100, 0x0106, 0x00c4, 0x00c5, 0x0118, 0x0112,
+	0x010c, 0x00c9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012a, 0x013b,
+	0x0160, 0x0143, 0x0145, 0x00d3, 0x014c, 0x00d5, 0x00d6, 0x00d7,
+	0x0172, 0x0141, 0x015a, 0x016a, 0x00dc, 0x017b, 0x017d, 0x00df,
+	0x0105, 0x012f, 0x0101, 0x0107, 0x00e4, 0x00e5, 0x0119, 0x0113,
+	0x010d, 0x00e9, 0x017a, 0x0117, 0x0123, 0x0137, 0x012b, 0x013c,
+	0x0161, 0x0144, 0x0146, 0x00f3, 0x014d, 0x00f5, 0x00f6, 0x00f7,
+	0x0173, 0x0142, 0x015b, 0x016b, 0x00fc, 0x017c, 0x017e, 0x02d9 };
+
+/* Codepage Windows 1257 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1257_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xc2, 0xa8, 0x00, 2 }, { 0xcb, 0x87, 0x00, 2 }, { 0xc2, 0xb8, 0x00, 2 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xc2, 0xaf, 0x00, 2 }, { 0xcb, 0x9b, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+	{ 0xc2, 0xa4, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xc3, 0x98, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc5, 0x96, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+	{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xc3, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc5, 0x97, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 },
+	{ 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0xae, 0x00, 2 }, { 0xc4, 0x80, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 },
+	{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc4, 0x92, 0x00, 2 },
+	{ 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc5, 0xb9, 0x00, 2 }, { 0xc4, 0x96, 0x00, 2 },
+	{ 0xc4, 0xa2, 0x00, 2 }, { 0xc4, 0xb6, 0x00, 2 }, { 0xc4, 0xaa, 0x00, 2 }, { 0xc4, 0xbb, 0x00, 2 },
+	{ 0xc5, 0xa0, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc5, 0x85, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+	{ 0xc5, 0x8c, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+	{ 0xc5, 0xb2, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 }, { 0xc5, 0x9a, 0x00, 2 }, { 0xc5, 0xaa, 0x00, 2 },
+	{ 0xc3, 0x9c, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+	{ 0xc4, 0x85, 0x00, 2 }, { 0xc4, 0xaf, 0x00, 2 }, { 0xc4, 0x81, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 },
+	{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc4, 0x93, 0x00, 2 },
+	{ 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc5, 0xba, 0x00, 2 }, { 0xc4, 0x97, 0x00, 2 },
+	{ 0xc4, 0xa3, 0x00, 2 }, { 0xc4, 0xb7, 0x00, 2 }, { 0xc4, 0xab, 0x00, 2 }, { 0xc4, 0xbc, 0x00, 2 },
+	{ 0xc5, 0xa1, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc5, 0x86, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+	{ 0xc5, 0x8d, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+	{ 0xc5, 0xb3, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 }, { 0xc5, 0x9b, 0x00, 2 }, { 0xc5, 0xab, 0x00, 2 },
+	{ 0xc3, 0xbc, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 } };
+
+/* Codepage Windows 1258 byte to UTF-16 table
+ */
+static const uint16_t libfwsi_codepage_windows_1258_utf16_table[ 256 ] = {
+	0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+	0x20ac, 0xfffd, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+	0x02c6, 0x2030, 0xfffd, 0x2039, 0x0152, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+	0x02dc, 0x2122, 0xfffd, 0x203a, 0x0153, 0xfffd, 0xfffd, 0x0178,
+	0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+	0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+	0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+	0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+	0x00c0, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+	0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x0300, 0x00cd, 0x00ce, 0x00cf,
+	0x0110, 0x00d1, 0x0309, 0x00d3, 0x00d4, 0x01a0, 0x00d6, 0x00d7,
+	0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x01af, 0x0303, 0x00df,
+	0x00e0, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+	0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x0301, 0x00ed, 0x00ee, 0x00ef,
+	0x0111, 0x00f1, 0x0323, 0x00f3, 0x00f4, 0x01a1, 0x00f6, 0x00f7,
+	0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x01b0, 0x20ab, 0x00ff };
+
+/* Codepage Windows 1258 byte to UTF-8 table
+ */
+static const uint8_t libfwsi_codepage_windows_1258_utf8_table[ 256 ][ 4 ] = {
+	{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+	{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+	{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+	{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+	{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+	{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+	{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+	{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+	{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+	{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+	{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+	{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+	{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+	{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+	{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+	{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+	{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+	{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+	{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+	{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+	{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+	{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+	{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+	{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+	{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+	{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+	{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+	{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+	{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+	{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+	{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+	{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+	{ 0xe2, 0x82, 0xac, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+	{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+	{ 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xb9, 3 },
+	{ 0xc5, 0x92, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 },
+	{ 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+	{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+	{ 0xcb, 0x9c, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xe2, 0x80, 0xba, 3 },
+	{ 0xc5, 0x93, 0x00, 2 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xef, 0xbf, 0xbd, 3 }, { 0xc5, 0xb8, 0x00, 2 },
+	{ 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+	{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+	{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+	{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+	{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+	{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+	{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+	{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+	{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc4, 0x82, 0x00, 2 },
+	{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+	{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+	{ 0xcc, 0x80, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+	{ 0xc4, 0x90, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xcc, 0x89, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+	{ 0xc3, 0x94, 0x00, 2 }, { 0xc6, 0xa0, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+	{ 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+	{ 0xc3, 0x9c, 0x00, 2 }, { 0xc6, 0xaf, 0x00, 2 }, { 0xcc, 0x83, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+	{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc4, 0x83, 0x00, 2 },
+	{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+	{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+	{ 0xcc, 0x81, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+	{ 0xc4, 0x91, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xcc, 0xa3, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+	{ 0xc3, 0xb4, 0x00, 2 }, { 0xc6, 0xa1, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+	{ 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+	{ 0xc3, 0xbc, 0x00, 2 }, { 0xc6, 0xb0, 0x00, 2 }, { 0xe2, 0x82, 0xab, 3 }, { 0xc3, 0xbf, 0x00, 2 } };
+
+/* The single byte codepages
+ */
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_ascii = {
+	LIBFWSI_CODEPAGE_ASCII,
+	libfwsi_codepage_ascii_utf16_table,
+	libfwsi_codepage_ascii_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_874 = {
+	LIBFWSI_CODEPAGE_WINDOWS_874,
+	libfwsi_codepage_windows_874_utf16_table,
+	libfwsi_codepage_windows_874_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1250 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1250,
+	libfwsi_codepage_windows_1250_utf16_table,
+	libfwsi_codepage_windows_1250_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1251 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1251,
+	libfwsi_codepage_windows_1251_utf16_table,
+	libfwsi_codepage_windows_1251_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1252 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1252,
+	libfwsi_codepage_windows_1252_utf16_table,
+	libfwsi_codepage_windows_1252_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1253 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1253,
+	libfwsi_codepage_windows_1253_utf16_table,
+	libfwsi_codepage_windows_1253_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1254 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1254,
+	libfwsi_codepage_windows_1254_utf16_table,
+	libfwsi_codepage_windows_1254_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1255 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1255,
+	libfwsi_codepage_windows_1255_utf16_table,
+	libfwsi_codepage_windows_1255_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1256 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1256,
+	libfwsi_codepage_windows_1256_utf16_table,
+	libfwsi_codepage_windows_1256_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1257 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1257,
+	libfwsi_codepage_windows_1257_utf16_table,
+	libfwsi_codepage_windows_1257_utf8_table };
+
+static const libfwsi_single_byte_codepage_t libfwsi_codepage_windows_1258 = {
+	LIBFWSI_CODEPAGE_WINDOWS_1258,
+	libfwsi_codepage_windows_1258_utf16_table,
+	libfwsi_codepage_windows_1258_utf8_table };
+
+/* Retrieves the tables of a single byte codepage
+ * Returns a pointer to the codepage tables or NULL if the codepage is not a supported single byte codepage
+ */
+const libfwsi_single_byte_codepage_t *libfwsi_codepage_tables_get_single_byte_codepage(
+                                       int codepage )
+{
+	switch( codepage )
+	{
+		case LIBFWSI_CODEPAGE_ASCII:
+			return( &libfwsi_codepage_ascii );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_874:
+			return( &libfwsi_codepage_windows_874 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1250:
+			return( &libfwsi_codepage_windows_1250 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1251:
+			return( &libfwsi_codepage_windows_1251 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1252:
+			return( &libfwsi_codepage_windows_1252 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1253:
+			return( &libfwsi_codepage_windows_1253 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1254:
+			return( &libfwsi_codepage_windows_1254 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1255:
+			return( &libfwsi_codepage_windows_1255 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1256:
+			return( &libfwsi_codepage_windows_1256 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1257:
+			return( &libfwsi_codepage_windows_1257 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_1258:
+			return( &libfwsi_codepage_windows_1258 );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Retrieves the tables of a double byte codepage
+ * Returns a pointer to the codepage tables or NULL if the codepage is not a supported double byte codepage
+ */
+const libfwsi_double_byte_codepage_t *libfwsi_codepage_tables_get_double_byte_codepage(
+                                       int codepage )
+{
+	switch( codepage )
+	{
+		case LIBFWSI_CODEPAGE_WINDOWS_932:
+			return( &libfwsi_codepage_windows_932 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_936:
+			return( &libfwsi_codepage_windows_936 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_949:
+			return( &libfwsi_codepage_windows_949 );
+
+		case LIBFWSI_CODEPAGE_WINDOWS_950:
+			return( &libfwsi_codepage_windows_950 );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
@@ -0,0 +1,87 @@
+/*
+ * Codepage tables
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_CODEPAGE_TABLES_H )
+#define _LIBFWSI_CODEPAGE_TABLES_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_single_byte_codepage libfwsi_single_byte_codepage_t;
+
+struct libfwsi_single_byte_codepage
+{
+	/* The codepage
+	 */
+	int codepage;
+
+	/* The byte to UTF-16 table
+	 */
+	const uint16_t *utf16_table;
+
+	/* The byte to UTF-8 table
+	 * Every entry contains up to 3 UTF-8 bytes followed by the number of bytes
+	 */
+	const uint8_t (*utf8_table)[ 4 ];
+};
+
+typedef struct libfwsi_double_byte_codepage libfwsi_double_byte_codepage_t;
+
+struct libfwsi_double_byte_codepage
+{
+	/* The codepage
+	 */
+	int codepage;
+
+	/* The single byte to UTF-16 table
+	 */
+	const uint16_t *utf16_table;
+
+	/* The lead byte table
+	 * Every entry contains the row number + 1 of a lead byte,
+	 * LIBFWSI_CODEPAGE_TABLES_LEAD_BYTE_WITHOUT_ROW or 0 if not a lead byte
+	 */
+	const uint8_t *lead_byte_table;
+
+	/* The double byte to UTF-16 rows
+	 * Every row contains the characters of the trail bytes 0x40 - 0xfe
+	 */
+	const uint16_t (*rows)[ 191 ];
+};
+
+#define LIBFWSI_CODEPAGE_TABLES_LEAD_BYTE_WITHOUT_ROW	255
+
+const libfwsi_single_byte_codepage_t *libfwsi_codepage_tables_get_single_byte_codepage(
+                                       int codepage );
+
+const libfwsi_double_byte_codepage_t *libfwsi_codepage_tables_get_double_byte_codepage(
+                                       int codepage );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_CODEPAGE_TABLES_H ) */
+
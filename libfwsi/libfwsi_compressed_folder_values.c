@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_compressed_folder_values.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
@@ -136,6 +137,8 @@ int libfwsi_compressed_folder_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER )
+
 /* Reads the compressed folder values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -507,3 +510,5 @@ int libfwsi_compressed_folder_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER ) */
+
@@ -48,12 +48,16 @@ int libfwsi_compressed_folder_values_free(
      libfwsi_compressed_folder_values_t **compressed_folder_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER )
+
 int libfwsi_compressed_folder_values_read_data(
      libfwsi_compressed_folder_values_t *compressed_folder_values,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_control_panel_category_values.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_libcerror.h"
@@ -132,6 +133,8 @@ int libfwsi_control_panel_category_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CATEGORY_PARSER )
+
 /* Reads the control panel category values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -232,3 +235,5 @@ int libfwsi_control_panel_category_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CATEGORY_PARSER ) */
+
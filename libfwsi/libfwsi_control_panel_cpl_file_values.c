@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_control_panel_cpl_file_values.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_libcerror.h"
@@ -133,6 +134,8 @@ int libfwsi_control_panel_cpl_file_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER )
+
 /* Reads the control panel CPL file values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -389,3 +392,5 @@ int libfwsi_control_panel_cpl_file_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER ) */
+
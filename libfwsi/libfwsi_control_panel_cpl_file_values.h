@@ -48,12 +48,16 @@ int libfwsi_control_panel_cpl_file_values_free(
      libfwsi_control_panel_cpl_file_values_t **control_panel_cpl_file_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER )
+
 int libfwsi_control_panel_cpl_file_values_read_data(
      libfwsi_control_panel_cpl_file_values_t *control_panel_cpl_file_values,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_control_panel_identifier.h"
 #include "libfwsi_control_panel_values.h"
 #include "libfwsi_debug.h"
@@ -134,6 +135,8 @@ int libfwsi_control_panel_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER )
+
 /* Reads the control panel values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -237,3 +240,5 @@ int libfwsi_control_panel_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER ) */
+
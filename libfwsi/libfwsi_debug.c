@@ -26,6 +26,7 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
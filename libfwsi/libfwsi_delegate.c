@@ -0,0 +1,194 @@
+/*
+ * Delegate (shell item) functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_definitions.h"
+#include "libfwsi_delegate.h"
+#include "libfwsi_delegate_values.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+
+/* Retrieves the class identifier
+ * The identifier is a GUID and is 16 bytes of size
+ * The class identifier identifies the shell folder of the embedded item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_delegate_get_class_identifier(
+     libfwsi_item_t *item,
+     uint8_t *class_identifier,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item     = NULL;
+	libfwsi_delegate_values_t *delegate_values = NULL;
+	static char *function                      = "libfwsi_delegate_get_class_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_DELEGATE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	delegate_values = (libfwsi_delegate_values_t *) internal_item->value;
+
+	if( class_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid class identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: class identifier too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     class_identifier,
+	     delegate_values->class_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy class identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the embedded item
+ * The embedded item is managed by the delegate item and is freed together with it,
+ * use libfwsi_item_retain to keep the embedded item after the delegate item is freed
+ * and libfwsi_item_release to release it
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_delegate_get_embedded_item(
+     libfwsi_item_t *item,
+     libfwsi_item_t **embedded_item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item     = NULL;
+	libfwsi_delegate_values_t *delegate_values = NULL;
+	static char *function                      = "libfwsi_delegate_get_embedded_item";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_DELEGATE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	delegate_values = (libfwsi_delegate_values_t *) internal_item->value;
+
+	if( embedded_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid embedded item.",
+		 function );
+
+		return( -1 );
+	}
+	if( delegate_values->embedded_item == NULL )
+	{
+		return( 0 );
+	}
+	*embedded_item = delegate_values->embedded_item;
+
+	return( 1 );
+}
+
@@ -0,0 +1,54 @@
+/*
+ * Delegate (shell item) functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_DELEGATE_H )
+#define _LIBFWSI_DELEGATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBFWSI_EXTERN \
+int libfwsi_delegate_get_class_identifier(
+     libfwsi_item_t *item,
+     uint8_t *class_identifier,
+     size_t size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_delegate_get_embedded_item(
+     libfwsi_item_t *item,
+     libfwsi_item_t **embedded_item,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_DELEGATE_H ) */
+
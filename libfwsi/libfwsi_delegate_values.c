@@ -24,9 +24,11 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_delegate_values.h"
+#include "libfwsi_item.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libfguid.h"
@@ -117,6 +119,7 @@ int libfwsi_delegate_values_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfwsi_delegate_values_free";
+	int result            = 1;
 
 	if( delegate_values == NULL )
 	{
@@ -131,26 +134,50 @@ int libfwsi_delegate_values_free(
 	}
 	if( *delegate_values != NULL )
 	{
+		if( ( *delegate_values )->embedded_item != NULL )
+		{
+			if( libfwsi_item_release(
+			     &( ( *delegate_values )->embedded_item ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release embedded item.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *delegate_values );
 
 		*delegate_values = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
+#if !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER )
+
 /* Reads the delegate values
+ * The embedded item is read with the same codepage and parse options
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
 int libfwsi_delegate_values_read_data(
      libfwsi_delegate_values_t *delegate_values,
      const uint8_t *data,
      size_t data_size,
+     int ascii_codepage,
+     libfwsi_internal_parse_options_t *parse_options,
      libcerror_error_t **error )
 {
-	static char *function   = "libfwsi_delegate_values_read_data";
-	size_t data_offset      = 0;
-	uint16_t item_data_size = 0;
+	libcerror_error_t *copy_error    = NULL;
+	uint8_t *embedded_item_data      = NULL;
+	static char *function            = "libfwsi_delegate_values_read_data";
+	size_t data_offset               = 0;
+	uint16_t embedded_item_data_size = 0;
+	uint16_t item_data_size          = 0;
 
 	if( delegate_values == NULL )
 	{
@@ -163,6 +190,17 @@ int libfwsi_delegate_values_read_data(
 
 		return( -1 );
 	}
+	if( delegate_values->embedded_item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid delegate values - embedded item value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -200,7 +238,7 @@ int libfwsi_delegate_values_read_data(
 	{
 		return( 0 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
+	byte_stream_copy_to_uint16_little_endian(
 	 &( data[ 4 ] ),
 	 item_data_size );
 
@@ -227,7 +265,7 @@ int libfwsi_delegate_values_read_data(
 
 	if( item_data_size > 0 )
 	{
-		if( item_data_size > ( data_size - 32 ) )
+		if( item_data_size > ( data_size - 38 ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -308,8 +346,157 @@ int libfwsi_delegate_values_read_data(
 		 "\n" );
 	}
 #endif
+	if( memory_copy(
+	     delegate_values->class_identifier,
+	     &( data[ data_offset ] ),
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy class identifier.",
+		 function );
+
+		goto on_error;
+	}
 	data_offset += 16;
 
+	/* The delegate item data contains the embedded item without its first 4 bytes,
+	 * which are the same as those of the delegate item except for the size.
+	 * A nested delegate item is not read to prevent unbounded recursion.
+	 */
+	if( ( item_data_size >= 2 )
+	 && ( ( item_data_size < 34 )
+	  || ( memory_compare(
+	        &( data[ 6 + item_data_size - 32 ] ),
+	        libfwsi_delegate_item_identifier,
+	        16 ) != 0 ) ) )
+	{
+		embedded_item_data_size = 4 + item_data_size;
+
+		embedded_item_data = (uint8_t *) memory_allocate(
+		                                  sizeof( uint8_t ) * embedded_item_data_size );
+
+		if( embedded_item_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create embedded item data.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 embedded_item_data,
+		 embedded_item_data_size );
+
+		embedded_item_data[ 2 ] = data[ 2 ];
+		embedded_item_data[ 3 ] = data[ 3 ];
+
+		if( memory_copy(
+		     &( embedded_item_data[ 4 ] ),
+		     &( data[ 6 ] ),
+		     (size_t) item_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy embedded item data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwsi_internal_item_initialize(
+		     (libfwsi_internal_item_t **) &( delegate_values->embedded_item ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create embedded item.",
+			 function );
+
+			goto on_error;
+		}
+		/* The embedded item is released together with the delegate values
+		 */
+		( (libfwsi_internal_item_t *) delegate_values->embedded_item )->is_managed = 1;
+
+		if( libfwsi_internal_item_copy_from_byte_stream(
+		     delegate_values->embedded_item,
+		     embedded_item_data,
+		     (size_t) embedded_item_data_size,
+		     ascii_codepage,
+		     parse_options,
+		     &copy_error ) != 1 )
+		{
+			/* An embedded item that cannot be read does not fail the delegate item,
+			 * only an exceeded limit or the failure to allocate memory is an error
+			 */
+			if( ( parse_options != NULL )
+			 && ( parse_options->limit_exceeded != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: unable to copy byte stream to embedded item.",
+				 function );
+
+				goto on_error;
+			}
+			else if( libcerror_error_matches(
+			          copy_error,
+			          LIBCERROR_ERROR_DOMAIN_MEMORY,
+			          LIBCERROR_MEMORY_ERROR_INSUFFICIENT ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to copy byte stream to embedded item.",
+				 function );
+
+				goto on_error;
+			}
+			libcerror_error_free(
+			 &copy_error );
+
+			libfwsi_item_release(
+			 &( delegate_values->embedded_item ),
+			 NULL );
+		}
+		memory_free(
+		 embedded_item_data );
+
+		embedded_item_data = NULL;
+	}
 	return( 1 );
+
+on_error:
+	if( copy_error != NULL )
+	{
+		libcerror_error_free(
+		 &copy_error );
+	}
+	if( delegate_values->embedded_item != NULL )
+	{
+		libfwsi_item_release(
+		 &( delegate_values->embedded_item ),
+		 NULL );
+	}
+	if( embedded_item_data != NULL )
+	{
+		memory_free(
+		 embedded_item_data );
+	}
+	return( -1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER ) */
+
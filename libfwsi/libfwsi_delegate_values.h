@@ -26,6 +26,8 @@
 #include <types.h>
 
 #include "libfwsi_libcerror.h"
+#include "libfwsi_parse_options.h"
+#include "libfwsi_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -37,9 +39,13 @@ typedef struct libfwsi_delegate_values libfwsi_delegate_values_t;
 
 struct libfwsi_delegate_values
 {
-	/* Dummy
+	/* The (item) class identifier, which identifies the shell folder of the embedded item
 	 */
-	int dummy;
+	uint8_t class_identifier[ 16 ];
+
+	/* The embedded item
+	 */
+	libfwsi_item_t *embedded_item;
 };
 
 int libfwsi_delegate_values_initialize(
@@ -50,12 +56,18 @@ int libfwsi_delegate_values_free(
      libfwsi_delegate_values_t **delegate_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER )
+
 int libfwsi_delegate_values_read_data(
      libfwsi_delegate_values_t *delegate_values,
      const uint8_t *data,
      size_t data_size,
+     int ascii_codepage,
+     libfwsi_internal_parse_options_t *parse_options,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
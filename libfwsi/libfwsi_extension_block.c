@@ -24,22 +24,15 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_extension_block.h"
-#include "libfwsi_extension_block_0xbeef0000_values.h"
-#include "libfwsi_extension_block_0xbeef0001_values.h"
-#include "libfwsi_extension_block_0xbeef0003_values.h"
-#include "libfwsi_extension_block_0xbeef0005_values.h"
-#include "libfwsi_extension_block_0xbeef0006_values.h"
-#include "libfwsi_extension_block_0xbeef000a_values.h"
-#include "libfwsi_extension_block_0xbeef0013_values.h"
-#include "libfwsi_extension_block_0xbeef0014_values.h"
-#include "libfwsi_extension_block_0xbeef0019_values.h"
-#include "libfwsi_extension_block_0xbeef0025_values.h"
+#include "libfwsi_extension_block_registry.h"
 #include "libfwsi_file_entry_extension_values.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_types.h"
+#include "libfwsi_values_type.h"
 
 /* Creates an extension block
  * Make sure the value extension_block is referencing, is set to NULL
@@ -102,6 +95,9 @@ int libfwsi_extension_block_initialize(
 
 		goto on_error;
 	}
+	libfwsi_reference_count_initialize(
+	 &( internal_extension_block->reference_count ) );
+
 	*extension_block = (libfwsi_extension_block_t *) internal_extension_block;
 
 	return( 1 );
@@ -115,7 +111,41 @@ on_error:
 	return( -1 );
 }
 
+/* Adds a reference to an extension block
+ * The extension block remains available until every reference is released
+ * with libfwsi_extension_block_release, also after the item it was read from is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_extension_block_retain(
+     libfwsi_extension_block_t *extension_block,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_extension_block_retain";
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	libfwsi_reference_count_increment(
+	 &( internal_extension_block->reference_count ) );
+
+	return( 1 );
+}
+
 /* Frees an extension block
+ * An extension block is managed by the item it was read from, hence only the value
+ * extension_block is referencing is cleared. Use libfwsi_extension_block_release
+ * to release a reference that was added with libfwsi_extension_block_retain
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_extension_block_free(
@@ -142,7 +172,56 @@ int libfwsi_extension_block_free(
 	return( 1 );
 }
 
-/* Frees an extension block
+/* Releases a reference to an extension block
+ * The extension block is freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_extension_block_release(
+     libfwsi_extension_block_t **extension_block,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_extension_block_release";
+	int result                                                   = 1;
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extension_block != NULL )
+	{
+		internal_extension_block = (libfwsi_internal_extension_block_t *) *extension_block;
+		*extension_block         = NULL;
+
+		if( libfwsi_reference_count_decrement(
+		     &( internal_extension_block->reference_count ) ) == 0 )
+		{
+			if( libfwsi_internal_extension_block_free(
+			     &internal_extension_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extension block.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Frees an extension block regardless of its reference count
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_internal_extension_block_free(
@@ -202,14 +281,15 @@ int libfwsi_extension_block_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error )
 {
-	static char *function     = "libfwsi_extension_block_copy_from_byte_stream";
-	size_t byte_stream_offset = 0;
-	uint32_t signature        = 0;
-	uint16_t data_size        = 0;
-	int result                = 0;
+	const libfwsi_extension_block_handler_t *handler = NULL;
+	static char *function                            = "libfwsi_extension_block_copy_from_byte_stream";
+	size_t byte_stream_offset                        = 0;
+	uint32_t signature                               = 0;
+	uint16_t data_size                               = 0;
+	int result                                       = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint16_t value_16bit      = 0;
+	uint16_t value_16bit                             = 0;
 #endif
 
 	if( internal_extension_block == NULL )
@@ -314,131 +394,53 @@ int libfwsi_extension_block_copy_from_byte_stream(
 	internal_extension_block->data_size = data_size;
 	internal_extension_block->signature = signature;
 
-	switch( internal_extension_block->signature )
+	if( libfwsi_extension_block_registry_get_handler(
+	     internal_extension_block->signature,
+	     &handler,
+	     error ) != 1 )
 	{
-		case 0xbeef0000UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0000_values_free;
-
-			if( libfwsi_extension_block_0xbeef0000_values_initialize(
-			     (libfwsi_extension_block_0xbeef0000_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0000 values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef0000_values_read_data(
-			          (libfwsi_extension_block_0xbeef0000_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0000 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef0001UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0001_values_free;
-
-			if( libfwsi_extension_block_0xbeef0001_values_initialize(
-			     (libfwsi_extension_block_0xbeef0001_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0001 values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef0001_values_read_data(
-			          (libfwsi_extension_block_0xbeef0001_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0001 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef0003UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0003_values_free;
-
-			if( libfwsi_extension_block_0xbeef0003_values_initialize(
-			     (libfwsi_extension_block_0xbeef0003_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0003 values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef0003_values_read_data(
-			          (libfwsi_extension_block_0xbeef0003_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0003 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handler of extension block 0x%08" PRIx32 ".",
+		 function,
+		 internal_extension_block->signature );
 
-		case 0xbeef0004UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_extension_values_free;
+		goto on_error;
+	}
+	if( handler != NULL )
+	{
+		if( ( handler->flags & LIBFWSI_EXTENSION_BLOCK_HANDLER_FLAG_USER_DEFINED ) != 0 )
+		{
+			internal_extension_block->is_user_defined = 1;
+		}
+		if( handler->read_values == NULL )
+		{
+			internal_extension_block->is_skipped = 1;
+		}
+		else
+		{
+			internal_extension_block->free_value  = handler->free_values;
+			internal_extension_block->value_size  = handler->values_size;
+			internal_extension_block->values_type = handler->values_type;
 
-			if( libfwsi_file_entry_extension_values_initialize(
-			     (libfwsi_file_entry_extension_values_t **) &( internal_extension_block->value ),
+			if( handler->initialize_values(
+			     &( internal_extension_block->value ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create file entry extension values.",
-				 function );
+				 "%s: unable to create extension block 0x%08" PRIx32 " values.",
+				 function,
+				 internal_extension_block->signature );
 
 				goto on_error;
 			}
-			result = libfwsi_file_entry_extension_values_read_data(
-			          (libfwsi_file_entry_extension_values_t *) internal_extension_block->value,
+			result = handler->read_values(
+			          internal_extension_block->value,
 			          byte_stream,
 			          internal_extension_block->data_size,
 			          ascii_codepage,
@@ -450,260 +452,13 @@ int libfwsi_extension_block_copy_from_byte_stream(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to file entry extension values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef0005UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0005_values_free;
-
-			if( libfwsi_extension_block_0xbeef0005_values_initialize(
-			     (libfwsi_extension_block_0xbeef0005_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0005 values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef0005_values_read_data(
-			          (libfwsi_extension_block_0xbeef0005_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0005 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef0006UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0006_values_free;
-
-			if( libfwsi_extension_block_0xbeef0006_values_initialize(
-			     (libfwsi_extension_block_0xbeef0006_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0006 values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef0006_values_read_data(
-			          (libfwsi_extension_block_0xbeef0006_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0006 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef000aUL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef000a_values_free;
-
-			if( libfwsi_extension_block_0xbeef000a_values_initialize(
-			     (libfwsi_extension_block_0xbeef000a_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef000a values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef000a_values_read_data(
-			          (libfwsi_extension_block_0xbeef000a_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef000a values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef0013UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0013_values_free;
-
-			if( libfwsi_extension_block_0xbeef0013_values_initialize(
-			     (libfwsi_extension_block_0xbeef0013_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0013 values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef0013_values_read_data(
-			          (libfwsi_extension_block_0xbeef0013_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0013 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef0014UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0014_values_free;
-
-			if( libfwsi_extension_block_0xbeef0014_values_initialize(
-			     (libfwsi_extension_block_0xbeef0014_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0014 values.",
-				 function );
+				 "%s: unable to copy byte stream to extension block 0x%08" PRIx32 " values.",
+				 function,
+				 internal_extension_block->signature );
 
 				goto on_error;
 			}
-			result = libfwsi_extension_block_0xbeef0014_values_read_data(
-			          (libfwsi_extension_block_0xbeef0014_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0014 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef0019UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0019_values_free;
-
-			if( libfwsi_extension_block_0xbeef0019_values_initialize(
-			     (libfwsi_extension_block_0xbeef0019_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0019 values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef0019_values_read_data(
-			          (libfwsi_extension_block_0xbeef0019_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0019 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case 0xbeef0025UL:
-			internal_extension_block->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0025_values_free;
-
-			if( libfwsi_extension_block_0xbeef0025_values_initialize(
-			     (libfwsi_extension_block_0xbeef0025_values_t **) &( internal_extension_block->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block 0xbeef0025 values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_extension_block_0xbeef0025_values_read_data(
-			          (libfwsi_extension_block_0xbeef0025_values_t *) internal_extension_block->value,
-			          byte_stream,
-			          internal_extension_block->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block 0xbeef0025 values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		default:
-			break;
+		}
 	}
 	if( result == 0 )
 	{
@@ -773,6 +528,67 @@ on_error:
 	return( -1 );
 }
 
+/* Validates a shell extension block in a byte stream without copying it
+ * Applies the same bounds checks as libfwsi_extension_block_copy_from_byte_stream
+ * Returns 1 if valid, 0 if not supported or -1 if invalid
+ */
+int libfwsi_extension_block_validate_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint16_t *data_size )
+{
+	uint32_t signature      = 0;
+	uint16_t safe_data_size = 0;
+
+	if( byte_stream_size < 2 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 byte_stream,
+	 safe_data_size );
+
+	if( safe_data_size == 0 )
+	{
+		*data_size = 2;
+
+		return( 1 );
+	}
+	if( safe_data_size < 10 )
+	{
+		return( 0 );
+	}
+	if( (size_t) safe_data_size > byte_stream_size )
+	{
+		/* The signature is only checked if it lies within the byte stream
+		 */
+		if( byte_stream_size < 8 )
+		{
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ 4 ] ),
+		 signature );
+
+		if( ( signature >> 16 ) != 0xbeef )
+		{
+			return( 0 );
+		}
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 signature );
+
+	if( ( signature >> 16 ) != 0xbeef )
+	{
+		return( 0 );
+	}
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the signature
  * Returns 1 if successful or -1 on error
  */
@@ -853,3 +669,114 @@ int libfwsi_extension_block_get_data_size(
 	return( 1 );
 }
 
+/* Retrieves the values of an extension block read by a registered handler
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_extension_block_get_user_defined_values(
+     libfwsi_extension_block_t *extension_block,
+     intptr_t **values,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	static char *function                                        = "libfwsi_extension_block_get_user_defined_values";
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->is_user_defined == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	*values = internal_extension_block->value;
+
+	return( 1 );
+}
+
+/* Retrieves the memory usage of an extension block
+ * This includes the extension block, the extension block value and its strings
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_extension_block_get_memory_usage(
+     libfwsi_internal_extension_block_t *internal_extension_block,
+     size_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_internal_extension_block_get_memory_usage";
+	size_t safe_memory_usage                                           = 0;
+
+	if( internal_extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage = sizeof( libfwsi_internal_extension_block_t );
+
+	if( internal_extension_block->value != NULL )
+	{
+		safe_memory_usage += internal_extension_block->value_size;
+
+		if( internal_extension_block->values_type == LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
+		{
+			file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+			if( file_entry_extension_values->long_name != NULL )
+			{
+				safe_memory_usage += file_entry_extension_values->long_name_size;
+			}
+			if( file_entry_extension_values->localized_name != NULL )
+			{
+				safe_memory_usage += file_entry_extension_values->localized_name_size;
+			}
+		}
+	}
+	*memory_usage = safe_memory_usage;
+
+	return( 1 );
+}
+
@@ -27,6 +27,7 @@
 
 #include "libfwsi_libcerror.h"
 #include "libfwsi_extern.h"
+#include "libfwsi_reference_count.h"
 #include "libfwsi_types.h"
 
 #if defined( __cplusplus )
@@ -53,22 +54,52 @@ struct libfwsi_internal_extension_block
 	 */
         intptr_t *value;
 
+	/* The size of the value structure
+	 */
+	size_t value_size;
+
 	/* The extension block free value function
 	 */
 	int (*free_value)(
 	       intptr_t **value,
 	       libcerror_error_t **error );
+
+	/* The values type of the extension block value
+	 */
+	int values_type;
+
+	/* Value to indicate the extension block was read by a registered handler
+	 */
+	uint8_t is_user_defined;
+
+	/* Value to indicate the extension block is skipped
+	 */
+	uint8_t is_skipped;
+
+	/* The reference count
+	 */
+	libfwsi_reference_count_t reference_count;
 };
 
 int libfwsi_extension_block_initialize(
      libfwsi_extension_block_t **extension_block,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_extension_block_retain(
+     libfwsi_extension_block_t *extension_block,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_extension_block_free(
      libfwsi_extension_block_t **extension_block,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_extension_block_release(
+     libfwsi_extension_block_t **extension_block,
+     libcerror_error_t **error );
+
 int libfwsi_internal_extension_block_free(
      libfwsi_internal_extension_block_t **internal_extension_block,
      libcerror_error_t **error );
@@ -80,6 +111,11 @@ int libfwsi_extension_block_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwsi_extension_block_validate_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint16_t *data_size );
+
 LIBFWSI_EXTERN \
 int libfwsi_extension_block_get_signature(
      libfwsi_extension_block_t *extension_block,
@@ -92,6 +128,17 @@ int libfwsi_extension_block_get_data_size(
      size_t *data_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_extension_block_get_user_defined_values(
+     libfwsi_extension_block_t *extension_block,
+     intptr_t **values,
+     libcerror_error_t **error );
+
+int libfwsi_internal_extension_block_get_memory_usage(
+     libfwsi_internal_extension_block_t *internal_extension_block,
+     size_t *memory_usage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_extension_block_0xbeef0005_values.h"
 #include "libfwsi_libcerror.h"
@@ -132,6 +133,8 @@ int libfwsi_extension_block_0xbeef0005_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0005_PARSER )
+
 /* Reads the extension block 0xbeef0005 values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -210,3 +213,5 @@ int libfwsi_extension_block_0xbeef0005_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0005_PARSER ) */
+
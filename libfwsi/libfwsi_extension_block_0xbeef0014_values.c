@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_extension_block_0xbeef0014_values.h"
@@ -137,6 +138,8 @@ int libfwsi_extension_block_0xbeef0014_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER )
+
 /* Reads the extension block 0xbeef0014 values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -390,3 +393,5 @@ int libfwsi_extension_block_0xbeef0014_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER ) */
+
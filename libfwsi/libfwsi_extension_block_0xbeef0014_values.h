@@ -49,12 +49,16 @@ int libfwsi_extension_block_0xbeef0014_values_free(
      libfwsi_extension_block_0xbeef0014_values_t **extension_block_0xbeef0014_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER )
+
 int libfwsi_extension_block_0xbeef0014_values_read_data(
      libfwsi_extension_block_0xbeef0014_values_t *extension_block_0xbeef0014_values,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_extension_block_0xbeef0019_values.h"
@@ -134,6 +135,8 @@ int libfwsi_extension_block_0xbeef0019_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0019_PARSER )
+
 /* Reads the extension block 0xbeef0019 values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -241,3 +244,5 @@ int libfwsi_extension_block_0xbeef0019_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0019_PARSER ) */
+
@@ -0,0 +1,846 @@
+/*
+ * Extension block registry functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_extension_block_0xbeef0000_values.h"
+#include "libfwsi_extension_block_0xbeef0001_values.h"
+#include "libfwsi_extension_block_0xbeef0003_values.h"
+#include "libfwsi_extension_block_0xbeef0005_values.h"
+#include "libfwsi_extension_block_0xbeef0006_values.h"
+#include "libfwsi_extension_block_0xbeef000a_values.h"
+#include "libfwsi_extension_block_0xbeef0013_values.h"
+#include "libfwsi_extension_block_0xbeef0014_values.h"
+#include "libfwsi_extension_block_0xbeef0019_values.h"
+#include "libfwsi_extension_block_0xbeef0025_values.h"
+#include "libfwsi_extension_block_registry.h"
+#include "libfwsi_file_entry_extension_values.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_unused.h"
+#include "libfwsi_values_type.h"
+
+/* The built-in handlers
+ */
+const libfwsi_extension_block_handler_t libfwsi_extension_block_registry_built_in_handlers[ 11 ] = {
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0000_PARSER )
+	{ 0xbeef0000UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0000,
+	  sizeof( libfwsi_extension_block_0xbeef0000_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0000_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0000_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0000_values_free },
+#else
+	{ 0xbeef0000UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0001_PARSER )
+	{ 0xbeef0001UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0001,
+	  sizeof( libfwsi_extension_block_0xbeef0001_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0001_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0001_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0001_values_free },
+#else
+	{ 0xbeef0001UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0003_PARSER )
+	{ 0xbeef0003UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0003,
+	  sizeof( libfwsi_extension_block_0xbeef0003_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0003_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0003_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0003_values_free },
+#else
+	{ 0xbeef0003UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+	{ 0xbeef0004UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION,
+	  sizeof( libfwsi_file_entry_extension_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_extension_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0004_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_extension_values_free },
+#else
+	{ 0xbeef0004UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0005_PARSER )
+	{ 0xbeef0005UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0005,
+	  sizeof( libfwsi_extension_block_0xbeef0005_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0005_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0005_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0005_values_free },
+#else
+	{ 0xbeef0005UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0006_PARSER )
+	{ 0xbeef0006UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0006,
+	  sizeof( libfwsi_extension_block_0xbeef0006_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0006_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0006_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0006_values_free },
+#else
+	{ 0xbeef0006UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF000A_PARSER )
+	{ 0xbeef000aUL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF000A,
+	  sizeof( libfwsi_extension_block_0xbeef000a_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef000a_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef000a_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef000a_values_free },
+#else
+	{ 0xbeef000aUL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER )
+	{ 0xbeef0013UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0013,
+	  sizeof( libfwsi_extension_block_0xbeef0013_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0013_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0013_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0013_values_free },
+#else
+	{ 0xbeef0013UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER )
+	{ 0xbeef0014UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0014,
+	  sizeof( libfwsi_extension_block_0xbeef0014_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0014_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0014_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0014_values_free },
+#else
+	{ 0xbeef0014UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0019_PARSER )
+	{ 0xbeef0019UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0019,
+	  sizeof( libfwsi_extension_block_0xbeef0019_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0019_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0019_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0019_values_free },
+#else
+	{ 0xbeef0019UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0025_PARSER )
+	{ 0xbeef0025UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0025,
+	  sizeof( libfwsi_extension_block_0xbeef0025_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0025_values_initialize,
+	  &libfwsi_extension_block_registry_read_0xbeef0025_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_extension_block_0xbeef0025_values_free }
+#else
+	{ 0xbeef0025UL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL }
+#endif
+};
+
+/* The built-in handlers indexed by the lower 16 bits of the signature
+ */
+const libfwsi_extension_block_handler_t *libfwsi_extension_block_registry_built_in_handlers_table[ LIBFWSI_EXTENSION_BLOCK_REGISTRY_NUMBER_OF_HANDLERS ] = {
+	/* 0x00 - 0x03 */
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0000_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 0 ] ),
+#else
+	NULL,
+#endif
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0001_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 1 ] ),
+#else
+	NULL,
+#endif
+	NULL,
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0003_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 2 ] ),
+#else
+	NULL,
+#endif
+	/* 0x04 - 0x07 */
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 3 ] ),
+#else
+	NULL,
+#endif
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0005_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 4 ] ),
+#else
+	NULL,
+#endif
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0006_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 5 ] ),
+#else
+	NULL,
+#endif
+	NULL,
+	/* 0x08 - 0x0b */
+	NULL,
+	NULL,
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF000A_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 6 ] ),
+#else
+	NULL,
+#endif
+	NULL,
+	/* 0x0c - 0x0f */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	/* 0x10 - 0x13 */
+	NULL,
+	NULL,
+	NULL,
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 7 ] ),
+#else
+	NULL,
+#endif
+	/* 0x14 - 0x17 */
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 8 ] ),
+#else
+	NULL,
+#endif
+	NULL,
+	NULL,
+	NULL,
+	/* 0x18 - 0x1b */
+	NULL,
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0019_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 9 ] ),
+#else
+	NULL,
+#endif
+	NULL,
+	NULL,
+	/* 0x1c - 0x1f */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	/* 0x20 - 0x23 */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	/* 0x24 - 0x27 */
+	NULL,
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0025_PARSER )
+	&( libfwsi_extension_block_registry_built_in_handlers[ 10 ] ),
+#else
+	NULL,
+#endif
+	NULL,
+	NULL,
+	/* 0x28 - 0x2b */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	/* 0x2c - 0x2f */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	/* 0x30 - 0x33 */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	/* 0x34 - 0x37 */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	/* 0x38 - 0x3b */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	/* 0x3c - 0x3f */
+	NULL,
+	NULL,
+	NULL,
+	NULL };
+
+/* The registered handlers indexed by the lower 16 bits of the signature
+ */
+static libfwsi_extension_block_handler_t libfwsi_extension_block_registry_registered_handlers[ LIBFWSI_EXTENSION_BLOCK_REGISTRY_NUMBER_OF_HANDLERS ];
+
+/* Registers an extension block handler
+ * The signature must be of the form 0xbeefXXXX, without a built-in handler and
+ * the lower 16 bits must be less than LIBFWSI_EXTENSION_BLOCK_REGISTRY_NUMBER_OF_HANDLERS
+ * The initialize, read and free functions must either all be set or all be NULL,
+ * where NULL indicates extension blocks with the signature are skipped
+ * The read function returns 1 if successful, 0 if not supported or -1 on error
+ * The handlers must not be changed while items are being read
+ * and are not protected against concurrent modification
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_register_extension_block_handler(
+     uint32_t signature,
+     size_t values_size,
+     int (*initialize_function)(
+            intptr_t **values,
+            libcerror_error_t **error ),
+     int (*read_function)(
+            intptr_t *values,
+            const uint8_t *data,
+            size_t data_size,
+            int ascii_codepage,
+            libcerror_error_t **error ),
+     int (*free_function)(
+            intptr_t **values,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libfwsi_extension_block_handler_t *handler = NULL;
+	static char *function                      = "libfwsi_register_extension_block_handler";
+	uint16_t handler_index                     = 0;
+
+	if( ( signature >> 16 ) != 0xbeef )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature: 0x%08" PRIx32 ".",
+		 function,
+		 signature );
+
+		return( -1 );
+	}
+	handler_index = (uint16_t) ( signature & 0x0000ffffUL );
+
+	if( handler_index >= LIBFWSI_EXTENSION_BLOCK_REGISTRY_NUMBER_OF_HANDLERS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid signature: 0x%08" PRIx32 " value out of bounds.",
+		 function,
+		 signature );
+
+		return( -1 );
+	}
+	if( values_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid values size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( initialize_function != NULL )
+	 || ( read_function != NULL )
+	 || ( free_function != NULL ) )
+	{
+		if( initialize_function == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid initialize function.",
+			 function );
+
+			return( -1 );
+		}
+		if( read_function == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid read function.",
+			 function );
+
+			return( -1 );
+		}
+		if( free_function == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid free function.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( libfwsi_extension_block_registry_built_in_handlers_table[ handler_index ] != NULL )
+	 || ( libfwsi_extension_block_registry_registered_handlers[ handler_index ].signature != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handler for signature: 0x%08" PRIx32 " value already set.",
+		 function,
+		 signature );
+
+		return( -1 );
+	}
+	handler = &( libfwsi_extension_block_registry_registered_handlers[ handler_index ] );
+
+	handler->signature         = signature;
+	handler->flags             = LIBFWSI_EXTENSION_BLOCK_HANDLER_FLAG_USER_DEFINED;
+	handler->values_type       = LIBFWSI_VALUES_TYPE_USER_DEFINED;
+	handler->values_size       = values_size;
+	handler->initialize_values = initialize_function;
+	handler->read_values       = read_function;
+	handler->free_values       = free_function;
+
+	return( 1 );
+}
+
+/* Unregisters an extension block handler
+ * Extension blocks read by the handler must be freed before the handler is unregistered
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_unregister_extension_block_handler(
+     uint32_t signature,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_unregister_extension_block_handler";
+	uint16_t handler_index = 0;
+
+	handler_index = (uint16_t) ( signature & 0x0000ffffUL );
+
+	if( ( ( signature >> 16 ) != 0xbeef )
+	 || ( handler_index >= LIBFWSI_EXTENSION_BLOCK_REGISTRY_NUMBER_OF_HANDLERS )
+	 || ( libfwsi_extension_block_registry_registered_handlers[ handler_index ].signature != signature ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature: 0x%08" PRIx32 " no handler registered.",
+		 function,
+		 signature );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( libfwsi_extension_block_registry_registered_handlers[ handler_index ] ),
+	     0,
+	     sizeof( libfwsi_extension_block_handler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear handler.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the handler of an extension block signature
+ * The handler is set to NULL if there is no handler for the signature
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_extension_block_registry_get_handler(
+     uint32_t signature,
+     const libfwsi_extension_block_handler_t **handler,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwsi_extension_block_registry_get_handler";
+	uint16_t handler_index = 0;
+
+	if( handler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handler.",
+		 function );
+
+		return( -1 );
+	}
+	*handler = NULL;
+
+	handler_index = (uint16_t) ( signature & 0x0000ffffUL );
+
+	if( ( ( signature >> 16 ) != 0xbeef )
+	 || ( handler_index >= LIBFWSI_EXTENSION_BLOCK_REGISTRY_NUMBER_OF_HANDLERS ) )
+	{
+		return( 1 );
+	}
+	if( libfwsi_extension_block_registry_built_in_handlers_table[ handler_index ] != NULL )
+	{
+		*handler = libfwsi_extension_block_registry_built_in_handlers_table[ handler_index ];
+	}
+	else if( libfwsi_extension_block_registry_registered_handlers[ handler_index ].signature != 0 )
+	{
+		*handler = &( libfwsi_extension_block_registry_registered_handlers[ handler_index ] );
+	}
+	return( 1 );
+}
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0000_PARSER )
+
+/* Reads extension block 0xbeef0000 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0000_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0000_values_read_data(
+	         (libfwsi_extension_block_0xbeef0000_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0000_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0001_PARSER )
+
+/* Reads extension block 0xbeef0001 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0001_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0001_values_read_data(
+	         (libfwsi_extension_block_0xbeef0001_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0001_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0003_PARSER )
+
+/* Reads extension block 0xbeef0003 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0003_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0003_values_read_data(
+	         (libfwsi_extension_block_0xbeef0003_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0003_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+/* Reads extension block 0xbeef0004 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0004_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	return( libfwsi_file_entry_extension_values_read_data(
+	         (libfwsi_file_entry_extension_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0005_PARSER )
+
+/* Reads extension block 0xbeef0005 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0005_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0005_values_read_data(
+	         (libfwsi_extension_block_0xbeef0005_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0005_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0006_PARSER )
+
+/* Reads extension block 0xbeef0006 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0006_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0006_values_read_data(
+	         (libfwsi_extension_block_0xbeef0006_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0006_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF000A_PARSER )
+
+/* Reads extension block 0xbeef000a values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef000a_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef000a_values_read_data(
+	         (libfwsi_extension_block_0xbeef000a_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF000A_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER )
+
+/* Reads extension block 0xbeef0013 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0013_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0013_values_read_data(
+	         (libfwsi_extension_block_0xbeef0013_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER )
+
+/* Reads extension block 0xbeef0014 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0014_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0014_values_read_data(
+	         (libfwsi_extension_block_0xbeef0014_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0019_PARSER )
+
+/* Reads extension block 0xbeef0019 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0019_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0019_values_read_data(
+	         (libfwsi_extension_block_0xbeef0019_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0019_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0025_PARSER )
+
+/* Reads extension block 0xbeef0025 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_extension_block_registry_read_0xbeef0025_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_extension_block_0xbeef0025_values_read_data(
+	         (libfwsi_extension_block_0xbeef0025_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0025_PARSER ) */
+
@@ -0,0 +1,240 @@
+/*
+ * Extension block registry functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_EXTENSION_BLOCK_REGISTRY_H )
+#define _LIBFWSI_EXTENSION_BLOCK_REGISTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of handlers, where the handlers are indexed by the lower 16 bits of the signature
+ */
+#define LIBFWSI_EXTENSION_BLOCK_REGISTRY_NUMBER_OF_HANDLERS	64
+
+/* The extension block handler flags
+ */
+#define LIBFWSI_EXTENSION_BLOCK_HANDLER_FLAG_USER_DEFINED	0x01
+
+typedef struct libfwsi_extension_block_handler libfwsi_extension_block_handler_t;
+
+struct libfwsi_extension_block_handler
+{
+	/* The signature, where 0 represents an unused handler
+	 */
+	uint32_t signature;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The values type
+	 */
+	int values_type;
+
+	/* The size of the values structure
+	 */
+	size_t values_size;
+
+	/* The initialize values function
+	 */
+	int (*initialize_values)(
+	       intptr_t **values,
+	       libcerror_error_t **error );
+
+	/* The read values function, where NULL indicates the extension block is skipped
+	 */
+	int (*read_values)(
+	       intptr_t *values,
+	       const uint8_t *data,
+	       size_t data_size,
+	       int ascii_codepage,
+	       libcerror_error_t **error );
+
+	/* The free values function
+	 */
+	int (*free_values)(
+	       intptr_t **values,
+	       libcerror_error_t **error );
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_register_extension_block_handler(
+     uint32_t signature,
+     size_t values_size,
+     int (*initialize_function)(
+            intptr_t **values,
+            libcerror_error_t **error ),
+     int (*read_function)(
+            intptr_t *values,
+            const uint8_t *data,
+            size_t data_size,
+            int ascii_codepage,
+            libcerror_error_t **error ),
+     int (*free_function)(
+            intptr_t **values,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_unregister_extension_block_handler(
+     uint32_t signature,
+     libcerror_error_t **error );
+
+int libfwsi_extension_block_registry_get_handler(
+     uint32_t signature,
+     const libfwsi_extension_block_handler_t **handler,
+     libcerror_error_t **error );
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0000_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0000_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0000_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0001_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0001_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0001_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0003_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0003_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0003_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0004_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0005_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0005_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0005_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0006_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0006_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0006_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF000A_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef000a_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF000A_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0013_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0014_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0019_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0019_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0019_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0025_PARSER )
+
+int libfwsi_extension_block_registry_read_0xbeef0025_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0025_PARSER ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_EXTENSION_BLOCK_REGISTRY_H ) */
+
@@ -0,0 +1,300 @@
+/*
+ * FAT date and time functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_fat_date_time.h"
+#include "libfwsi_libcerror.h"
+
+/* The number of days since January 1, 1980 at the start of each year of the FAT date range (1980 - 2107)
+ */
+static const uint32_t libfwsi_fat_date_time_days_before_year[ 128 ] = {
+	0, 366, 731, 1096, 1461, 1827, 2192, 2557,
+	2922, 3288, 3653, 4018, 4383, 4749, 5114, 5479,
+	5844, 6210, 6575, 6940, 7305, 7671, 8036, 8401,
+	8766, 9132, 9497, 9862, 10227, 10593, 10958, 11323,
+	11688, 12054, 12419, 12784, 13149, 13515, 13880, 14245,
+	14610, 14976, 15341, 15706, 16071, 16437, 16802, 17167,
+	17532, 17898, 18263, 18628, 18993, 19359, 19724, 20089,
+	20454, 20820, 21185, 21550, 21915, 22281, 22646, 23011,
+	23376, 23742, 24107, 24472, 24837, 25203, 25568, 25933,
+	26298, 26664, 27029, 27394, 27759, 28125, 28490, 28855,
+	29220, 29586, 29951, 30316, 30681, 31047, 31412, 31777,
+	32142, 32508, 32873, 33238, 33603, 33969, 34334, 34699,
+	35064, 35430, 35795, 36160, 36525, 36891, 37256, 37621,
+	37986, 38352, 38717, 39082, 39447, 39813, 40178, 40543,
+	40908, 41274, 41639, 42004, 42369, 42735, 43100, 43465,
+	43830, 44195, 44560, 44925, 45290, 45656, 46021, 46386 };
+
+/* The number of days since the start of the year at the start of each month,
+ * where the first 16 values are of non-leap years and the last 16 values of leap years
+ * The month is stored in 4 bits, hence the values of the invalid months 0 and 13 - 15 are included
+ */
+static const uint32_t libfwsi_fat_date_time_days_before_month[ 32 ] = {
+	0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 0, 0, 0,
+	0, 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 0, 0, 0 };
+
+/* The number of days of each month,
+ * where the first 16 values are of non-leap years and the last 16 values of leap years
+ * The invalid months 0 and 13 - 15 have 0 days
+ */
+static const uint32_t libfwsi_fat_date_time_days_per_month[ 32 ] = {
+	0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31, 0, 0, 0,
+	0, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31, 0, 0, 0 };
+
+/* Determines the number of seconds since January 1, 1980 00:00:00 of a FAT date and time value
+ * The FAT date is stored in the lower 16-bit and the FAT time in the upper 16-bit
+ * The determination does not branch on the value, which allows the batch conversion loops to be vectorized
+ * Returns the number of seconds or -1 if the FAT date and time value is not set or invalid
+ */
+static int64_t libfwsi_fat_date_time_get_number_of_seconds(
+                uint32_t fat_date_time )
+{
+	int64_t number_of_seconds = 0;
+	uint32_t day_of_month     = 0;
+	uint32_t hours            = 0;
+	uint32_t is_leap_year     = 0;
+	uint32_t is_valid         = 0;
+	uint32_t minutes          = 0;
+	uint32_t month            = 0;
+	uint32_t month_index      = 0;
+	uint32_t seconds          = 0;
+	uint32_t year             = 0;
+
+	day_of_month = fat_date_time & 0x1f;
+	month        = ( fat_date_time >> 5 ) & 0x0f;
+	year         = ( fat_date_time >> 9 ) & 0x7f;
+	seconds      = ( ( fat_date_time >> 16 ) & 0x1f ) * 2;
+	minutes      = ( fat_date_time >> 21 ) & 0x3f;
+	hours        = ( fat_date_time >> 27 ) & 0x1f;
+
+	/* The year 2100 (120) is not a leap year
+	 */
+	is_leap_year = (uint32_t) ( ( ( year & 0x03 ) == 0 ) & ( year != 120 ) );
+	month_index  = ( is_leap_year << 4 ) | month;
+
+	is_valid = (uint32_t) ( ( day_of_month != 0 )
+	                      & ( day_of_month <= libfwsi_fat_date_time_days_per_month[ month_index ] )
+	                      & ( seconds < 60 )
+	                      & ( minutes < 60 )
+	                      & ( hours < 24 ) );
+
+	number_of_seconds = (int64_t) libfwsi_fat_date_time_days_before_year[ year ]
+	                  + (int64_t) libfwsi_fat_date_time_days_before_month[ month_index ]
+	                  + (int64_t) day_of_month - 1;
+
+	number_of_seconds *= 86400;
+	number_of_seconds += ( hours * 3600 ) + ( minutes * 60 ) + seconds;
+
+	return( is_valid != 0 ? number_of_seconds : -1 );
+}
+
+/* Converts a FAT date and time value into a FILETIME value
+ * The FAT date and time value is assumed to be in UTC
+ * Returns 1 if successful, 0 if the FAT date and time value is not set or invalid or -1 on error
+ */
+int libfwsi_fat_date_time_copy_to_filetime(
+     uint32_t fat_date_time,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_fat_date_time_copy_to_filetime";
+	int64_t number_of_seconds = 0;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = libfwsi_fat_date_time_get_number_of_seconds(
+	                     fat_date_time );
+
+	if( number_of_seconds < 0 )
+	{
+		return( 0 );
+	}
+	*filetime = (uint64_t) ( number_of_seconds + LIBFWSI_FAT_DATE_TIME_FILETIME_EPOCH_OFFSET ) * 10000000UL;
+
+	return( 1 );
+}
+
+/* Converts a FAT date and time value into a POSIX time value in number of nanoseconds
+ * The FAT date and time value is assumed to be in UTC
+ * Returns 1 if successful, 0 if the FAT date and time value is not set or invalid or -1 on error
+ */
+int libfwsi_fat_date_time_copy_to_posix_time_nanoseconds(
+     uint32_t fat_date_time,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_fat_date_time_copy_to_posix_time_nanoseconds";
+	int64_t number_of_seconds = 0;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_seconds = libfwsi_fat_date_time_get_number_of_seconds(
+	                     fat_date_time );
+
+	if( number_of_seconds < 0 )
+	{
+		return( 0 );
+	}
+	*posix_time = ( number_of_seconds + LIBFWSI_FAT_DATE_TIME_POSIX_TIME_EPOCH_OFFSET ) * 1000000000L;
+
+	return( 1 );
+}
+
+/* Converts an array of FAT date and time values into FILETIME values
+ * The FAT date and time values are assumed to be in UTC
+ * Values that are not set or invalid are converted to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_fat_date_time_array_copy_to_filetime(
+     const uint32_t *fat_date_times,
+     size_t number_of_values,
+     uint64_t *filetimes,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_fat_date_time_array_copy_to_filetime";
+	int64_t number_of_seconds = 0;
+	size_t value_index        = 0;
+
+	if( fat_date_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIMEs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		number_of_seconds = libfwsi_fat_date_time_get_number_of_seconds(
+		                     fat_date_times[ value_index ] );
+
+		filetimes[ value_index ] = ( number_of_seconds >= 0 ) ? (uint64_t) ( number_of_seconds + LIBFWSI_FAT_DATE_TIME_FILETIME_EPOCH_OFFSET ) * 10000000UL : 0;
+	}
+	return( 1 );
+}
+
+/* Converts an array of FAT date and time values into POSIX time values in number of nanoseconds
+ * The FAT date and time values are assumed to be in UTC
+ * Values that are not set or invalid are converted to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds(
+     const uint32_t *fat_date_times,
+     size_t number_of_values,
+     int64_t *posix_times,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds";
+	int64_t number_of_seconds = 0;
+	size_t value_index        = 0;
+
+	if( fat_date_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FAT date and time values.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX times.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (size_t) ( SSIZE_MAX / sizeof( int64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		number_of_seconds = libfwsi_fat_date_time_get_number_of_seconds(
+		                     fat_date_times[ value_index ] );
+
+		posix_times[ value_index ] = ( number_of_seconds >= 0 ) ? ( number_of_seconds + LIBFWSI_FAT_DATE_TIME_POSIX_TIME_EPOCH_OFFSET ) * 1000000000L : 0;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,74 @@
+/*
+ * FAT date and time functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_FAT_DATE_TIME_H )
+#define _LIBFWSI_FAT_DATE_TIME_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of seconds between January 1, 1601 and January 1, 1980
+ */
+#define LIBFWSI_FAT_DATE_TIME_FILETIME_EPOCH_OFFSET	(int64_t) 11960006400
+
+/* The number of seconds between January 1, 1970 and January 1, 1980
+ */
+#define LIBFWSI_FAT_DATE_TIME_POSIX_TIME_EPOCH_OFFSET	(int64_t) 315532800L
+
+LIBFWSI_EXTERN \
+int libfwsi_fat_date_time_copy_to_filetime(
+     uint32_t fat_date_time,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_fat_date_time_copy_to_posix_time_nanoseconds(
+     uint32_t fat_date_time,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_fat_date_time_array_copy_to_filetime(
+     const uint32_t *fat_date_times,
+     size_t number_of_values,
+     uint64_t *filetimes,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds(
+     const uint32_t *fat_date_times,
+     size_t number_of_values,
+     int64_t *posix_times,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_FAT_DATE_TIME_H ) */
+
@@ -24,11 +24,13 @@
 
 #include "libfwsi_codepage.h"
 #include "libfwsi_definitions.h"
+#include "libfwsi_fat_date_time.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_file_entry.h"
 #include "libfwsi_file_entry_values.h"
 #include "libfwsi_item.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 
 /* Retrieves the file size
  * Returns 1 if successful or -1 on error
@@ -287,7 +289,7 @@ int libfwsi_file_entry_get_utf8_name_size(
 	}
 	else
 	{
-		result = libuna_utf8_string_size_from_byte_stream(
+		result = libfwsi_string_utf8_size_from_byte_stream(
 			  file_entry_values->name,
 			  file_entry_values->name_size,
 		          internal_item->ascii_codepage,
@@ -371,7 +373,7 @@ int libfwsi_file_entry_get_utf8_name(
 	}
 	else
 	{
-		result = libuna_utf8_string_copy_from_byte_stream(
+		result = libfwsi_string_utf8_copy_from_byte_stream(
 		          utf8_string,
 		          utf8_string_size,
 			  file_entry_values->name,
@@ -454,7 +456,7 @@ int libfwsi_file_entry_get_utf16_name_size(
 	}
 	else
 	{
-		result = libuna_utf16_string_size_from_byte_stream(
+		result = libfwsi_string_utf16_size_from_byte_stream(
 			  file_entry_values->name,
 			  file_entry_values->name_size,
 		          internal_item->ascii_codepage,
@@ -538,7 +540,7 @@ int libfwsi_file_entry_get_utf16_name(
 	}
 	else
 	{
-		result = libuna_utf16_string_copy_from_byte_stream(
+		result = libfwsi_string_utf16_copy_from_byte_stream(
 		          utf16_string,
 		          utf16_string_size,
 			  file_entry_values->name,
@@ -560,3 +562,163 @@ int libfwsi_file_entry_get_utf16_name(
 	return( 1 );
 }
 
+/* Retrieves the modification time as a FILETIME value
+ * Returns 1 if successful, 0 if not set or not a valid FAT date and time value or -1 on error
+ */
+int libfwsi_file_entry_get_modification_time_as_filetime(
+     libfwsi_item_t *item,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_file_entry_values_t *file_entry_values = NULL;
+	static char *function                          = "libfwsi_file_entry_get_modification_time_as_filetime";
+	int result                                     = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_FILE_ENTRY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          file_entry_values->modification_time,
+	          filetime,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy modification time to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the modification time as a POSIX time value in number of nanoseconds
+ * Returns 1 if successful, 0 if not set or not a valid FAT date and time value or -1 on error
+ */
+int libfwsi_file_entry_get_modification_time_as_posix_time_nanoseconds(
+     libfwsi_item_t *item,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_file_entry_values_t *file_entry_values = NULL;
+	static char *function                          = "libfwsi_file_entry_get_modification_time_as_posix_time_nanoseconds";
+	int result                                     = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( ( internal_item->class_type & 0x70 ) != LIBFWSI_CLASS_TYPE_FILE_ENTRY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_posix_time_nanoseconds(
+	          file_entry_values->modification_time,
+	          posix_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy modification time to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
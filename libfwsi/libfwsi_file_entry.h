@@ -77,6 +77,18 @@ int libfwsi_file_entry_get_utf16_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_modification_time_as_filetime(
+     libfwsi_item_t *item,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_get_modification_time_as_posix_time_nanoseconds(
+     libfwsi_item_t *item,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,10 +24,12 @@
 #include <types.h>
 
 #include "libfwsi_extension_block.h"
+#include "libfwsi_fat_date_time.h"
 #include "libfwsi_file_entry_extension.h"
 #include "libfwsi_file_entry_extension_values.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_values_type.h"
 
 /* Retrieves the creation time
  * The returned time is a 32-bit version of a FAT date time value
@@ -55,7 +57,7 @@ int libfwsi_file_entry_extension_get_creation_time(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -121,7 +123,7 @@ int libfwsi_file_entry_extension_get_access_time(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -186,7 +188,7 @@ int libfwsi_file_entry_extension_get_file_reference(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -256,7 +258,7 @@ int libfwsi_file_entry_extension_get_utf8_long_name_size(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -330,7 +332,7 @@ int libfwsi_file_entry_extension_get_utf8_long_name(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -404,7 +406,7 @@ int libfwsi_file_entry_extension_get_utf16_long_name_size(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -478,7 +480,7 @@ int libfwsi_file_entry_extension_get_utf16_long_name(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -553,7 +555,7 @@ int libfwsi_file_entry_extension_get_utf8_localized_name_size(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -645,7 +647,7 @@ int libfwsi_file_entry_extension_get_utf8_localized_name(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -738,7 +740,7 @@ int libfwsi_file_entry_extension_get_utf16_localized_name_size(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -830,7 +832,7 @@ int libfwsi_file_entry_extension_get_utf16_localized_name(
 	}
 	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
 
-	if( internal_extension_block->signature != 0xbeef0004UL )
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
 	{
 		libcerror_error_set(
 		 error,
@@ -897,3 +899,323 @@ int libfwsi_file_entry_extension_get_utf16_localized_name(
 	return( 1 );
 }
 
+/* Retrieves the creation time as a FILETIME value
+ * Returns 1 if successful, 0 if not set or not a valid FAT date and time value or -1 on error
+ */
+int libfwsi_file_entry_extension_get_creation_time_as_filetime(
+     libfwsi_extension_block_t *extension_block,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_creation_time_as_filetime";
+	int result                                                         = 0;
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          file_entry_extension_values->creation_time,
+	          filetime,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy creation time to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the creation time as a POSIX time value in number of nanoseconds
+ * Returns 1 if successful, 0 if not set or not a valid FAT date and time value or -1 on error
+ */
+int libfwsi_file_entry_extension_get_creation_time_as_posix_time_nanoseconds(
+     libfwsi_extension_block_t *extension_block,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_creation_time_as_posix_time_nanoseconds";
+	int result                                                         = 0;
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_posix_time_nanoseconds(
+	          file_entry_extension_values->creation_time,
+	          posix_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy creation time to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the access time as a FILETIME value
+ * Returns 1 if successful, 0 if not set or not a valid FAT date and time value or -1 on error
+ */
+int libfwsi_file_entry_extension_get_access_time_as_filetime(
+     libfwsi_extension_block_t *extension_block,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_access_time_as_filetime";
+	int result                                                         = 0;
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          file_entry_extension_values->access_time,
+	          filetime,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy access time to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the access time as a POSIX time value in number of nanoseconds
+ * Returns 1 if successful, 0 if not set or not a valid FAT date and time value or -1 on error
+ */
+int libfwsi_file_entry_extension_get_access_time_as_posix_time_nanoseconds(
+     libfwsi_extension_block_t *extension_block,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block       = NULL;
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	static char *function                                              = "libfwsi_file_entry_extension_get_access_time_as_posix_time_nanoseconds";
+	int result                                                         = 0;
+
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extension_block = (libfwsi_internal_extension_block_t *) extension_block;
+
+	if( internal_extension_block->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported extension block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extension_block->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry_extension_values = (libfwsi_file_entry_extension_values_t *) internal_extension_block->value;
+
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_posix_time_nanoseconds(
+	          file_entry_extension_values->access_time,
+	          posix_time,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy access time to POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
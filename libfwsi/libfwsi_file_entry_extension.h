@@ -103,6 +103,30 @@ int libfwsi_file_entry_extension_get_utf16_localized_name(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_creation_time_as_filetime(
+     libfwsi_extension_block_t *extension_block,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_creation_time_as_posix_time_nanoseconds(
+     libfwsi_extension_block_t *extension_block,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_access_time_as_filetime(
+     libfwsi_extension_block_t *extension_block,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_entry_extension_get_access_time_as_posix_time_nanoseconds(
+     libfwsi_extension_block_t *extension_block,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_file_entry_extension_values.h"
@@ -145,6 +146,8 @@ int libfwsi_file_entry_extension_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
 /* Reads the file entry extension values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -631,3 +634,5 @@ on_error:
 	return( -1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
@@ -77,6 +77,8 @@ int libfwsi_file_entry_extension_values_free(
      libfwsi_file_entry_extension_values_t **file_entry_extension_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
 int libfwsi_file_entry_extension_values_read_data(
      libfwsi_file_entry_extension_values_t *file_entry_extension_values,
      const uint8_t *data,
@@ -84,6 +86,8 @@ int libfwsi_file_entry_extension_values_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_file_attributes.h"
@@ -144,6 +145,8 @@ int libfwsi_file_entry_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+
 /* Reads the file entry values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -667,3 +670,5 @@ on_error:
 	return( -1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) */
+
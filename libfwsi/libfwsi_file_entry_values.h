@@ -72,6 +72,8 @@ int libfwsi_file_entry_values_free(
      libfwsi_file_entry_values_t **file_entry_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+
 int libfwsi_file_entry_values_read_data(
      libfwsi_file_entry_values_t *file_entry_values,
      const uint8_t *data,
@@ -79,6 +81,8 @@ int libfwsi_file_entry_values_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,893 @@
+/*
+ * File reference index functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_extension_block.h"
+#include "libfwsi_file_entry_extension_values.h"
+#include "libfwsi_file_reference_index.h"
+#include "libfwsi_item.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+/* Creates a file reference index
+ * Make sure the value file_reference_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_reference_index_initialize(
+     libfwsi_file_reference_index_t **file_reference_index,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_file_reference_index_t *internal_file_reference_index = NULL;
+	static char *function                                                  = "libfwsi_file_reference_index_initialize";
+
+	if( file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_reference_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file reference index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_reference_index = memory_allocate_structure(
+	                                 libfwsi_internal_file_reference_index_t );
+
+	if( internal_file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file reference index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_file_reference_index,
+	     0,
+	     sizeof( libfwsi_internal_file_reference_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file reference index.",
+		 function );
+
+		goto on_error;
+	}
+	*file_reference_index = (libfwsi_file_reference_index_t *) internal_file_reference_index;
+
+	return( 1 );
+
+on_error:
+	if( internal_file_reference_index != NULL )
+	{
+		memory_free(
+		 internal_file_reference_index );
+	}
+	return( -1 );
+}
+
+/* Frees a file reference index
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_reference_index_free(
+     libfwsi_file_reference_index_t **file_reference_index,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_file_reference_index_t *internal_file_reference_index = NULL;
+	static char *function                                                  = "libfwsi_file_reference_index_free";
+
+	if( file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_reference_index != NULL )
+	{
+		internal_file_reference_index = (libfwsi_internal_file_reference_index_t *) *file_reference_index;
+		*file_reference_index         = NULL;
+
+		if( internal_file_reference_index->entries != NULL )
+		{
+			memory_free(
+			 internal_file_reference_index->entries );
+		}
+		if( internal_file_reference_index->slots != NULL )
+		{
+			memory_free(
+			 internal_file_reference_index->slots );
+		}
+		memory_free(
+		 internal_file_reference_index );
+	}
+	return( 1 );
+}
+
+/* Determines the slot index of a file reference
+ * The file reference is hashed with a multiplicative (Fibonacci) hash, where the upper bits
+ * of the product are used since they depend on all the bits of the file reference
+ * Returns the slot index
+ */
+int libfwsi_file_reference_index_get_slot_index(
+     uint64_t file_reference,
+     int number_of_slots )
+{
+	uint64_t hash = 0;
+
+	hash = file_reference * (uint64_t) 0x9e3779b97f4a7c15;
+
+	return( (int) ( ( hash >> 32 ) & (uint64_t) ( number_of_slots - 1 ) ) );
+}
+
+/* Finds the slot of a file reference using linear probing
+ * Returns 1 if the slot of the file reference was found or 0 if not, where slot index
+ * is set to the empty slot the file reference would be stored in
+ */
+int libfwsi_internal_file_reference_index_find_slot(
+     libfwsi_internal_file_reference_index_t *internal_file_reference_index,
+     uint64_t file_reference,
+     int *slot_index )
+{
+	libfwsi_file_reference_index_slot_t *slot = NULL;
+	int safe_slot_index                       = 0;
+
+	safe_slot_index = libfwsi_file_reference_index_get_slot_index(
+	                   file_reference,
+	                   internal_file_reference_index->number_of_slots );
+
+	/* The hash table is never full, hence the probing always ends at an empty slot
+	 */
+	for( ;; )
+	{
+		slot = &( internal_file_reference_index->slots[ safe_slot_index ] );
+
+		if( slot->first_entry_number == 0 )
+		{
+			break;
+		}
+		if( slot->file_reference == file_reference )
+		{
+			*slot_index = safe_slot_index;
+
+			return( 1 );
+		}
+		safe_slot_index = ( safe_slot_index + 1 ) & ( internal_file_reference_index->number_of_slots - 1 );
+	}
+	*slot_index = safe_slot_index;
+
+	return( 0 );
+}
+
+/* Resizes the slots of the hash table and rehashes the used slots
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_file_reference_index_resize_slots(
+     libfwsi_internal_file_reference_index_t *internal_file_reference_index,
+     int number_of_slots,
+     libcerror_error_t **error )
+{
+	libfwsi_file_reference_index_slot_t *previous_slots = NULL;
+	libfwsi_file_reference_index_slot_t *slots          = NULL;
+	static char *function                               = "libfwsi_internal_file_reference_index_resize_slots";
+	int previous_number_of_slots                        = 0;
+	int previous_slot_index                             = 0;
+	int slot_index                                      = 0;
+
+	if( internal_file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots <= internal_file_reference_index->number_of_used_slots )
+	 || ( number_of_slots > LIBFWSI_FILE_REFERENCE_INDEX_MAXIMUM_NUMBER_OF_SLOTS )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (libfwsi_file_reference_index_slot_t *) memory_allocate(
+	                                                 sizeof( libfwsi_file_reference_index_slot_t ) * (size_t) number_of_slots );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     sizeof( libfwsi_file_reference_index_slot_t ) * (size_t) number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	previous_slots           = internal_file_reference_index->slots;
+	previous_number_of_slots = internal_file_reference_index->number_of_slots;
+
+	internal_file_reference_index->slots           = slots;
+	internal_file_reference_index->number_of_slots = number_of_slots;
+
+	for( previous_slot_index = 0;
+	     previous_slot_index < previous_number_of_slots;
+	     previous_slot_index++ )
+	{
+		if( previous_slots[ previous_slot_index ].first_entry_number == 0 )
+		{
+			continue;
+		}
+		libfwsi_internal_file_reference_index_find_slot(
+		 internal_file_reference_index,
+		 previous_slots[ previous_slot_index ].file_reference,
+		 &slot_index );
+
+		slots[ slot_index ] = previous_slots[ previous_slot_index ];
+	}
+	if( previous_slots != NULL )
+	{
+		memory_free(
+		 previous_slots );
+	}
+	return( 1 );
+}
+
+/* Reserves space for a number of additional entries
+ * The hash table is resized so that it stays at most half full after the entries are inserted
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_file_reference_index_reserve(
+     libfwsi_internal_file_reference_index_t *internal_file_reference_index,
+     int number_of_additional_entries,
+     libcerror_error_t **error )
+{
+	libfwsi_file_reference_index_entry_t *entries = NULL;
+	static char *function                         = "libfwsi_internal_file_reference_index_reserve";
+	int number_of_entries                         = 0;
+	int number_of_slots                           = 0;
+
+	if( internal_file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_additional_entries < 0 )
+	 || ( number_of_additional_entries > ( ( LIBFWSI_FILE_REFERENCE_INDEX_MAXIMUM_NUMBER_OF_SLOTS / 2 ) - internal_file_reference_index->number_of_entries ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of additional entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = internal_file_reference_index->number_of_entries + number_of_additional_entries;
+
+	if( number_of_entries > internal_file_reference_index->number_of_allocated_entries )
+	{
+		if( number_of_entries < ( internal_file_reference_index->number_of_allocated_entries * 2 ) )
+		{
+			number_of_entries = internal_file_reference_index->number_of_allocated_entries * 2;
+		}
+		entries = (libfwsi_file_reference_index_entry_t *) memory_reallocate(
+		                                                    internal_file_reference_index->entries,
+		                                                    sizeof( libfwsi_file_reference_index_entry_t ) * (size_t) number_of_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file_reference_index->entries                     = entries;
+		internal_file_reference_index->number_of_allocated_entries = number_of_entries;
+	}
+	/* Every entry uses at most 1 slot
+	 */
+	number_of_slots = internal_file_reference_index->number_of_slots;
+
+	if( number_of_slots == 0 )
+	{
+		number_of_slots = LIBFWSI_FILE_REFERENCE_INDEX_INITIAL_NUMBER_OF_SLOTS;
+	}
+	while( ( internal_file_reference_index->number_of_used_slots + number_of_additional_entries ) > ( number_of_slots / 2 ) )
+	{
+		number_of_slots *= 2;
+	}
+	if( number_of_slots != internal_file_reference_index->number_of_slots )
+	{
+		if( libfwsi_internal_file_reference_index_resize_slots(
+		     internal_file_reference_index,
+		     number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Inserts an entry
+ * Space for the entry must have been reserved with libfwsi_internal_file_reference_index_reserve
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_file_reference_index_insert(
+     libfwsi_internal_file_reference_index_t *internal_file_reference_index,
+     uint64_t file_reference,
+     int list_identifier,
+     int item_index,
+     libcerror_error_t **error )
+{
+	libfwsi_file_reference_index_entry_t *entry = NULL;
+	libfwsi_file_reference_index_slot_t *slot   = NULL;
+	static char *function                       = "libfwsi_internal_file_reference_index_insert";
+	int entry_number                            = 0;
+	int result                                  = 0;
+	int slot_index                              = 0;
+
+	if( internal_file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_reference_index->number_of_entries >= internal_file_reference_index->number_of_allocated_entries )
+	 || ( internal_file_reference_index->number_of_used_slots >= ( internal_file_reference_index->number_of_slots / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference index - missing reserved space.",
+		 function );
+
+		return( -1 );
+	}
+	entry_number = internal_file_reference_index->number_of_entries + 1;
+
+	entry = &( internal_file_reference_index->entries[ entry_number - 1 ] );
+
+	entry->file_reference    = file_reference;
+	entry->list_identifier   = list_identifier;
+	entry->item_index        = item_index;
+	entry->next_entry_number = 0;
+
+	result = libfwsi_internal_file_reference_index_find_slot(
+	          internal_file_reference_index,
+	          file_reference,
+	          &slot_index );
+
+	slot = &( internal_file_reference_index->slots[ slot_index ] );
+
+	if( result == 0 )
+	{
+		slot->file_reference     = file_reference;
+		slot->first_entry_number = entry_number;
+
+		internal_file_reference_index->number_of_used_slots += 1;
+	}
+	else
+	{
+		internal_file_reference_index->entries[ slot->last_entry_number - 1 ].next_entry_number = entry_number;
+	}
+	slot->last_entry_number = entry_number;
+
+	internal_file_reference_index->number_of_entries = entry_number;
+
+	return( 1 );
+}
+
+/* Appends the file references of the items of an item list
+ * The file reference of an item is read from its first file entry extension block (0xbeef0004)
+ * that contains a file reference. Items without a file reference are not indexed
+ * The list identifier is defined by the caller and is returned with the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_reference_index_append_item_list(
+     libfwsi_file_reference_index_t *file_reference_index,
+     libfwsi_item_list_t *item_list,
+     int list_identifier,
+     libcerror_error_t **error )
+{
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values     = NULL;
+	libfwsi_internal_file_reference_index_t *internal_file_reference_index = NULL;
+	libfwsi_internal_item_t *internal_item                                 = NULL;
+	libfwsi_internal_item_list_t *internal_item_list                       = NULL;
+	static char *function                                                  = "libfwsi_file_reference_index_append_item_list";
+	int item_index                                                         = 0;
+
+	if( file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_reference_index = (libfwsi_internal_file_reference_index_t *) file_reference_index;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	/* Reserve space for all items at once so that the hash table is resized at most once per list
+	 */
+	if( libfwsi_internal_file_reference_index_reserve(
+	     internal_file_reference_index,
+	     internal_item_list->number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < internal_item_list->number_of_items;
+	     item_index++ )
+	{
+		internal_item = internal_item_list->items[ item_index ];
+
+		if( internal_item == NULL )
+		{
+			continue;
+		}
+		file_entry_extension_values = libfwsi_internal_item_get_file_entry_extension_values(
+		                               internal_item );
+
+		if( ( file_entry_extension_values == NULL )
+		 || ( file_entry_extension_values->file_reference == 0 ) )
+		{
+			continue;
+		}
+		if( libfwsi_internal_file_reference_index_insert(
+		     internal_file_reference_index,
+		     file_entry_extension_values->file_reference,
+		     list_identifier,
+		     item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert file reference of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_reference_index_get_number_of_entries(
+     libfwsi_file_reference_index_t *file_reference_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_file_reference_index_t *internal_file_reference_index = NULL;
+	static char *function                                                  = "libfwsi_file_reference_index_get_number_of_entries";
+
+	if( file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_reference_index = (libfwsi_internal_file_reference_index_t *) file_reference_index;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_file_reference_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_reference_index_get_entry_by_index(
+     libfwsi_file_reference_index_t *file_reference_index,
+     int entry_index,
+     uint64_t *file_reference,
+     int *list_identifier,
+     int *item_index,
+     libcerror_error_t **error )
+{
+	libfwsi_file_reference_index_entry_t *entry                            = NULL;
+	libfwsi_internal_file_reference_index_t *internal_file_reference_index = NULL;
+	static char *function                                                  = "libfwsi_file_reference_index_get_entry_by_index";
+
+	if( file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_reference_index = (libfwsi_internal_file_reference_index_t *) file_reference_index;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_file_reference_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( list_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid list identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item index.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_file_reference_index->entries[ entry_index ] );
+
+	*file_reference  = entry->file_reference;
+	*list_identifier = entry->list_identifier;
+	*item_index      = entry->item_index;
+
+	return( 1 );
+}
+
+/* Finds the first entry of a specific file reference
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfwsi_file_reference_index_find_entry(
+     libfwsi_file_reference_index_t *file_reference_index,
+     uint64_t file_reference,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_file_reference_index_t *internal_file_reference_index = NULL;
+	static char *function                                                  = "libfwsi_file_reference_index_find_entry";
+	int slot_index                                                         = 0;
+
+	if( file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_reference_index = (libfwsi_internal_file_reference_index_t *) file_reference_index;
+
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_reference_index->number_of_used_slots == 0 )
+	{
+		return( 0 );
+	}
+	if( libfwsi_internal_file_reference_index_find_slot(
+	     internal_file_reference_index,
+	     file_reference,
+	     &slot_index ) != 1 )
+	{
+		return( 0 );
+	}
+	*entry_index = internal_file_reference_index->slots[ slot_index ].first_entry_number - 1;
+
+	return( 1 );
+}
+
+/* Finds the next entry with the same file reference as a specific entry
+ * The entries of a file reference are returned in order of insertion
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfwsi_file_reference_index_find_next_entry(
+     libfwsi_file_reference_index_t *file_reference_index,
+     int entry_index,
+     int *next_entry_index,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_file_reference_index_t *internal_file_reference_index = NULL;
+	static char *function                                                  = "libfwsi_file_reference_index_find_next_entry";
+	int next_entry_number                                                  = 0;
+
+	if( file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_reference_index = (libfwsi_internal_file_reference_index_t *) file_reference_index;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_file_reference_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next entry index.",
+		 function );
+
+		return( -1 );
+	}
+	next_entry_number = internal_file_reference_index->entries[ entry_index ].next_entry_number;
+
+	if( next_entry_number == 0 )
+	{
+		return( 0 );
+	}
+	*next_entry_index = next_entry_number - 1;
+
+	return( 1 );
+}
+
+/* Finds the first entries of multiple file references
+ * The entry index of a file reference without entries is set to -1
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_file_reference_index_find_entries(
+     libfwsi_file_reference_index_t *file_reference_index,
+     const uint64_t *file_references,
+     int number_of_file_references,
+     int *entry_indexes,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_file_reference_index_t *internal_file_reference_index = NULL;
+	static char *function                                                  = "libfwsi_file_reference_index_find_entries";
+	int slot_index                                                         = 0;
+	int value_index                                                        = 0;
+
+	if( file_reference_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_reference_index = (libfwsi_internal_file_reference_index_t *) file_reference_index;
+
+	if( file_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file references.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_references < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of file references value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_file_references;
+	     value_index++ )
+	{
+		entry_indexes[ value_index ] = -1;
+
+		if( internal_file_reference_index->number_of_used_slots == 0 )
+		{
+			continue;
+		}
+		if( libfwsi_internal_file_reference_index_find_slot(
+		     internal_file_reference_index,
+		     file_references[ value_index ],
+		     &slot_index ) == 1 )
+		{
+			entry_indexes[ value_index ] = internal_file_reference_index->slots[ slot_index ].first_entry_number - 1;
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,198 @@
+/*
+ * File reference index functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_FILE_REFERENCE_INDEX_H )
+#define _LIBFWSI_FILE_REFERENCE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of slots of the hash table, which must be a power of 2
+ */
+#define LIBFWSI_FILE_REFERENCE_INDEX_INITIAL_NUMBER_OF_SLOTS	64
+
+/* The maximum number of slots of the hash table
+ */
+#define LIBFWSI_FILE_REFERENCE_INDEX_MAXIMUM_NUMBER_OF_SLOTS	( 1 << 30 )
+
+typedef struct libfwsi_file_reference_index_entry libfwsi_file_reference_index_entry_t;
+
+struct libfwsi_file_reference_index_entry
+{
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The list identifier
+	 */
+	int list_identifier;
+
+	/* The index of the item in the list
+	 */
+	int item_index;
+
+	/* The number of the next entry with the same file reference,
+	 * where the entry number is the entry index + 1 and 0 represents none
+	 */
+	int next_entry_number;
+};
+
+typedef struct libfwsi_file_reference_index_slot libfwsi_file_reference_index_slot_t;
+
+struct libfwsi_file_reference_index_slot
+{
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The number of the first entry with the file reference,
+	 * where the entry number is the entry index + 1 and 0 represents an empty slot
+	 */
+	int first_entry_number;
+
+	/* The number of the last entry with the file reference
+	 */
+	int last_entry_number;
+};
+
+typedef struct libfwsi_internal_file_reference_index libfwsi_internal_file_reference_index_t;
+
+struct libfwsi_internal_file_reference_index
+{
+	/* The entries, stored in order of insertion
+	 */
+	libfwsi_file_reference_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The slots of the open-addressing hash table
+	 */
+	libfwsi_file_reference_index_slot_t *slots;
+
+	/* The number of slots, which is a power of 2
+	 */
+	int number_of_slots;
+
+	/* The number of used slots
+	 */
+	int number_of_used_slots;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_file_reference_index_initialize(
+     libfwsi_file_reference_index_t **file_reference_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_reference_index_free(
+     libfwsi_file_reference_index_t **file_reference_index,
+     libcerror_error_t **error );
+
+int libfwsi_file_reference_index_get_slot_index(
+     uint64_t file_reference,
+     int number_of_slots );
+
+int libfwsi_internal_file_reference_index_find_slot(
+     libfwsi_internal_file_reference_index_t *internal_file_reference_index,
+     uint64_t file_reference,
+     int *slot_index );
+
+int libfwsi_internal_file_reference_index_resize_slots(
+     libfwsi_internal_file_reference_index_t *internal_file_reference_index,
+     int number_of_slots,
+     libcerror_error_t **error );
+
+int libfwsi_internal_file_reference_index_reserve(
+     libfwsi_internal_file_reference_index_t *internal_file_reference_index,
+     int number_of_additional_entries,
+     libcerror_error_t **error );
+
+int libfwsi_internal_file_reference_index_insert(
+     libfwsi_internal_file_reference_index_t *internal_file_reference_index,
+     uint64_t file_reference,
+     int list_identifier,
+     int item_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_reference_index_append_item_list(
+     libfwsi_file_reference_index_t *file_reference_index,
+     libfwsi_item_list_t *item_list,
+     int list_identifier,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_reference_index_get_number_of_entries(
+     libfwsi_file_reference_index_t *file_reference_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_reference_index_get_entry_by_index(
+     libfwsi_file_reference_index_t *file_reference_index,
+     int entry_index,
+     uint64_t *file_reference,
+     int *list_identifier,
+     int *item_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_reference_index_find_entry(
+     libfwsi_file_reference_index_t *file_reference_index,
+     uint64_t file_reference,
+     int *entry_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_reference_index_find_next_entry(
+     libfwsi_file_reference_index_t *file_reference_index,
+     int entry_index,
+     int *next_entry_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_file_reference_index_find_entries(
+     libfwsi_file_reference_index_t *file_reference_index,
+     const uint64_t *file_references,
+     int number_of_file_references,
+     int *entry_indexes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_FILE_REFERENCE_INDEX_H ) */
+
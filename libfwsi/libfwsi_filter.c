@@ -0,0 +1,831 @@
+/*
+ * Item list filter functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_fat_date_time.h"
+#include "libfwsi_filter.h"
+#include "libfwsi_item.h"
+#include "libfwsi_item_type_registry.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_name_pattern.h"
+#include "libfwsi_types.h"
+
+/* Creates a filter
+ * Make sure the value filter is referencing, is set to NULL
+ * A filter without criteria matches every valid shell item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_filter_initialize(
+     libfwsi_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_filter_t *internal_filter = NULL;
+	static char *function                      = "libfwsi_filter_initialize";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = memory_allocate_structure(
+	                   libfwsi_internal_filter_t );
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_filter,
+	     0,
+	     sizeof( libfwsi_internal_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		goto on_error;
+	}
+	*filter = (libfwsi_filter_t *) internal_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_filter != NULL )
+	{
+		memory_free(
+		 internal_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a filter
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_filter_free(
+     libfwsi_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_filter_t *internal_filter = NULL;
+	static char *function                      = "libfwsi_filter_free";
+	int result                                 = 1;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		internal_filter = (libfwsi_internal_filter_t *) *filter;
+		*filter         = NULL;
+
+		if( internal_filter->name_pattern != NULL )
+		{
+			if( libfwsi_name_pattern_free(
+			     &( internal_filter->name_pattern ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free name pattern.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_filter );
+	}
+	return( result );
+}
+
+/* Appends an item type to the filter
+ * An item matches if its type is one of the item types of the filter,
+ * where the item type is determined by the item type registry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_filter_append_item_type(
+     libfwsi_filter_t *filter,
+     int item_type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_filter_t *internal_filter = NULL;
+	static char *function                      = "libfwsi_filter_append_item_type";
+	int item_type_index                        = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfwsi_internal_filter_t *) filter;
+
+	if( ( item_type >= LIBFWSI_ITEM_TYPE_UNKNOWN )
+	 && ( item_type <= LIBFWSI_ITEM_TYPE_UNKNOWN_0x74 ) )
+	{
+		internal_filter->item_types_mask |= (uint32_t) 1 << item_type;
+	}
+	else if( item_type >= LIBFWSI_ITEM_TYPE_USER_DEFINED )
+	{
+		for( item_type_index = 0;
+		     item_type_index < internal_filter->number_of_user_defined_item_types;
+		     item_type_index++ )
+		{
+			if( internal_filter->user_defined_item_types[ item_type_index ] == item_type )
+			{
+				break;
+			}
+		}
+		if( item_type_index >= internal_filter->number_of_user_defined_item_types )
+		{
+			if( internal_filter->number_of_user_defined_item_types >= LIBFWSI_ITEM_TYPE_REGISTRY_MAXIMUM_NUMBER_OF_REGISTERED_ITEM_TYPES )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: number of user defined item types value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			internal_filter->user_defined_item_types[ internal_filter->number_of_user_defined_item_types ] = item_type;
+
+			internal_filter->number_of_user_defined_item_types += 1;
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->flags |= LIBFWSI_FILTER_FLAG_HAS_ITEM_TYPES;
+
+	return( 1 );
+}
+
+/* Sets the class type mask of the filter
+ * An item matches if its class type, masked with the class type mask, equals the class type
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_filter_set_class_type_mask(
+     libfwsi_filter_t *filter,
+     uint8_t class_type_mask,
+     uint8_t class_type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_filter_t *internal_filter = NULL;
+	static char *function                      = "libfwsi_filter_set_class_type_mask";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfwsi_internal_filter_t *) filter;
+
+	if( ( class_type & ~class_type_mask ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported class type: 0x%02" PRIx8 " for class type mask: 0x%02" PRIx8 ".",
+		 function,
+		 class_type,
+		 class_type_mask );
+
+		return( -1 );
+	}
+	internal_filter->class_type_mask = class_type_mask;
+	internal_filter->class_type      = class_type;
+	internal_filter->flags          |= LIBFWSI_FILTER_FLAG_HAS_CLASS_TYPE;
+
+	return( 1 );
+}
+
+/* Sets the file attribute flags of the filter
+ * A file entry item matches if all the file attribute flags of the filter are set
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_filter_set_file_attribute_flags(
+     libfwsi_filter_t *filter,
+     uint32_t file_attribute_flags,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_filter_t *internal_filter = NULL;
+	static char *function                      = "libfwsi_filter_set_file_attribute_flags";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfwsi_internal_filter_t *) filter;
+
+	internal_filter->file_attribute_flags = file_attribute_flags;
+	internal_filter->flags               |= LIBFWSI_FILTER_FLAG_HAS_FILE_ATTRIBUTE_FLAGS;
+
+	return( 1 );
+}
+
+/* Sets the modification time range of the filter
+ * A file entry item matches if its modification time, as a FILETIME,
+ * is within the range, where the first and last time are inclusive
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_filter_set_modification_time_range(
+     libfwsi_filter_t *filter,
+     uint64_t first_filetime,
+     uint64_t last_filetime,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_filter_t *internal_filter = NULL;
+	static char *function                      = "libfwsi_filter_set_modification_time_range";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfwsi_internal_filter_t *) filter;
+
+	if( first_filetime > last_filetime )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first FILETIME value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->first_modification_time = first_filetime;
+	internal_filter->last_modification_time  = last_filetime;
+	internal_filter->flags                  |= LIBFWSI_FILTER_FLAG_HAS_MODIFICATION_TIME_RANGE;
+
+	return( 1 );
+}
+
+/* Sets the name pattern of the filter
+ * A file entry item matches if its primary name matches the pattern case-insensitive,
+ * where a glob pattern supports the wildcards '*' and '?'
+ * Case is only folded for the letters of the Basic Latin, Latin-1 Supplement,
+ * Latin Extended-A (except U+0130), Greek and Cyrillic blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_filter_set_utf8_name_pattern(
+     libfwsi_filter_t *filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int pattern_type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_filter_t *internal_filter = NULL;
+	libfwsi_name_pattern_t *name_pattern       = NULL;
+	static char *function                      = "libfwsi_filter_set_utf8_name_pattern";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfwsi_internal_filter_t *) filter;
+
+	if( libfwsi_name_pattern_initialize(
+	     &name_pattern,
+	     utf8_string,
+	     utf8_string_length,
+	     pattern_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_filter->name_pattern != NULL )
+	{
+		if( libfwsi_name_pattern_free(
+		     &( internal_filter->name_pattern ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free name pattern.",
+			 function );
+
+			libfwsi_name_pattern_free(
+			 &name_pattern,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	internal_filter->name_pattern = name_pattern;
+	internal_filter->flags       |= LIBFWSI_FILTER_FLAG_HAS_NAME_PATTERN;
+
+	return( 1 );
+}
+
+/* Sets the root folder identifier of the filter
+ * A shell item list matches if its first item is a root folder item with the shell folder identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_filter_set_root_folder_identifier(
+     libfwsi_filter_t *filter,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_filter_t *internal_filter = NULL;
+	static char *function                      = "libfwsi_filter_set_root_folder_identifier";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libfwsi_internal_filter_t *) filter;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_filter->root_folder_identifier,
+	     guid_data,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy root folder identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->flags |= LIBFWSI_FILTER_FLAG_HAS_ROOT_FOLDER_IDENTIFIER;
+
+	return( 1 );
+}
+
+/* Determines if the data of a shell item matches the item criteria of the filter
+ * The values are read directly from the shell item data, hence no strings are copied
+ * and no extension blocks are decoded
+ * Returns 1 if the item matches, 0 if not or -1 on error
+ */
+int libfwsi_internal_filter_match_item(
+     libfwsi_internal_filter_t *internal_filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfwsi_internal_filter_match_item";
+	uint64_t filetime             = 0;
+	uint32_t fat_date_time        = 0;
+	uint32_t signature            = 0;
+	uint16_t file_attribute_flags = 0;
+	uint8_t class_type            = 0;
+	uint8_t is_unicode            = 0;
+	int item_type                 = 0;
+	int item_type_index           = 0;
+	int result                    = 0;
+
+	if( libfwsi_item_type_registry_classify(
+	     byte_stream,
+	     byte_stream_size,
+	     &item_type,
+	     &class_type,
+	     &signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to classify shell item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_filter->flags & LIBFWSI_FILTER_FLAG_HAS_ITEM_TYPES ) != 0 )
+	{
+		if( item_type < LIBFWSI_ITEM_TYPE_USER_DEFINED )
+		{
+			if( ( item_type < 0 )
+			 || ( item_type > LIBFWSI_ITEM_TYPE_UNKNOWN_0x74 )
+			 || ( ( internal_filter->item_types_mask & ( (uint32_t) 1 << item_type ) ) == 0 ) )
+			{
+				return( 0 );
+			}
+		}
+		else
+		{
+			for( item_type_index = 0;
+			     item_type_index < internal_filter->number_of_user_defined_item_types;
+			     item_type_index++ )
+			{
+				if( internal_filter->user_defined_item_types[ item_type_index ] == item_type )
+				{
+					break;
+				}
+			}
+			if( item_type_index >= internal_filter->number_of_user_defined_item_types )
+			{
+				return( 0 );
+			}
+		}
+	}
+	if( ( internal_filter->flags & LIBFWSI_FILTER_FLAG_HAS_CLASS_TYPE ) != 0 )
+	{
+		if( ( class_type & internal_filter->class_type_mask ) != internal_filter->class_type )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBFWSI_FILTER_FLAGS_FILE_ENTRY ) == 0 )
+	{
+		return( 1 );
+	}
+	/* The same checks as the file entry values reader, which leaves the item unknown otherwise
+	 */
+	if( ( item_type != LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+	 || ( byte_stream_size < 14 ) )
+	{
+		return( 0 );
+	}
+	if( ( byte_stream[ 2 ] != 0x30 )
+	 && ( byte_stream[ 2 ] != 0x31 )
+	 && ( byte_stream[ 2 ] != 0x32 )
+	 && ( byte_stream[ 2 ] != 0x35 )
+	 && ( byte_stream[ 2 ] != 0x36 )
+	 && ( byte_stream[ 2 ] != 0xb1 ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_filter->flags & LIBFWSI_FILTER_FLAG_HAS_FILE_ATTRIBUTE_FLAGS ) != 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ 12 ] ),
+		 file_attribute_flags );
+
+		if( ( (uint32_t) file_attribute_flags & internal_filter->file_attribute_flags ) != internal_filter->file_attribute_flags )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBFWSI_FILTER_FLAG_HAS_MODIFICATION_TIME_RANGE ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ 8 ] ),
+		 fat_date_time );
+
+		result = libfwsi_fat_date_time_copy_to_filetime(
+		          fat_date_time,
+		          &filetime,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy modification time to FILETIME.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( ( filetime < internal_filter->first_modification_time )
+		 || ( filetime > internal_filter->last_modification_time ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBFWSI_FILTER_FLAG_HAS_NAME_PATTERN ) != 0 )
+	{
+		if( ( byte_stream[ 2 ] & LIBFWSI_FILE_ENTRY_FLAG_IS_UNICODE ) != 0 )
+		{
+			is_unicode = 1;
+		}
+		else if( byte_stream_size >= 44 )
+		{
+			if( memory_compare(
+			     &( byte_stream[ byte_stream_size - 30 ] ),
+			     "S.W.N.1",
+			     7 ) == 0 )
+			{
+				is_unicode = 1;
+			}
+		}
+		if( libfwsi_name_pattern_match(
+		     internal_filter->name_pattern,
+		     &( byte_stream[ 14 ] ),
+		     byte_stream_size - 14,
+		     is_unicode,
+		     ascii_codepage ) != 1 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if a shell item list in a byte stream matches the filter
+ * The root folder identifier is matched against the first item and the item criteria
+ * against every item, where the list matches if at least one item matches
+ * Returns 1 if the shell item list matches, 0 if not or -1 on error
+ */
+int libfwsi_internal_filter_match_byte_stream(
+     libfwsi_internal_filter_t *internal_filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_internal_filter_match_byte_stream";
+	size_t byte_stream_offset = 0;
+	uint16_t shell_item_size  = 0;
+	uint8_t has_item_match    = 0;
+	int result                = 0;
+	int shell_item_index      = 0;
+
+	if( ( internal_filter->flags & LIBFWSI_FILTER_FLAGS_ITEM ) == 0 )
+	{
+		has_item_match = 1;
+	}
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( ( byte_stream_size - byte_stream_offset ) < 2 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+		if( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) )
+		{
+			return( 0 );
+		}
+		if( shell_item_size == 0 )
+		{
+			break;
+		}
+		if( libfwsi_item_validate_byte_stream(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     (size_t) shell_item_size,
+		     0 ) != 1 )
+		{
+			return( 0 );
+		}
+		if( ( shell_item_index == 0 )
+		 && ( ( internal_filter->flags & LIBFWSI_FILTER_FLAG_HAS_ROOT_FOLDER_IDENTIFIER ) != 0 ) )
+		{
+			if( ( shell_item_size < 20 )
+			 || ( byte_stream[ byte_stream_offset + 2 ] != LIBFWSI_CLASS_TYPE_ROOT_FOLDER )
+			 || ( memory_compare(
+			       &( byte_stream[ byte_stream_offset + 4 ] ),
+			       internal_filter->root_folder_identifier,
+			       16 ) != 0 ) )
+			{
+				return( 0 );
+			}
+		}
+		if( has_item_match == 0 )
+		{
+			result = libfwsi_internal_filter_match_item(
+			          internal_filter,
+			          &( byte_stream[ byte_stream_offset ] ),
+			          (size_t) shell_item_size,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to match shell item: %d.",
+				 function,
+				 shell_item_index );
+
+				return( -1 );
+			}
+			has_item_match = (uint8_t) result;
+		}
+		byte_stream_offset += shell_item_size;
+
+		shell_item_index++;
+	}
+	if( ( shell_item_index == 0 )
+	 && ( ( internal_filter->flags & LIBFWSI_FILTER_FLAG_HAS_ROOT_FOLDER_IDENTIFIER ) != 0 ) )
+	{
+		return( 0 );
+	}
+	return( (int) has_item_match );
+}
+
+/* Determines if a shell item list in a byte stream matches the filter without copying it
+ * A byte stream that does not contain a valid shell item list does not match
+ * Returns 1 if the shell item list matches, 0 if not or -1 on error
+ */
+int libfwsi_filter_match_byte_stream(
+     libfwsi_filter_t *filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_filter_match_byte_stream";
+	int result            = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_internal_filter_match_byte_stream(
+	          (libfwsi_internal_filter_t *) filter,
+	          byte_stream,
+	          byte_stream_size,
+	          ascii_codepage,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to match shell item list.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
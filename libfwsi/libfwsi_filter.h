@@ -0,0 +1,188 @@
+/*
+ * Item list filter functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_FILTER_H )
+#define _LIBFWSI_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_item_type_registry.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_name_pattern.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The filter flags, which indicate the criteria that are set
+ */
+#define LIBFWSI_FILTER_FLAG_HAS_ITEM_TYPES			0x0001
+#define LIBFWSI_FILTER_FLAG_HAS_CLASS_TYPE			0x0002
+#define LIBFWSI_FILTER_FLAG_HAS_FILE_ATTRIBUTE_FLAGS		0x0004
+#define LIBFWSI_FILTER_FLAG_HAS_MODIFICATION_TIME_RANGE	0x0008
+#define LIBFWSI_FILTER_FLAG_HAS_NAME_PATTERN			0x0010
+#define LIBFWSI_FILTER_FLAG_HAS_ROOT_FOLDER_IDENTIFIER		0x0020
+
+/* The filter flags of the criteria that only file entry items can match
+ */
+#define LIBFWSI_FILTER_FLAGS_FILE_ENTRY \
+	( LIBFWSI_FILTER_FLAG_HAS_FILE_ATTRIBUTE_FLAGS \
+	| LIBFWSI_FILTER_FLAG_HAS_MODIFICATION_TIME_RANGE \
+	| LIBFWSI_FILTER_FLAG_HAS_NAME_PATTERN )
+
+/* The filter flags of the criteria that apply to individual items
+ */
+#define LIBFWSI_FILTER_FLAGS_ITEM \
+	( LIBFWSI_FILTER_FLAG_HAS_ITEM_TYPES \
+	| LIBFWSI_FILTER_FLAG_HAS_CLASS_TYPE \
+	| LIBFWSI_FILTER_FLAGS_FILE_ENTRY )
+
+typedef struct libfwsi_internal_filter libfwsi_internal_filter_t;
+
+struct libfwsi_internal_filter
+{
+	/* The flags
+	 */
+	uint16_t flags;
+
+	/* The bit mask of the built-in item types
+	 */
+	uint32_t item_types_mask;
+
+	/* The user defined item types
+	 */
+	int user_defined_item_types[ LIBFWSI_ITEM_TYPE_REGISTRY_MAXIMUM_NUMBER_OF_REGISTERED_ITEM_TYPES ];
+
+	/* The number of user defined item types
+	 */
+	int number_of_user_defined_item_types;
+
+	/* The class type mask
+	 */
+	uint8_t class_type_mask;
+
+	/* The class type
+	 */
+	uint8_t class_type;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The first modification time, as a FILETIME
+	 */
+	uint64_t first_modification_time;
+
+	/* The last modification time, as a FILETIME
+	 */
+	uint64_t last_modification_time;
+
+	/* The name pattern
+	 */
+	libfwsi_name_pattern_t *name_pattern;
+
+	/* The root folder (shell folder) identifier
+	 */
+	uint8_t root_folder_identifier[ 16 ];
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_initialize(
+     libfwsi_filter_t **filter,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_free(
+     libfwsi_filter_t **filter,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_append_item_type(
+     libfwsi_filter_t *filter,
+     int item_type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_set_class_type_mask(
+     libfwsi_filter_t *filter,
+     uint8_t class_type_mask,
+     uint8_t class_type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_set_file_attribute_flags(
+     libfwsi_filter_t *filter,
+     uint32_t file_attribute_flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_set_modification_time_range(
+     libfwsi_filter_t *filter,
+     uint64_t first_filetime,
+     uint64_t last_filetime,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_set_utf8_name_pattern(
+     libfwsi_filter_t *filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int pattern_type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_set_root_folder_identifier(
+     libfwsi_filter_t *filter,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+int libfwsi_internal_filter_match_item(
+     libfwsi_internal_filter_t *internal_filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwsi_internal_filter_match_byte_stream(
+     libfwsi_internal_filter_t *internal_filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_filter_match_byte_stream(
+     libfwsi_filter_t *filter,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_FILTER_H ) */
+
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_game_folder_values.h"
 #include "libfwsi_libcerror.h"
@@ -133,6 +134,8 @@ int libfwsi_game_folder_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_GAME_FOLDER_PARSER )
+
 /* Reads the game folder values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -251,3 +254,5 @@ int libfwsi_game_folder_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_GAME_FOLDER_PARSER ) */
+
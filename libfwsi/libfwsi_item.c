@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_delegate_values.h"
 #include "libfwsi_cdburn_values.h"
 #include "libfwsi_compressed_folder_values.h"
@@ -34,18 +35,22 @@
 #include "libfwsi_definitions.h"
 #include "libfwsi_extension_block.h"
 #include "libfwsi_file_attributes.h"
+#include "libfwsi_file_entry_extension_values.h"
 #include "libfwsi_file_entry_values.h"
 #include "libfwsi_game_folder_values.h"
 #include "libfwsi_item.h"
-#include "libfwsi_libcdata.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_item_type_registry.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libfdatetime.h"
 #include "libfwsi_libfguid.h"
 #include "libfwsi_libuna.h"
 #include "libfwsi_mtp_file_entry_values.h"
+#include "libfwsi_mtp_property_store.h"
 #include "libfwsi_mtp_volume_values.h"
 #include "libfwsi_network_location_values.h"
+#include "libfwsi_parse_options.h"
 #include "libfwsi_root_folder_values.h"
 #include "libfwsi_shell_folder_identifier.h"
 #include "libfwsi_types.h"
@@ -53,6 +58,7 @@
 #include "libfwsi_uri_values.h"
 #include "libfwsi_uri_sub_values.h"
 #include "libfwsi_users_property_view_values.h"
+#include "libfwsi_values_type.h"
 #include "libfwsi_volume_values.h"
 
 /* Creates an item
@@ -166,20 +172,9 @@ int libfwsi_internal_item_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
-	     &( ( *internal_item )->extension_blocks_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create extension blocks array.",
-		 function );
+	libfwsi_reference_count_initialize(
+	 &( ( *internal_item )->reference_count ) );
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
@@ -193,7 +188,41 @@ on_error:
 	return( -1 );
 }
 
+/* Adds a reference to an item
+ * The item remains available until every reference is released with libfwsi_item_release,
+ * which allows to keep an item of an item list after the item list is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_retain(
+     libfwsi_item_t *item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_retain";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	libfwsi_reference_count_increment(
+	 &( internal_item->reference_count ) );
+
+	return( 1 );
+}
+
 /* Frees an item
+ * An item retrieved from an item list, delegate or another item is managed by its owner,
+ * in which case only the value item is referencing is cleared. Use libfwsi_item_release
+ * to release a reference that was added with libfwsi_item_retain
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_item_free(
@@ -202,7 +231,6 @@ int libfwsi_item_free(
 {
 	libfwsi_internal_item_t *internal_item = NULL;
 	static char *function                  = "libfwsi_item_free";
-	int result                             = 1;
 
 	if( item == NULL )
 	{
@@ -219,8 +247,71 @@ int libfwsi_item_free(
 	{
 		internal_item = (libfwsi_internal_item_t *) *item;
 
-		if( internal_item->is_managed == 0 )
+		if( internal_item->is_managed != 0 )
+		{
+			*item = NULL;
+
+			return( 1 );
+		}
+		if( libfwsi_item_release(
+		     item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release item.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a reference to an item
+ * The item is freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_release(
+     libfwsi_item_t **item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item        = NULL;
+	libfwsi_internal_item_t *internal_parent_item = NULL;
+	static char *function                         = "libfwsi_item_release";
+	int result                                    = 1;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item != NULL )
+	{
+		internal_item = (libfwsi_internal_item_t *) *item;
+		*item         = NULL;
+
+		/* An item references its parent item, which is released iteratively
+		 * so that freeing the last item of a long item list does not recurse
+		 */
+		while( internal_item != NULL )
 		{
+			if( libfwsi_reference_count_decrement(
+			     &( internal_item->reference_count ) ) != 0 )
+			{
+				break;
+			}
+			internal_parent_item       = (libfwsi_internal_item_t *) internal_item->parent_item;
+			internal_item->parent_item = NULL;
+
 			if( libfwsi_internal_item_free(
 			     &internal_item,
 			     error ) != 1 )
@@ -234,21 +325,23 @@ int libfwsi_item_free(
 
 				result = -1;
 			}
+			internal_item = internal_parent_item;
 		}
-		*item = NULL;
 	}
 	return( result );
 }
 
-/* Frees an item
+/* Frees an item regardless of its reference count
+ * The references of the item to its extension blocks and parent item are released
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_internal_item_free(
      libfwsi_internal_item_t **internal_item,
      libcerror_error_t **error )
 {
-	static char *function = "libfwsi_internal_item_free";
-	int result            = 1;
+	static char *function     = "libfwsi_internal_item_free";
+	int extension_block_index = 0;
+	int result                = 1;
 
 	if( internal_item == NULL )
 	{
@@ -282,19 +375,50 @@ int libfwsi_internal_item_free(
 				}
 			}
 		}
-		if( libcdata_array_free(
-		     &( ( *internal_item )->extension_blocks_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_extension_block_free,
-		     error ) != 1 )
+		for( extension_block_index = 0;
+		     extension_block_index < ( *internal_item )->number_of_extension_blocks;
+		     extension_block_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free extension blocks array.",
-			 function );
+			if( libfwsi_extension_block_release(
+			     (libfwsi_extension_block_t **) &( ( *internal_item )->extension_blocks[ extension_block_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release extension block: %d.",
+				 function,
+				 extension_block_index );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_item )->extension_blocks != NULL )
+		{
+			memory_free(
+			 ( *internal_item )->extension_blocks );
+		}
+		if( ( *internal_item )->parent_item != NULL )
+		{
+			if( libfwsi_item_release(
+			     &( ( *internal_item )->parent_item ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release parent item.",
+				 function );
 
-			result = -1;
+				result = -1;
+			}
+		}
+		if( ( *internal_item )->data != NULL )
+		{
+			memory_free(
+			 ( *internal_item )->data );
 		}
 		memory_free(
 		 *internal_item );
@@ -313,16 +437,52 @@ int libfwsi_item_copy_from_byte_stream(
      size_t byte_stream_size,
      int ascii_codepage,
      libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_copy_from_byte_stream";
+
+	if( libfwsi_internal_item_copy_from_byte_stream(
+	     item,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to item.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a shell item from a byte stream
+ * The parse options can be NULL in which case no limits are applied
+ * Limit exceeded of the parse options is set if the number of extension blocks exceeds the maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_copy_from_byte_stream(
+     libfwsi_item_t *item,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_internal_parse_options_t *parse_options,
+     libcerror_error_t **error )
 {
         libfwsi_internal_extension_block_t *extension_block = NULL;
 	libfwsi_internal_item_t *internal_item              = NULL;
 	libfwsi_internal_item_t *internal_parent_item       = NULL;
-	static char *function                               = "libfwsi_item_copy_from_byte_stream";
+	const libfwsi_item_type_definition_t *definition    = NULL;
+	static char *function                               = "libfwsi_internal_item_copy_from_byte_stream";
 	size_t byte_stream_offset                           = 0;
 	size_t shell_item_data_size                         = 0;
 	uint32_t signature                                  = 0;
 	uint16_t first_extension_block_offset               = 0;
-	int entry_index                                     = 0;
+	int parent_item_type                                = LIBFWSI_ITEM_TYPE_UNKNOWN;
 	int result                                          = 0;
 
 	if( item == NULL )
@@ -414,7 +574,7 @@ int libfwsi_item_copy_from_byte_stream(
 		return( 1 );
 	}
 	if( ( internal_item->data_size < 4 )
-	 && ( (size_t) internal_item->data_size > byte_stream_size ) )
+	 || ( (size_t) internal_item->data_size > byte_stream_size ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -425,6 +585,39 @@ int libfwsi_item_copy_from_byte_stream(
 
 		goto on_error;
 	}
+	internal_item->data_fingerprint = libfwsi_item_list_calculate_item_fingerprint(
+	                                   byte_stream,
+	                                   (size_t) internal_item->data_size );
+
+	internal_item->data = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * (size_t) internal_item->data_size );
+
+	if( internal_item->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_item->data,
+	     byte_stream,
+	     (size_t) internal_item->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -451,164 +644,75 @@ int libfwsi_item_copy_from_byte_stream(
 
 		goto on_error;
 	}
-	if( ( internal_item->type == 0 )
-	 && ( internal_item->data_size >= 8 ) )
+	if( internal_item->type == 0 )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ 4 ] ),
-		 signature );
-
-		switch( signature )
+		if( libfwsi_item_type_registry_classify(
+		     byte_stream,
+		     (size_t) internal_item->data_size,
+		     &( internal_item->type ),
+		     &( internal_item->class_type ),
+		     &signature,
+		     error ) != 1 )
 		{
-			case 0x39de2184UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY;
-				break;
-
-			/* "AugM" */
-			case 0x4d677541UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CDBURN;
-				break;
-
-			/* "GFSI" */
-			case 0x49534647UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_GAME_FOLDER;
-				break;
-
-			case 0xffffff38UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE;
-				break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to classify shell item.",
+			 function );
 
-			default:
-				break;
+			goto on_error;
 		}
 	}
-	if( ( internal_item->type == 0 )
-	 && ( internal_item->data_size >= 10 ) )
+	if( internal_parent_item != NULL )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ 6 ] ),
-		 signature );
-
-		switch( signature )
-		{
-			case 0x07192006UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY;
-				break;
-
-			case 0x10312005UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_MTP_VOLUME;
-				break;
-
-			case 0x10141981UL:
-			case 0x23a3dfd5UL:
-			case 0x23febbeeUL:
-			case 0x3b93afbbUL:
-			case 0xbeebee00UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW;
-				break;
-
-			case 0x46534643UL:
-				internal_item->type = LIBFWSI_ITEM_TYPE_UNKNOWN_0x74;
-				break;
-
-			default:
-				break;
-		}
+		parent_item_type = internal_parent_item->type;
 	}
-	if( ( internal_item->type == 0 )
-	 && ( internal_item->data_size >= 38 ) )
+	if( libfwsi_item_type_registry_get_definition(
+	     internal_item->type,
+	     parent_item_type,
+	     &definition,
+	     error ) != 1 )
 	{
-		if( memory_compare(
-		     &( byte_stream[ internal_item->data_size - 32 ] ),
-		     libfwsi_delegate_item_identifier,
-		     16 ) == 0 )
-		{
-			internal_item->type = LIBFWSI_ITEM_TYPE_DELEGATE;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item type definition.",
+		 function );
+
+		goto on_error;
 	}
-	if( ( internal_item->type == 0 )
-	 && ( internal_item->data_size >= 3 ) )
+	if( definition != NULL )
 	{
-		internal_item->class_type = byte_stream[ 2 ];
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: class type indicator\t\t: 0x%02" PRIx8 "\n",
-			 function,
-			 internal_item->class_type );
-		}
-#endif
-		switch( internal_item->class_type & 0x70 )
+		if( ( definition->flags & LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE ) != 0 )
 		{
-			case 0x10:
-				if( internal_item->class_type == 0x1f )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_ROOT_FOLDER;
-				}
-				break;
-
-			case 0x20:
-				internal_item->type = LIBFWSI_ITEM_TYPE_VOLUME;
-				break;
-
-			case 0x30:
-				internal_item->type = LIBFWSI_ITEM_TYPE_FILE_ENTRY;
-				break;
-
-			case 0x40:
-				internal_item->type = LIBFWSI_ITEM_TYPE_NETWORK_LOCATION;
-				break;
-
-			case 0x50:
-				if( internal_item->class_type == 0x52 )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER;
-				}
-				break;
-
-			case 0x60:
-				if( internal_item->class_type == 0x61 )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_URI;
-				}
-				break;
-	
-			case 0x70:
-				if( internal_item->class_type == 0x71 )
-				{
-					internal_item->type = LIBFWSI_ITEM_TYPE_CONTROL_PANEL;
-				}
-				break;
-
-			default:
-				break;
+			internal_item->signature = signature;
 		}
-	}
-	if( ( internal_parent_item != NULL )
-	 && ( internal_parent_item->type == LIBFWSI_ITEM_TYPE_URI ) )
-	{
-		internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_sub_values_free;
+		internal_item->free_value  = definition->free_values;
+		internal_item->value_size  = definition->values_size;
+		internal_item->values_type = definition->values_type;
 
-		if( libfwsi_uri_sub_values_initialize(
-		     (libfwsi_uri_sub_values_t **) &( internal_item->value ),
+		if( definition->initialize_values(
+		     &( internal_item->value ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create URI sub values.",
-			 function );
+			 "%s: unable to create %s values.",
+			 function,
+			 definition->name );
 
 			goto on_error;
 		}
-		result = libfwsi_uri_sub_values_read_data(
-		          (libfwsi_uri_sub_values_t *) internal_item->value,
+		result = definition->read_values(
+		          internal_item->value,
 		          byte_stream,
 		          internal_item->data_size,
 		          ascii_codepage,
+		          (libfwsi_parse_options_t *) parse_options,
 		          error );
 
 		if( result == -1 )
@@ -617,726 +721,808 @@ int libfwsi_item_copy_from_byte_stream(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read URI sub values.",
-			 function );
+			 "%s: unable to read %s values.",
+			 function,
+			 definition->name );
 
 			goto on_error;
 		}
 	}
-	else switch( internal_item->type )
+	if( result == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported shell item type.\n",
+			 function );
+		}
+#endif
+		internal_item->type       = LIBFWSI_ITEM_TYPE_UNKNOWN;
+		internal_item->class_type = 0;
+		internal_item->signature  = 0;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ internal_item->data_size - 2 ] ),
+	 first_extension_block_offset );
+
+	if( ( first_extension_block_offset >= 4 )
+	 && ( first_extension_block_offset < ( internal_item->data_size - 2 ) ) )
 	{
-		case LIBFWSI_ITEM_TYPE_CDBURN:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_cdburn_values_free;
+		byte_stream_offset   = (size_t) first_extension_block_offset;
+		shell_item_data_size = internal_item->data_size - byte_stream_offset;
 
-			if( libfwsi_cdburn_values_initialize(
-			     (libfwsi_cdburn_values_t **) &( internal_item->value ),
+		while( shell_item_data_size > 2 )
+		{
+			if( libfwsi_extension_block_initialize(
+			     (libfwsi_extension_block_t **) &extension_block,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create CD burn values.",
+				 "%s: unable to create extension block.",
 				 function );
 
 				goto on_error;
 			}
-			result = libfwsi_cdburn_values_read_data(
-			          (libfwsi_cdburn_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
+			result = libfwsi_extension_block_copy_from_byte_stream(
+				  extension_block,
+				  &( byte_stream[ byte_stream_offset ] ),
+				  shell_item_data_size,
+				  ascii_codepage,
+				  error );
 
 			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read CD burn values.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to extension block.",
 				 function );
 
 				goto on_error;
 			}
-			break;
-
-		case LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_compressed_folder_values_free;
-
-			if( libfwsi_compressed_folder_values_initialize(
-			     (libfwsi_compressed_folder_values_t **) &( internal_item->value ),
-			     error ) != 1 )
+			else if( result == 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create compressed folder values.",
-				 function );
-
-				goto on_error;
+				break;
 			}
-			result = libfwsi_compressed_folder_values_read_data(
-			          (libfwsi_compressed_folder_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
+			byte_stream_offset   += extension_block->data_size;
+			shell_item_data_size -= extension_block->data_size;
 
-			if( result == -1 )
+			if( extension_block->data_size == 2 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read compressed folder values.",
-				 function );
-
-				goto on_error;
+				break;
 			}
-			break;
-
-		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_values_free;
-
-			if( libfwsi_control_panel_values_initialize(
-			     (libfwsi_control_panel_values_t **) &( internal_item->value ),
-			     error ) != 1 )
+			if( extension_block->is_skipped != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create control panel values.",
-				 function );
+				if( libfwsi_internal_extension_block_free(
+				     &extension_block,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free extension block.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
+				continue;
 			}
-			result = libfwsi_control_panel_values_read_data(
-			          (libfwsi_control_panel_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
-
-			if( result == -1 )
+			if( ( parse_options != NULL )
+			 && ( parse_options->maximum_number_of_extension_blocks != 0 )
+			 && ( internal_item->number_of_extension_blocks >= parse_options->maximum_number_of_extension_blocks ) )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read control panel values.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: number of extension blocks value exceeds maximum.",
 				 function );
 
+				parse_options->limit_exceeded = 1;
+
 				goto on_error;
 			}
-			break;
-
-		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_category_values_free;
-
-			if( libfwsi_control_panel_category_values_initialize(
-			     (libfwsi_control_panel_category_values_t **) &( internal_item->value ),
+			if( libfwsi_internal_item_append_extension_block(
+			     internal_item,
+			     extension_block,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create control panel category values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_control_panel_category_values_read_data(
-			          (libfwsi_control_panel_category_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read control panel category values.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extension block.",
 				 function );
 
 				goto on_error;
 			}
-			break;
-
-		case LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_cpl_file_values_free;
-
-			if( libfwsi_control_panel_cpl_file_values_initialize(
-			     (libfwsi_control_panel_cpl_file_values_t **) &( internal_item->value ),
+			extension_block = NULL;
+		}
+		if( extension_block != NULL )
+		{
+			if( libfwsi_internal_extension_block_free(
+			     &extension_block,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create control panel CPL file values.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extension block.",
 				 function );
 
 				goto on_error;
 			}
-			result = libfwsi_control_panel_cpl_file_values_read_data(
-			          (libfwsi_control_panel_cpl_file_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
-
-			if( result == -1 )
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( shell_item_data_size > 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read control panel CPL file values.",
+				libcnotify_printf(
+				 "%s: trailing data:\n",
 				 function );
-
-				goto on_error;
+				libcnotify_print_data(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 shell_item_data_size,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 			}
-			break;
+		}
+#endif
+	}
+	internal_item->ascii_codepage = ascii_codepage;
 
-		case LIBFWSI_ITEM_TYPE_DELEGATE:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_delegate_values_free;
+	return( 1 );
 
-			if( libfwsi_delegate_values_initialize(
-			     (libfwsi_delegate_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create delegate values.",
-				 function );
+on_error:
+	if( extension_block != NULL )
+	{
+		libfwsi_internal_extension_block_free(
+		 &extension_block,
+		 NULL );
+	}
+	if( ( internal_item->value != NULL )
+	 && ( internal_item->free_value != NULL ) )
+	{
+		internal_item->free_value(
+		 &( internal_item->value ),
+		 NULL );
+	}
+	if( internal_item->data != NULL )
+	{
+		memory_free(
+		 internal_item->data );
 
-				goto on_error;
-			}
-			result = libfwsi_delegate_values_read_data(
-			          (libfwsi_delegate_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
+		internal_item->data = NULL;
+	}
+	return( -1 );
+}
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read delegate values.",
-				 function );
+/* Validates a shell item in a byte stream without copying it
+ * Applies the same bounds checks as libfwsi_item_copy_from_byte_stream
+ * including those of the extension blocks, but does not read the item values
+ * Returns 1 if valid or 0 if not
+ */
+int libfwsi_item_validate_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t flags )
+{
+	size_t byte_stream_offset             = 0;
+	size_t shell_item_data_size           = 0;
+	uint16_t data_size                    = 0;
+	uint16_t extension_block_data_size    = 0;
+	uint16_t first_extension_block_offset = 0;
+	int result                            = 0;
 
-				goto on_error;
-			}
-			break;
+	if( byte_stream_size < 2 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 byte_stream,
+	 data_size );
 
-		case LIBFWSI_ITEM_TYPE_FILE_ENTRY:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_values_free;
+	if( ( data_size < 4 )
+	 || ( (size_t) data_size > byte_stream_size ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ data_size - 2 ] ),
+	 first_extension_block_offset );
 
-			if( libfwsi_file_entry_values_initialize(
-			     (libfwsi_file_entry_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create file entry values.",
-				 function );
+	if( ( first_extension_block_offset >= 4 )
+	 && ( first_extension_block_offset < ( data_size - 2 ) ) )
+	{
+		byte_stream_offset   = (size_t) first_extension_block_offset;
+		shell_item_data_size = data_size - byte_stream_offset;
 
-				goto on_error;
-			}
-			result = libfwsi_file_entry_values_read_data(
-			          (libfwsi_file_entry_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          ascii_codepage,
-			          error );
+		while( shell_item_data_size > 2 )
+		{
+			result = libfwsi_extension_block_validate_byte_stream(
+			          &( byte_stream[ byte_stream_offset ] ),
+			          shell_item_data_size,
+			          &extension_block_data_size );
 
 			if( result == -1 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read file entry values.",
-				 function );
-
-				goto on_error;
+				return( 0 );
 			}
-			break;
-
-		case LIBFWSI_ITEM_TYPE_GAME_FOLDER:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_game_folder_values_free;
-
-			if( libfwsi_game_folder_values_initialize(
-			     (libfwsi_game_folder_values_t **) &( internal_item->value ),
-			     error ) != 1 )
+			else if( result == 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create game folder values.",
-				 function );
-
-				goto on_error;
+				if( ( flags & LIBFWSI_VALIDATE_FLAG_STRICT_EXTENSION_BLOCKS ) != 0 )
+				{
+					return( 0 );
+				}
+				break;
 			}
-			result = libfwsi_game_folder_values_read_data(
-			          (libfwsi_game_folder_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
+			byte_stream_offset   += extension_block_data_size;
+			shell_item_data_size -= extension_block_data_size;
 
-			if( result == -1 )
+			if( extension_block_data_size == 2 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read game folder values.",
-				 function );
-
-				goto on_error;
+				break;
 			}
-			break;
+		}
+	}
+	return( 1 );
+}
 
-		case LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_file_entry_values_free;
+/* Appends an extension block to the item
+ * The item takes over management of the extension block
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_append_extension_block(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_internal_extension_block_t *extension_block,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_extension_block_t **extension_blocks = NULL;
+	static char *function                                 = "libfwsi_internal_item_append_extension_block";
+	size_t extension_blocks_size                          = 0;
+	int number_of_allocated_extension_blocks              = 0;
 
-			if( libfwsi_mtp_file_entry_values_initialize(
-			     (libfwsi_mtp_file_entry_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create MTP file entry values.",
-				 function );
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
 
-				goto on_error;
-			}
-			result = libfwsi_mtp_file_entry_values_read_data(
-			          (libfwsi_mtp_file_entry_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
+		return( -1 );
+	}
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read MTP file entry values.",
-				 function );
+		return( -1 );
+	}
+	if( internal_item->number_of_extension_blocks >= internal_item->number_of_allocated_extension_blocks )
+	{
+		/* An item is at most 64 KiB hence the number of extension blocks cannot overflow
+		 */
+		number_of_allocated_extension_blocks = internal_item->number_of_allocated_extension_blocks * 2;
 
-				goto on_error;
-			}
-			break;
+		if( number_of_allocated_extension_blocks == 0 )
+		{
+			number_of_allocated_extension_blocks = 4;
+		}
+		extension_blocks_size = sizeof( libfwsi_internal_extension_block_t * ) * (size_t) number_of_allocated_extension_blocks;
 
-		case LIBFWSI_ITEM_TYPE_MTP_VOLUME:
-			internal_item->signature  = signature;
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_volume_values_free;
+		extension_blocks = (libfwsi_internal_extension_block_t **) memory_reallocate(
+		                                                            internal_item->extension_blocks,
+		                                                            extension_blocks_size );
 
-			if( libfwsi_mtp_volume_values_initialize(
-			     (libfwsi_mtp_volume_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create MTP volume values.",
-				 function );
+		if( extension_blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extension blocks.",
+			 function );
 
-				goto on_error;
-			}
-			result = libfwsi_mtp_volume_values_read_data(
-			          (libfwsi_mtp_volume_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          error );
+			return( -1 );
+		}
+		internal_item->extension_blocks                     = extension_blocks;
+		internal_item->number_of_allocated_extension_blocks = number_of_allocated_extension_blocks;
+	}
+	internal_item->extension_blocks[ internal_item->number_of_extension_blocks ] = extension_block;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read MTP volume values.",
-				 function );
+	internal_item->number_of_extension_blocks += 1;
 
-				goto on_error;
-			}
-			break;
+	return( 1 );
+}
 
-		case LIBFWSI_ITEM_TYPE_NETWORK_LOCATION:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_network_location_values_free;
+/* Compares two byte sequences, where a NULL byte sequence is considered empty
+ * The bytes are compared in order and a byte sequence that is a prefix of the other comes first
+ * Returns LIBFWSI_COMPARE_LESS, LIBFWSI_COMPARE_EQUAL or LIBFWSI_COMPARE_GREATER
+ */
+int libfwsi_item_compare_data(
+     const uint8_t *first_data,
+     size_t first_data_size,
+     const uint8_t *second_data,
+     size_t second_data_size )
+{
+	size_t compare_size = 0;
+	int result          = 0;
 
-			if( libfwsi_network_location_values_initialize(
-			     (libfwsi_network_location_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create network location values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_network_location_values_read_data(
-			          (libfwsi_network_location_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          ascii_codepage,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read network location values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case LIBFWSI_ITEM_TYPE_ROOT_FOLDER:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_root_folder_values_free;
-
-			if( libfwsi_root_folder_values_initialize(
-			     (libfwsi_root_folder_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create root folder values.",
-				 function );
-
-				goto on_error;
-			}
-			result = libfwsi_root_folder_values_read_data(
-				  (libfwsi_root_folder_values_t *) internal_item->value,
-				  byte_stream,
-				  internal_item->data_size,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read root folder values.",
-				 function );
-
-				goto on_error;
-			}
-			break;
-
-		case LIBFWSI_ITEM_TYPE_URI:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_values_free;
+	if( first_data == NULL )
+	{
+		first_data_size = 0;
+	}
+	if( second_data == NULL )
+	{
+		second_data_size = 0;
+	}
+	compare_size = first_data_size;
 
-			if( libfwsi_uri_values_initialize(
-			     (libfwsi_uri_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create URI values.",
-				 function );
+	if( second_data_size < compare_size )
+	{
+		compare_size = second_data_size;
+	}
+	if( compare_size > 0 )
+	{
+		result = memory_compare(
+		          first_data,
+		          second_data,
+		          compare_size );
 
-				goto on_error;
-			}
-			result = libfwsi_uri_values_read_data(
-			          (libfwsi_uri_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          ascii_codepage,
-			          error );
+		if( result < 0 )
+		{
+			return( LIBFWSI_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBFWSI_COMPARE_GREATER );
+		}
+	}
+	if( first_data_size < second_data_size )
+	{
+		return( LIBFWSI_COMPARE_LESS );
+	}
+	else if( first_data_size > second_data_size )
+	{
+		return( LIBFWSI_COMPARE_GREATER );
+	}
+	return( LIBFWSI_COMPARE_EQUAL );
+}
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read URI values.",
-				 function );
+/* Compares two integer values
+ * Returns LIBFWSI_COMPARE_LESS, LIBFWSI_COMPARE_EQUAL or LIBFWSI_COMPARE_GREATER
+ */
+int libfwsi_item_compare_integer(
+     uint64_t first_value,
+     uint64_t second_value )
+{
+	if( first_value < second_value )
+	{
+		return( LIBFWSI_COMPARE_LESS );
+	}
+	else if( first_value > second_value )
+	{
+		return( LIBFWSI_COMPARE_GREATER );
+	}
+	return( LIBFWSI_COMPARE_EQUAL );
+}
 
-				goto on_error;
-			}
-			break;
+/* Retrieves the file entry extension values of the first file entry extension block (0xbeef0004)
+ * Returns the file entry extension values or NULL if not available
+ */
+libfwsi_file_entry_extension_values_t *libfwsi_internal_item_get_file_entry_extension_values(
+                                        libfwsi_internal_item_t *internal_item )
+{
+	libfwsi_internal_extension_block_t *internal_extension_block = NULL;
+	int extension_block_index                                    = 0;
 
-		case LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_users_property_view_values_free;
+	for( extension_block_index = 0;
+	     extension_block_index < internal_item->number_of_extension_blocks;
+	     extension_block_index++ )
+	{
+		internal_extension_block = internal_item->extension_blocks[ extension_block_index ];
 
-			if( libfwsi_users_property_view_values_initialize(
-			     (libfwsi_users_property_view_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create users property view values.",
-				 function );
+		if( ( internal_extension_block != NULL )
+		 && ( internal_extension_block->values_type == LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION )
+		 && ( internal_extension_block->value != NULL ) )
+		{
+			return( (libfwsi_file_entry_extension_values_t *) internal_extension_block->value );
+		}
+	}
+	return( NULL );
+}
 
-				goto on_error;
-			}
-			result = libfwsi_users_property_view_values_read_data(
-			          (libfwsi_users_property_view_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          ascii_codepage,
-			          error );
+/* Compares two items on their data
+ * The size and fingerprint of the data are compared first as an early exit
+ * Returns LIBFWSI_COMPARE_LESS, LIBFWSI_COMPARE_EQUAL or LIBFWSI_COMPARE_GREATER
+ */
+int libfwsi_internal_item_compare_item_data(
+     libfwsi_internal_item_t *first_internal_item,
+     libfwsi_internal_item_t *second_internal_item )
+{
+	int result = 0;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read users property view values.",
-				 function );
+	result = libfwsi_item_compare_integer(
+	          (uint64_t) first_internal_item->data_size,
+	          (uint64_t) second_internal_item->data_size );
 
-				goto on_error;
-			}
-			break;
+	if( result == LIBFWSI_COMPARE_EQUAL )
+	{
+		result = libfwsi_item_compare_integer(
+		          first_internal_item->data_fingerprint,
+		          second_internal_item->data_fingerprint );
+	}
+	if( result == LIBFWSI_COMPARE_EQUAL )
+	{
+		result = libfwsi_item_compare_data(
+		          first_internal_item->data,
+		          (size_t) first_internal_item->data_size,
+		          second_internal_item->data,
+		          (size_t) second_internal_item->data_size );
+	}
+	return( result );
+}
 
-		case LIBFWSI_ITEM_TYPE_VOLUME:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_volume_values_free;
+/* Compares the values of two items of the same type
+ * Items without values, with values of different values types or with values
+ * that have no canonical fields are compared on their data
+ * Returns LIBFWSI_COMPARE_LESS, LIBFWSI_COMPARE_EQUAL or LIBFWSI_COMPARE_GREATER
+ */
+int libfwsi_internal_item_compare_values(
+     libfwsi_internal_item_t *first_internal_item,
+     libfwsi_internal_item_t *second_internal_item )
+{
+	libfwsi_delegate_values_t *first_delegate_values                        = NULL;
+	libfwsi_delegate_values_t *second_delegate_values                       = NULL;
+	libfwsi_file_entry_values_t *first_file_entry_values                    = NULL;
+	libfwsi_file_entry_values_t *second_file_entry_values                   = NULL;
+	libfwsi_mtp_volume_values_t *first_mtp_volume_values                    = NULL;
+	libfwsi_mtp_volume_values_t *second_mtp_volume_values                   = NULL;
+	libfwsi_network_location_values_t *first_network_location_values        = NULL;
+	libfwsi_network_location_values_t *second_network_location_values       = NULL;
+	libfwsi_root_folder_values_t *first_root_folder_values                  = NULL;
+	libfwsi_root_folder_values_t *second_root_folder_values                 = NULL;
+	libfwsi_uri_values_t *first_uri_values                                  = NULL;
+	libfwsi_uri_values_t *second_uri_values                                 = NULL;
+	libfwsi_users_property_view_values_t *first_users_property_view_values  = NULL;
+	libfwsi_users_property_view_values_t *second_users_property_view_values = NULL;
+	libfwsi_volume_values_t *first_volume_values                            = NULL;
+	libfwsi_volume_values_t *second_volume_values                           = NULL;
+	int result                                                              = LIBFWSI_COMPARE_EQUAL;
+
+	if( first_internal_item->value == NULL )
+	{
+		if( second_internal_item->value == NULL )
+		{
+			return( libfwsi_internal_item_compare_item_data(
+			         first_internal_item,
+			         second_internal_item ) );
+		}
+		return( LIBFWSI_COMPARE_LESS );
+	}
+	else if( second_internal_item->value == NULL )
+	{
+		return( LIBFWSI_COMPARE_GREATER );
+	}
+	/* Values of different values types have no canonical fields in common
+	 */
+	if( first_internal_item->values_type != second_internal_item->values_type )
+	{
+		return( libfwsi_internal_item_compare_item_data(
+		         first_internal_item,
+		         second_internal_item ) );
+	}
+	if( first_internal_item->values_type == LIBFWSI_VALUES_TYPE_FILE_ENTRY )
+	{
+		first_file_entry_values  = (libfwsi_file_entry_values_t *) first_internal_item->value;
+		second_file_entry_values = (libfwsi_file_entry_values_t *) second_internal_item->value;
 
-			if( libfwsi_volume_values_initialize(
-			     (libfwsi_volume_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create volume values.",
-				 function );
+		result = libfwsi_item_compare_integer(
+		          first_file_entry_values->is_unicode,
+		          second_file_entry_values->is_unicode );
 
-				goto on_error;
-			}
-			result = libfwsi_volume_values_read_data(
-			          (libfwsi_volume_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          ascii_codepage,
-			          error );
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_data(
+			          first_file_entry_values->name,
+			          first_file_entry_values->name_size,
+			          second_file_entry_values->name,
+			          second_file_entry_values->name_size );
+		}
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_integer(
+			          first_file_entry_values->modification_time,
+			          second_file_entry_values->modification_time );
+		}
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_integer(
+			          first_file_entry_values->file_size,
+			          second_file_entry_values->file_size );
+		}
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_integer(
+			          first_file_entry_values->file_attribute_flags,
+			          second_file_entry_values->file_attribute_flags );
+		}
+	}
+	else if( first_internal_item->values_type == LIBFWSI_VALUES_TYPE_ROOT_FOLDER )
+	{
+		first_root_folder_values  = (libfwsi_root_folder_values_t *) first_internal_item->value;
+		second_root_folder_values = (libfwsi_root_folder_values_t *) second_internal_item->value;
+
+		result = libfwsi_item_compare_data(
+		          first_root_folder_values->shell_folder_identifier,
+		          16,
+		          second_root_folder_values->shell_folder_identifier,
+		          16 );
+	}
+	else if( first_internal_item->values_type == LIBFWSI_VALUES_TYPE_VOLUME )
+	{
+		first_volume_values  = (libfwsi_volume_values_t *) first_internal_item->value;
+		second_volume_values = (libfwsi_volume_values_t *) second_internal_item->value;
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read volume values.",
-				 function );
+		result = libfwsi_item_compare_data(
+		          first_volume_values->name,
+		          first_volume_values->name_size,
+		          second_volume_values->name,
+		          second_volume_values->name_size );
 
-				goto on_error;
-			}
-			break;
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_data(
+			          first_volume_values->identifier,
+			          16,
+			          second_volume_values->identifier,
+			          16 );
+		}
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_data(
+			          first_volume_values->shell_folder_identifier,
+			          16,
+			          second_volume_values->shell_folder_identifier,
+			          16 );
+		}
+	}
+	else if( first_internal_item->values_type == LIBFWSI_VALUES_TYPE_DELEGATE )
+	{
+		first_delegate_values  = (libfwsi_delegate_values_t *) first_internal_item->value;
+		second_delegate_values = (libfwsi_delegate_values_t *) second_internal_item->value;
 
-		case LIBFWSI_ITEM_TYPE_UNKNOWN_0x74:
-			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_unknown_0x74_values_free;
+		result = libfwsi_item_compare_data(
+		          first_delegate_values->class_identifier,
+		          16,
+		          second_delegate_values->class_identifier,
+		          16 );
 
-			if( libfwsi_unknown_0x74_values_initialize(
-			     (libfwsi_unknown_0x74_values_t **) &( internal_item->value ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create unknown 0x74 values.",
-				 function );
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_internal_item_compare(
+			          (libfwsi_internal_item_t *) first_delegate_values->embedded_item,
+			          (libfwsi_internal_item_t *) second_delegate_values->embedded_item );
+		}
+	}
+	else if( first_internal_item->values_type == LIBFWSI_VALUES_TYPE_NETWORK_LOCATION )
+	{
+		first_network_location_values  = (libfwsi_network_location_values_t *) first_internal_item->value;
+		second_network_location_values = (libfwsi_network_location_values_t *) second_internal_item->value;
 
-				goto on_error;
-			}
-			result = libfwsi_unknown_0x74_values_read_data(
-			          (libfwsi_unknown_0x74_values_t *) internal_item->value,
-			          byte_stream,
-			          internal_item->data_size,
-			          ascii_codepage,
-			          error );
+		result = libfwsi_item_compare_data(
+		          first_network_location_values->location,
+		          first_network_location_values->location_size,
+		          second_network_location_values->location,
+		          second_network_location_values->location_size );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read unknown 0x74 values.",
-				 function );
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_data(
+			          first_network_location_values->description,
+			          first_network_location_values->description_size,
+			          second_network_location_values->description,
+			          second_network_location_values->description_size );
+		}
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_data(
+			          first_network_location_values->comments,
+			          first_network_location_values->comments_size,
+			          second_network_location_values->comments,
+			          second_network_location_values->comments_size );
+		}
+	}
+	else if( first_internal_item->values_type == LIBFWSI_VALUES_TYPE_URI )
+	{
+		first_uri_values  = (libfwsi_uri_values_t *) first_internal_item->value;
+		second_uri_values = (libfwsi_uri_values_t *) second_internal_item->value;
+
+		result = libfwsi_item_compare_data(
+		          first_uri_values->string_data,
+		          first_uri_values->string_data_size,
+		          second_uri_values->string_data,
+		          second_uri_values->string_data_size );
+	}
+	else if( first_internal_item->values_type == LIBFWSI_VALUES_TYPE_MTP_VOLUME )
+	{
+		first_mtp_volume_values  = (libfwsi_mtp_volume_values_t *) first_internal_item->value;
+		second_mtp_volume_values = (libfwsi_mtp_volume_values_t *) second_internal_item->value;
 
-				goto on_error;
-			}
-			break;
+		result = libfwsi_item_compare_data(
+		          first_mtp_volume_values->storage_name,
+		          first_mtp_volume_values->storage_name_size,
+		          second_mtp_volume_values->storage_name,
+		          second_mtp_volume_values->storage_name_size );
 
-		case LIBFWSI_ITEM_TYPE_UNKNOWN:
-		default:
-			break;
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_data(
+			          first_mtp_volume_values->volume_identifier,
+			          first_mtp_volume_values->volume_identifier_size,
+			          second_mtp_volume_values->volume_identifier,
+			          second_mtp_volume_values->volume_identifier_size );
+		}
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_data(
+			          first_mtp_volume_values->file_system_name,
+			          first_mtp_volume_values->file_system_name_size,
+			          second_mtp_volume_values->file_system_name,
+			          second_mtp_volume_values->file_system_name_size );
+		}
 	}
-	if( result == 0 )
+	else if( first_internal_item->values_type == LIBFWSI_VALUES_TYPE_USERS_PROPERTY_VIEW )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		first_users_property_view_values  = (libfwsi_users_property_view_values_t *) first_internal_item->value;
+		second_users_property_view_values = (libfwsi_users_property_view_values_t *) second_internal_item->value;
+
+		result = libfwsi_item_compare_integer(
+		          first_users_property_view_values->has_known_folder_identifier,
+		          second_users_property_view_values->has_known_folder_identifier );
+
+		if( ( result == LIBFWSI_COMPARE_EQUAL )
+		 && ( first_users_property_view_values->has_known_folder_identifier != 0 ) )
 		{
-			libcnotify_printf(
-			 "%s: unsupported shell item type.\n",
-			 function );
+			result = libfwsi_item_compare_data(
+			          first_users_property_view_values->known_folder_identifier,
+			          16,
+			          second_users_property_view_values->known_folder_identifier,
+			          16 );
+		}
+		if( result == LIBFWSI_COMPARE_EQUAL )
+		{
+			result = libfwsi_item_compare_data(
+			          first_users_property_view_values->property_store_data,
+			          first_users_property_view_values->property_store_data_size,
+			          second_users_property_view_values->property_store_data,
+			          second_users_property_view_values->property_store_data_size );
 		}
-#endif
-		internal_item->type       = LIBFWSI_ITEM_TYPE_UNKNOWN;
-		internal_item->class_type = 0;
-		internal_item->signature  = 0;
 	}
-	byte_stream_copy_to_uint16_little_endian(
-	 &( byte_stream[ internal_item->data_size - 2 ] ),
-	 first_extension_block_offset );
-
-	if( ( first_extension_block_offset >= 4 )
-	 && ( first_extension_block_offset < ( internal_item->data_size - 2 ) ) )
+	else
 	{
-		byte_stream_offset   = (size_t) first_extension_block_offset;
-		shell_item_data_size = internal_item->data_size - byte_stream_offset;
+		result = libfwsi_internal_item_compare_item_data(
+		          first_internal_item,
+		          second_internal_item );
+	}
+	return( result );
+}
 
-		while( shell_item_data_size > 2 )
-		{
-			if( libfwsi_extension_block_initialize(
-			     (libfwsi_extension_block_t **) &extension_block,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create extension block.",
-				 function );
+/* Compares two items on their canonical fields
+ * The items are ordered by type, class type, the names, identifiers (GUIDs) and times of their
+ * values, or their data if the values have no canonical fields, and the long name, times and
+ * file reference of their file entry extension block (0xbeef0004)
+ * The comparison stops at the first field that differs and a NULL item comes first
+ * Returns LIBFWSI_COMPARE_LESS, LIBFWSI_COMPARE_EQUAL or LIBFWSI_COMPARE_GREATER
+ */
+int libfwsi_internal_item_compare(
+     libfwsi_internal_item_t *first_internal_item,
+     libfwsi_internal_item_t *second_internal_item )
+{
+	libfwsi_file_entry_extension_values_t *first_extension_values  = NULL;
+	libfwsi_file_entry_extension_values_t *second_extension_values = NULL;
+	int result                                                     = 0;
 
-				goto on_error;
-			}
-			result = libfwsi_extension_block_copy_from_byte_stream(
-				  extension_block,
-				  &( byte_stream[ byte_stream_offset ] ),
-				  shell_item_data_size,
-				  ascii_codepage,
-				  error );
+	if( first_internal_item == second_internal_item )
+	{
+		return( LIBFWSI_COMPARE_EQUAL );
+	}
+	if( first_internal_item == NULL )
+	{
+		return( LIBFWSI_COMPARE_LESS );
+	}
+	if( second_internal_item == NULL )
+	{
+		return( LIBFWSI_COMPARE_GREATER );
+	}
+	result = libfwsi_item_compare_integer(
+	          (uint64_t) first_internal_item->type,
+	          (uint64_t) second_internal_item->type );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to extension block.",
-				 function );
+	if( result != LIBFWSI_COMPARE_EQUAL )
+	{
+		return( result );
+	}
+	result = libfwsi_item_compare_integer(
+	          first_internal_item->class_type,
+	          second_internal_item->class_type );
 
-				goto on_error;
-			}
-			else if( result == 0 )
-			{
-				break;
-			}
-			byte_stream_offset   += extension_block->data_size;
-			shell_item_data_size -= extension_block->data_size;
+	if( result != LIBFWSI_COMPARE_EQUAL )
+	{
+		return( result );
+	}
+	result = libfwsi_internal_item_compare_values(
+	          first_internal_item,
+	          second_internal_item );
 
-			if( extension_block->data_size == 2 )
-			{
-				break;
-			}
-			if( libcdata_array_append_entry(
-			     internal_item->extension_blocks_array,
-			     &entry_index,
-			     (intptr_t *) extension_block,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append extension block.",
-				 function );
+	if( result != LIBFWSI_COMPARE_EQUAL )
+	{
+		return( result );
+	}
+	first_extension_values = libfwsi_internal_item_get_file_entry_extension_values(
+	                          first_internal_item );
 
-				goto on_error;
-			}
-			extension_block = NULL;
-		}
-		if( extension_block != NULL )
-		{
-			if( libfwsi_internal_extension_block_free(
-			     &extension_block,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free extension block.",
-				 function );
+	second_extension_values = libfwsi_internal_item_get_file_entry_extension_values(
+	                           second_internal_item );
 
-				goto on_error;
-			}
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	if( first_extension_values == NULL )
+	{
+		if( second_extension_values == NULL )
 		{
-			if( shell_item_data_size > 0 )
-			{
-				libcnotify_printf(
-				 "%s: trailing data:\n",
-				 function );
-				libcnotify_print_data(
-				 &( byte_stream[ byte_stream_offset ] ),
-				 shell_item_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-			}
+			return( LIBFWSI_COMPARE_EQUAL );
 		}
-#endif
+		return( LIBFWSI_COMPARE_LESS );
 	}
-	internal_item->ascii_codepage = ascii_codepage;
-
-	return( 1 );
+	else if( second_extension_values == NULL )
+	{
+		return( LIBFWSI_COMPARE_GREATER );
+	}
+	result = libfwsi_item_compare_data(
+	          first_extension_values->long_name,
+	          first_extension_values->long_name_size,
+	          second_extension_values->long_name,
+	          second_extension_values->long_name_size );
 
-on_error:
-	if( extension_block != NULL )
+	if( result == LIBFWSI_COMPARE_EQUAL )
 	{
-		libfwsi_internal_extension_block_free(
-		 &extension_block,
-		 NULL );
+		result = libfwsi_item_compare_data(
+		          first_extension_values->localized_name,
+		          first_extension_values->localized_name_size,
+		          second_extension_values->localized_name,
+		          second_extension_values->localized_name_size );
 	}
-	if( ( internal_item->value != NULL )
-	 && ( internal_item->free_value != NULL ) )
+	if( result == LIBFWSI_COMPARE_EQUAL )
 	{
-		internal_item->free_value(
-		 &( internal_item->value ),
-		 NULL );
+		result = libfwsi_item_compare_integer(
+		          first_extension_values->creation_time,
+		          second_extension_values->creation_time );
 	}
-	return( -1 );
+	if( result == LIBFWSI_COMPARE_EQUAL )
+	{
+		result = libfwsi_item_compare_integer(
+		          first_extension_values->access_time,
+		          second_extension_values->access_time );
+	}
+	if( result == LIBFWSI_COMPARE_EQUAL )
+	{
+		result = libfwsi_item_compare_integer(
+		          first_extension_values->file_reference,
+		          second_extension_values->file_reference );
+	}
+	return( result );
 }
 
 /* Retrieves the type
@@ -1499,6 +1685,339 @@ int libfwsi_item_get_data_size(
 	return( 1 );
 }
 
+/* Retrieves the values of an item of a registered item type
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_get_user_defined_values(
+     libfwsi_item_t *item,
+     intptr_t **values,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_item_get_user_defined_values";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type < LIBFWSI_ITEM_TYPE_USER_DEFINED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	*values = internal_item->value;
+
+	return( 1 );
+}
+
+/* Retrieves the memory usage of an item by category
+ * The structs size contains the size of the item and item value structures,
+ * the strings size the size of the strings of the item value, the arrays size
+ * the size of the item data, extension blocks array, MTP property store and users
+ * property view property store data and the extension blocks size the size of the
+ * extension blocks including their values and strings
+ * The memory usage of the embedded item of a delegate item is included
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_get_memory_usage(
+     libfwsi_internal_item_t *internal_item,
+     size_t *structs_size,
+     size_t *strings_size,
+     size_t *arrays_size,
+     size_t *extension_blocks_size,
+     libcerror_error_t **error )
+{
+	libfwsi_file_entry_values_t *file_entry_values             = NULL;
+	libfwsi_internal_item_t *embedded_item                     = NULL;
+	libfwsi_mtp_property_store_t *property_store               = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values             = NULL;
+	libfwsi_network_location_values_t *network_location_values = NULL;
+	libfwsi_uri_values_t *uri_values                           = NULL;
+	static char *function                                      = "libfwsi_internal_item_get_memory_usage";
+	size_t embedded_arrays_size                                = 0;
+	size_t embedded_extension_blocks_size                      = 0;
+	size_t embedded_strings_size                               = 0;
+	size_t embedded_structs_size                               = 0;
+	size_t extension_block_memory_usage                        = 0;
+	size_t property_store_memory_usage                         = 0;
+	size_t safe_arrays_size                                    = 0;
+	size_t safe_extension_blocks_size                          = 0;
+	size_t safe_strings_size                                   = 0;
+	size_t safe_structs_size                                   = 0;
+	int extension_block_index                                  = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( structs_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structs size.",
+		 function );
+
+		return( -1 );
+	}
+	if( strings_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid strings size.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrays_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arrays size.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension_blocks_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension blocks size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_structs_size = sizeof( libfwsi_internal_item_t );
+
+	if( internal_item->value != NULL )
+	{
+		safe_structs_size += internal_item->value_size;
+
+		if( internal_item->values_type == LIBFWSI_VALUES_TYPE_FILE_ENTRY )
+		{
+			file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+			if( file_entry_values->name != NULL )
+			{
+				safe_strings_size += file_entry_values->name_size;
+			}
+		}
+		else if( internal_item->values_type == LIBFWSI_VALUES_TYPE_NETWORK_LOCATION )
+		{
+			network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
+
+			if( network_location_values->location != NULL )
+			{
+				safe_strings_size += network_location_values->location_size;
+			}
+			if( network_location_values->description != NULL )
+			{
+				safe_strings_size += network_location_values->description_size;
+			}
+			if( network_location_values->comments != NULL )
+			{
+				safe_strings_size += network_location_values->comments_size;
+			}
+		}
+		else if( internal_item->values_type == LIBFWSI_VALUES_TYPE_DELEGATE )
+		{
+			embedded_item = (libfwsi_internal_item_t *) ( (libfwsi_delegate_values_t *) internal_item->value )->embedded_item;
+		}
+		else if( internal_item->values_type == LIBFWSI_VALUES_TYPE_URI )
+		{
+			uri_values = (libfwsi_uri_values_t *) internal_item->value;
+
+			if( uri_values->string_data != NULL )
+			{
+				safe_strings_size += uri_values->string_data_size;
+			}
+		}
+		else if( internal_item->values_type == LIBFWSI_VALUES_TYPE_MTP_VOLUME )
+		{
+			mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+			safe_strings_size += mtp_volume_values->storage_name_size
+			                   + mtp_volume_values->volume_identifier_size
+			                   + mtp_volume_values->file_system_name_size;
+
+			property_store = mtp_volume_values->property_store;
+		}
+		else if( internal_item->values_type == LIBFWSI_VALUES_TYPE_MTP_FILE_ENTRY )
+		{
+			property_store = ( (libfwsi_mtp_file_entry_values_t *) internal_item->value )->property_store;
+		}
+		else if( internal_item->values_type == LIBFWSI_VALUES_TYPE_USERS_PROPERTY_VIEW )
+		{
+			safe_arrays_size += ( (libfwsi_users_property_view_values_t *) internal_item->value )->property_store_data_size;
+		}
+		if( embedded_item != NULL )
+		{
+			if( libfwsi_internal_item_get_memory_usage(
+			     embedded_item,
+			     &embedded_structs_size,
+			     &embedded_strings_size,
+			     &embedded_arrays_size,
+			     &embedded_extension_blocks_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve memory usage of embedded item.",
+				 function );
+
+				return( -1 );
+			}
+			safe_structs_size          += embedded_structs_size;
+			safe_strings_size          += embedded_strings_size;
+			safe_arrays_size           += embedded_arrays_size;
+			safe_extension_blocks_size += embedded_extension_blocks_size;
+		}
+		if( property_store != NULL )
+		{
+			if( libfwsi_mtp_property_store_get_memory_usage(
+			     property_store,
+			     &property_store_memory_usage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve memory usage of property store.",
+				 function );
+
+				return( -1 );
+			}
+			safe_arrays_size += property_store_memory_usage;
+		}
+	}
+	for( extension_block_index = 0;
+	     extension_block_index < internal_item->number_of_extension_blocks;
+	     extension_block_index++ )
+	{
+		if( libfwsi_internal_extension_block_get_memory_usage(
+		     internal_item->extension_blocks[ extension_block_index ],
+		     &extension_block_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of extension block: %d.",
+			 function,
+			 extension_block_index );
+
+			return( -1 );
+		}
+		safe_extension_blocks_size += extension_block_memory_usage;
+	}
+	safe_arrays_size += sizeof( libfwsi_internal_extension_block_t * ) * (size_t) internal_item->number_of_allocated_extension_blocks;
+
+	if( internal_item->data != NULL )
+	{
+		safe_arrays_size += (size_t) internal_item->data_size;
+	}
+
+	*structs_size          = safe_structs_size;
+	*strings_size          = safe_strings_size;
+	*arrays_size           = safe_arrays_size;
+	*extension_blocks_size = safe_extension_blocks_size;
+
+	return( 1 );
+}
+
+/* Retrieves the memory usage of the item by category
+ * The structs size contains the size of the item and item value structures,
+ * the strings size the size of the strings of the item value, the arrays size
+ * the size of the item data, extension blocks array, MTP property store and users
+ * property view property store data and the extension blocks size the size of the
+ * extension blocks including their values and strings
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_get_memory_usage(
+     libfwsi_item_t *item,
+     size_t *structs_size,
+     size_t *strings_size,
+     size_t *arrays_size,
+     size_t *extension_blocks_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_get_memory_usage";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_get_memory_usage(
+	     (libfwsi_internal_item_t *) item,
+	     structs_size,
+	     strings_size,
+	     arrays_size,
+	     extension_blocks_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of extension blocks
  * Returns 1 if successful or -1 on error
  */
@@ -1523,24 +2042,26 @@ int libfwsi_item_get_number_of_extension_blocks(
 	}
 	internal_item = (libfwsi_internal_item_t *) item;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_item->extension_blocks_array,
-	     number_of_extension_blocks,
-	     error ) != 1 )
+	if( number_of_extension_blocks == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extension blocks.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_extension_blocks = internal_item->number_of_extension_blocks;
+
 	return( 1 );
 }
 
 /* Retrieves a specific extension block
+ * The extension block is managed by the item, use libfwsi_extension_block_retain
+ * to keep the extension block after the item is freed and libfwsi_extension_block_release
+ * to release it
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_item_get_extension_block(
@@ -1565,22 +2086,31 @@ int libfwsi_item_get_extension_block(
 	}
 	internal_item = (libfwsi_internal_item_t *) item;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_item->extension_blocks_array,
-	     extension_block_index,
-	     (intptr_t **) extension_block,
-	     error ) != 1 )
+	if( ( extension_block_index < 0 )
+	 || ( extension_block_index >= internal_item->number_of_extension_blocks ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve extension block: %d.",
-		 function,
-		 extension_block_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extension block index value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
+	if( extension_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension block.",
+		 function );
+
+		return( -1 );
+	}
+	*extension_block = (libfwsi_extension_block_t *) internal_item->extension_blocks[ extension_block_index ];
+
 	return( 1 );
 }
 
@@ -1625,6 +2155,7 @@ int libfwsi_item_get_parent_item(
 }
 
 /* Sets the parent shell item
+ * The item holds a reference to the parent shell item
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_item_set_parent_item(
@@ -1648,6 +2179,42 @@ int libfwsi_item_set_parent_item(
 	}
 	internal_item = (libfwsi_internal_item_t *) item;
 
+	if( parent_item != NULL )
+	{
+		if( libfwsi_item_retain(
+		     parent_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to retain parent item.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_item->parent_item != NULL )
+	{
+		if( libfwsi_item_release(
+		     &( internal_item->parent_item ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release parent item.",
+			 function );
+
+			libfwsi_item_release(
+			 &parent_item,
+			 NULL );
+
+			return( -1 );
+		}
+	}
 	internal_item->parent_item = parent_item;
 
 	return( 1 );
@@ -25,9 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwsi_extension_block.h"
 #include "libfwsi_extern.h"
-#include "libfwsi_libcdata.h"
+#include "libfwsi_file_entry_extension_values.h"
 #include "libfwsi_libcerror.h"
+#include "libfwsi_parse_options.h"
+#include "libfwsi_reference_count.h"
 #include "libfwsi_types.h"
 
 #if defined( __cplusplus )
@@ -54,19 +57,43 @@ struct libfwsi_internal_item
 	 */
 	uint16_t data_size;
 
+	/* The fingerprint of the data
+	 */
+	uint64_t data_fingerprint;
+
+	/* The data, used to compare items without comparable values
+	 */
+	uint8_t *data;
+
 	/* The item value
 	 */
         intptr_t *value;
 
+	/* The size of the value structure
+	 */
+	size_t value_size;
+
 	/* The item free value function
 	 */
 	int (*free_value)(
 	       intptr_t **value,
 	       libcerror_error_t **error );
 
-	/* The extension blocks array
+	/* The values type of the item value
 	 */
-	libcdata_array_t *extension_blocks_array;
+	int values_type;
+
+	/* The extension blocks
+	 */
+	libfwsi_internal_extension_block_t **extension_blocks;
+
+	/* The number of extension blocks
+	 */
+	int number_of_extension_blocks;
+
+	/* The number of allocated extension blocks
+	 */
+	int number_of_allocated_extension_blocks;
 
 	/* The parent shell item
 	 */
@@ -79,6 +106,10 @@ struct libfwsi_internal_item
 	/* Value to indicate if the item is managed by the list
 	 */
 	uint8_t is_managed;
+
+	/* The reference count
+	 */
+	libfwsi_reference_count_t reference_count;
 };
 
 LIBFWSI_EXTERN \
@@ -90,11 +121,21 @@ int libfwsi_internal_item_initialize(
      libfwsi_internal_item_t **internal_item,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_retain(
+     libfwsi_item_t *item,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_free(
      libfwsi_item_t **item,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_release(
+     libfwsi_item_t **item,
+     libcerror_error_t **error );
+
 int libfwsi_internal_item_free(
      libfwsi_internal_item_t **internal_item,
      libcerror_error_t **error );
@@ -107,6 +148,49 @@ int libfwsi_item_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_copy_from_byte_stream(
+     libfwsi_item_t *item,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_internal_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+int libfwsi_item_validate_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t flags );
+
+int libfwsi_internal_item_append_extension_block(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_internal_extension_block_t *extension_block,
+     libcerror_error_t **error );
+
+int libfwsi_item_compare_data(
+     const uint8_t *first_data,
+     size_t first_data_size,
+     const uint8_t *second_data,
+     size_t second_data_size );
+
+int libfwsi_item_compare_integer(
+     uint64_t first_value,
+     uint64_t second_value );
+
+libfwsi_file_entry_extension_values_t *libfwsi_internal_item_get_file_entry_extension_values(
+                                        libfwsi_internal_item_t *internal_item );
+
+int libfwsi_internal_item_compare_item_data(
+     libfwsi_internal_item_t *first_internal_item,
+     libfwsi_internal_item_t *second_internal_item );
+
+int libfwsi_internal_item_compare_values(
+     libfwsi_internal_item_t *first_internal_item,
+     libfwsi_internal_item_t *second_internal_item );
+
+int libfwsi_internal_item_compare(
+     libfwsi_internal_item_t *first_internal_item,
+     libfwsi_internal_item_t *second_internal_item );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_get_type(
      libfwsi_item_t *item,
@@ -131,6 +215,29 @@ int libfwsi_item_get_data_size(
      size_t *data_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_get_user_defined_values(
+     libfwsi_item_t *item,
+     intptr_t **values,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_get_memory_usage(
+     libfwsi_internal_item_t *internal_item,
+     size_t *structs_size,
+     size_t *strings_size,
+     size_t *arrays_size,
+     size_t *extension_blocks_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_get_memory_usage(
+     libfwsi_item_t *item,
+     size_t *structs_size,
+     size_t *strings_size,
+     size_t *arrays_size,
+     size_t *extension_blocks_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_get_number_of_extension_blocks(
      libfwsi_item_t *item,
@@ -24,10 +24,12 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_codepage.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_filter.h"
 #include "libfwsi_item.h"
 #include "libfwsi_item_list.h"
-#include "libfwsi_libcdata.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_types.h"
@@ -93,20 +95,9 @@ int libfwsi_item_list_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
-	     &( internal_item_list->items_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create items array.",
-		 function );
+	libfwsi_reference_count_initialize(
+	 &( internal_item_list->reference_count ) );
 
-		goto on_error;
-	}
 	*item_list = (libfwsi_item_list_t *) internal_item_list;
 
 	return( 1 );
@@ -120,7 +111,40 @@ on_error:
 	return( -1 );
 }
 
+/* Adds a reference to an item list
+ * The item list remains available until every reference is released with libfwsi_item_list_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_retain(
+     libfwsi_item_list_t *item_list,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_retain";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	libfwsi_reference_count_increment(
+	 &( internal_item_list->reference_count ) );
+
+	return( 1 );
+}
+
 /* Frees an item list
+ * Releases a reference to the item list, where the item list is freed when the last reference
+ * is released. The items that were retained with libfwsi_item_retain remain available
+ * until they are released with libfwsi_item_release
  * Returns 1 if successful or -1 on error
  */
 int libfwsi_item_list_free(
@@ -129,6 +153,7 @@ int libfwsi_item_list_free(
 {
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
 	static char *function                            = "libfwsi_item_list_free";
+	int item_index                                   = 0;
 	int result                                       = 1;
 
 	if( item_list == NULL )
@@ -147,19 +172,42 @@ int libfwsi_item_list_free(
 		internal_item_list = (libfwsi_internal_item_list_t *) *item_list;
 		*item_list         = NULL;
 
-		if( libcdata_array_free(
-		     &( internal_item_list->items_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_internal_item_free,
-		     error ) != 1 )
+		if( libfwsi_reference_count_decrement(
+		     &( internal_item_list->reference_count ) ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the items array.",
-			 function );
+			return( 1 );
+		}
+		/* The items are released last to first since every item references
+		 * the preceding item as its parent item
+		 */
+		for( item_index = internal_item_list->number_of_items - 1;
+		     item_index >= 0;
+		     item_index-- )
+		{
+			if( libfwsi_item_release(
+			     (libfwsi_item_t **) &( internal_item_list->items[ item_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release item: %d.",
+				 function,
+				 item_index );
 
-			result = -1;
+				result = -1;
+			}
+		}
+		if( internal_item_list->items != NULL )
+		{
+			memory_free(
+			 internal_item_list->items );
+		}
+		if( internal_item_list->entries != NULL )
+		{
+			memory_free(
+			 internal_item_list->entries );
 		}
 		memory_free(
 		 internal_item_list );
@@ -177,13 +225,47 @@ int libfwsi_item_list_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error )
 {
-	libfwsi_internal_item_t *internal_item           = NULL;
+	static char *function = "libfwsi_item_list_copy_from_byte_stream";
+	int parse_status      = 0;
+
+	if( libfwsi_item_list_copy_from_byte_stream_with_options(
+	     item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     NULL,
+	     &parse_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy shell item list from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies a shell item list from a byte stream applying the limits of the parse options
+ * The parse options can be NULL in which case no limits are applied
+ * Parse status is set to indicate why reading failed, such as LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_copy_from_byte_stream_with_options(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     int *parse_status,
+     libcerror_error_t **error )
+{
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	libfwsi_item_t *parent_item                      = NULL;
-	static char *function                            = "libfwsi_item_list_copy_from_byte_stream";
-	uint16_t shell_item_size                         = 0;
-	int item_list_index                              = 0;
-	int shell_item_index                             = 0;
+	static char *function                            = "libfwsi_item_list_copy_from_byte_stream_with_options";
+	size_t parse_offset                              = 0;
 
 	if( item_list == NULL )
 	{
@@ -256,193 +338,63 @@ int libfwsi_item_list_copy_from_byte_stream(
 
 		return( -1 );
 	}
-	while( byte_stream_size > 0 )
-	{
-		byte_stream_copy_to_uint16_little_endian(
-		 byte_stream,
-		 shell_item_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: shell item: %d size\t\t: %" PRIu16 "\n",
-			 function,
-			 shell_item_index,
-			 shell_item_size );
-		}
-#endif
-		if( shell_item_size > byte_stream_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid shell item size value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		if( shell_item_size == 0 )
-		{
-			byte_stream                   += 2;
-			byte_stream_size              -= 2;
-			internal_item_list->data_size += 2;
-
-			break;
-		}
-		if( libfwsi_internal_item_initialize(
-		     &internal_item,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create shell item.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfwsi_item_set_parent_item(
-		     (libfwsi_item_t *) internal_item,
-		     parent_item,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set parent shell item.",
-			 function );
-
-			goto on_error;
-		}
-		if( internal_item == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: missing shell item.",
-			 function );
-
-			goto on_error;
-		}
-		internal_item->is_managed = 1;
-
-		if( libfwsi_item_copy_from_byte_stream(
-		     (libfwsi_item_t *) internal_item,
-		     byte_stream,
-		     byte_stream_size,
-		     ascii_codepage,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy byte stream to shell item.",
-			 function );
-
-			goto on_error;
-		}
-		byte_stream                   += shell_item_size;
-		byte_stream_size              -= shell_item_size;
-		internal_item_list->data_size += (size_t) shell_item_size;
-
-		if( libcdata_array_append_entry(
-		     internal_item_list->items_array,
-		     &item_list_index,
-		     (intptr_t *) internal_item,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append shell item: %d.",
-			 function,
-			 shell_item_index );
-
-			goto on_error;
-		}
-		parent_item   = (libfwsi_item_t *) internal_item;
-		internal_item = NULL;
-
-		shell_item_index++;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	internal_item_list->ascii_codepage = ascii_codepage;
-
-	return( 1 );
-
-on_error:
-	if( internal_item != NULL )
-	{
-		libfwsi_internal_item_free(
-		 &internal_item,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Retrieves the data size
- * Returns 1 if successful or -1 on error
- */
-int libfwsi_item_list_get_data_size(
-     libfwsi_item_list_t *item_list,
-     size_t *data_size,
-     libcerror_error_t **error )
-{
-	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_data_size";
-
-	if( item_list == NULL )
+	if( parse_status == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item list.",
+		 "%s: invalid parse status.",
 		 function );
 
 		return( -1 );
 	}
-	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
-
-	if( data_size == NULL )
+	if( libfwsi_internal_item_list_read_items(
+	     internal_item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     (libfwsi_internal_parse_options_t *) parse_options,
+	     parse_status,
+	     &parse_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data size.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to read shell items at offset: %" PRIzd ".",
+		 function,
+		 parse_offset );
 
 		return( -1 );
 	}
-	*data_size = internal_item_list->data_size;
-
 	return( 1 );
 }
 
-/* Retrieves the number of items
- * Returns 1 if successful or -1 on error
+/* Copies a shell item list from a byte stream applying the limits of the parse options without error backtraces
+ * This function is intended for callers that expect most byte streams to be invalid, such as carving.
+ * The parse options can be NULL in which case no limits are applied
+ * If the byte stream does not contain a valid shell item list or exceeds a limit of the parse options
+ * parse status and parse offset are set and no error is created. The item list contains the items
+ * read before the failure. The parse offset is relative to the start of the byte stream.
+ * If memory could not be allocated parse status is set to LIBFWSI_PARSE_STATUS_INSUFFICIENT_MEMORY
+ * and an error is created.
+ * Use libfwsi_item_list_copy_from_byte_stream on a new item list to obtain a full error backtrace.
+ * Returns 1 if successful, 0 if the byte stream does not contain a valid shell item list or -1 on error
  */
-int libfwsi_item_list_get_number_of_items(
+int libfwsi_item_list_copy_from_byte_stream_with_status(
      libfwsi_item_list_t *item_list,
-     int *number_of_items,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     int *parse_status,
+     size_t *parse_offset,
      libcerror_error_t **error )
 {
 	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_number_of_items";
+	static char *function                            = "libfwsi_item_list_copy_from_byte_stream_with_status";
 
 	if( item_list == NULL )
 	{
@@ -457,64 +409,1775 @@ int libfwsi_item_list_get_number_of_items(
 	}
 	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_item_list->items_array,
-	     number_of_items,
-	     error ) != 1 )
+	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific item
- * Returns 1 if successful or -1 on error
- */
-int libfwsi_item_list_get_item(
-     libfwsi_item_list_t *item_list,
-     int item_index,
-     libfwsi_item_t **item,
-     libcerror_error_t **error )
-{
-	libfwsi_internal_item_list_t *internal_item_list = NULL;
-	static char *function                            = "libfwsi_item_list_get_item";
-
-	if( item_list == NULL )
+	if( byte_stream_size < 2 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item list.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
 		 function );
 
 		return( -1 );
 	}
-	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
-
-	if( libcdata_array_get_entry_by_index(
-	     internal_item_list->items_array,
-	     item_index,
-	     (intptr_t **) item,
-	     error ) != 1 )
+	if( byte_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve list item: %d.",
-		 function,
-		 item_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse status.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* Passing no error object makes libcerror_error_set a no-op,
+	 * hence no error messages are formatted or allocated when the data is rejected
+	 */
+	if( libfwsi_internal_item_list_read_items(
+	     internal_item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     (libfwsi_internal_parse_options_t *) parse_options,
+	     parse_status,
+	     parse_offset,
+	     NULL ) != 1 )
+	{
+		if( *parse_status == LIBFWSI_PARSE_STATUS_INSUFFICIENT_MEMORY )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to read shell items at offset: %" PRIzd ".",
+			 function,
+			 *parse_offset );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Copies a shell item list from a byte stream if it matches the filter
+ * The filter is evaluated on the byte stream before any item is copied, hence a shell item
+ * list that does not match is rejected before names are copied or extension blocks are decoded
+ * If the shell item list does not match the item list is not changed
+ * Returns 1 if successful, 0 if the shell item list does not match the filter or -1 on error
+ */
+int libfwsi_item_list_copy_from_byte_stream_with_filter(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_filter_t *filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_list_copy_from_byte_stream_with_filter";
+	int parse_status      = 0;
+	int result            = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_internal_filter_match_byte_stream(
+	          (libfwsi_internal_filter_t *) filter,
+	          byte_stream,
+	          byte_stream_size,
+	          ascii_codepage,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to match shell item list.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfwsi_item_list_copy_from_byte_stream_with_options(
+	     item_list,
+	     byte_stream,
+	     byte_stream_size,
+	     ascii_codepage,
+	     NULL,
+	     &parse_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy shell item list from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the shell items from a byte stream
+ * The error argument can be NULL in which case no error is created
+ * The parse options can be NULL in which case no limits are applied
+ * Sets parse status and parse offset to indicate where and why reading failed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_read_items(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_internal_parse_options_t *parse_options,
+     int *parse_status,
+     size_t *parse_offset,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_parse_options_t read_parse_options;
+
+	libfwsi_item_t *parent_item = NULL;
+	static char *function       = "libfwsi_internal_item_list_read_items";
+	size_t allocation_size      = 0;
+	size_t byte_stream_offset   = 0;
+	uint16_t shell_item_size    = 0;
+	int safe_parse_status       = LIBFWSI_PARSE_STATUS_INVALID_ITEM_DATA;
+	int shell_item_index        = 0;
+
+	/* The parse options are copied since reading sets limit exceeded
+	 */
+	if( parse_options == NULL )
+	{
+		if( memory_set(
+		     &read_parse_options,
+		     0,
+		     sizeof( libfwsi_internal_parse_options_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear parse options.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( memory_copy(
+	          &read_parse_options,
+	          parse_options,
+	          sizeof( libfwsi_internal_parse_options_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy parse options.",
+		 function );
+
+		goto on_error;
+	}
+	while( byte_stream_size > 0 )
+	{
+		if( byte_stream_size < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: byte stream too small.",
+			 function );
+
+			safe_parse_status = LIBFWSI_PARSE_STATUS_ITEM_SIZE_OUT_OF_BOUNDS;
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 byte_stream,
+		 shell_item_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: shell item: %d size\t\t: %" PRIu16 "\n",
+			 function,
+			 shell_item_index,
+			 shell_item_size );
+		}
+#endif
+		if( shell_item_size > byte_stream_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid shell item size value out of bounds.",
+			 function );
+
+			safe_parse_status = LIBFWSI_PARSE_STATUS_ITEM_SIZE_OUT_OF_BOUNDS;
+
+			goto on_error;
+		}
+		if( shell_item_size == 0 )
+		{
+			byte_stream                   += 2;
+			byte_stream_size              -= 2;
+			byte_stream_offset            += 2;
+			internal_item_list->data_size += 2;
+
+			break;
+		}
+		if( ( read_parse_options.maximum_number_of_items != 0 )
+		 && ( shell_item_index >= read_parse_options.maximum_number_of_items ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: number of items value exceeds maximum.",
+			 function );
+
+			safe_parse_status = LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		if( libfwsi_internal_item_list_read_item(
+		     internal_item_list,
+		     byte_stream,
+		     (size_t) shell_item_size,
+		     ascii_codepage,
+		     &read_parse_options,
+		     parent_item,
+		     &allocation_size,
+		     &safe_parse_status,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read shell item: %d.",
+			 function,
+			 shell_item_index );
+
+			goto on_error;
+		}
+		parent_item = (libfwsi_item_t *) internal_item_list->items[ internal_item_list->number_of_items - 1 ];
+
+		byte_stream        += shell_item_size;
+		byte_stream_size   -= shell_item_size;
+		byte_stream_offset += (size_t) shell_item_size;
+
+		shell_item_index++;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	internal_item_list->ascii_codepage = ascii_codepage;
+
+	*parse_status = LIBFWSI_PARSE_STATUS_OK;
+	*parse_offset = byte_stream_offset;
+
+	return( 1 );
+
+on_error:
+	*parse_status = safe_parse_status;
+	*parse_offset = byte_stream_offset;
+
+	return( -1 );
+}
+
+/* Reads a single shell item and appends it to the item list
+ * The error argument can be NULL in which case no error is created
+ * The parse options can be NULL in which case no limits are applied, otherwise
+ * the parse options must be a copy that is owned by the read since limit exceeded is set
+ * The allocation size contains the number of bytes allocated by the previously read shell items
+ * and is used to enforce the maximum allocation size of the parse options
+ * Sets parse status to indicate why reading failed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_read_item(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t shell_item_size,
+     int ascii_codepage,
+     libfwsi_internal_parse_options_t *parse_options,
+     libfwsi_item_t *parent_item,
+     size_t *allocation_size,
+     int *parse_status,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *copy_error          = NULL;
+	libcerror_error_t **item_error         = error;
+	libfwsi_internal_item_t *internal_item = NULL;
+	static char *function                  = "libfwsi_internal_item_list_read_item";
+	size_t item_arrays_size                = 0;
+	size_t item_extension_blocks_size      = 0;
+	size_t item_strings_size               = 0;
+	size_t item_structs_size               = 0;
+	size_t list_arrays_size                = 0;
+	int number_of_items                    = 0;
+
+	*parse_status = LIBFWSI_PARSE_STATUS_INVALID_ITEM_DATA;
+
+	if( parse_options != NULL )
+	{
+		parse_options->limit_exceeded = 0;
+
+		/* The item entries and items arrays are resized by the list hence they are not accumulated
+		 * in the allocation size but accounted for based on the number of items after the append
+		 */
+		number_of_items = internal_item_list->number_of_items + 1;
+
+		if( number_of_items < internal_item_list->number_of_allocated_items )
+		{
+			number_of_items = internal_item_list->number_of_allocated_items;
+		}
+		list_arrays_size = ( sizeof( libfwsi_item_list_entry_t ) + sizeof( libfwsi_internal_item_t * ) ) * (size_t) number_of_items;
+
+		/* The shell item is checked against the limit before it is allocated
+		 */
+		if( ( parse_options->maximum_allocation_size != 0 )
+		 && ( ( *allocation_size + list_arrays_size + sizeof( libfwsi_internal_item_t ) ) > parse_options->maximum_allocation_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: allocation size value exceeds maximum.",
+			 function );
+
+			*parse_status = LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+	}
+	if( libfwsi_internal_item_initialize(
+	     &internal_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create shell item.",
+		 function );
+
+		*parse_status = LIBFWSI_PARSE_STATUS_INSUFFICIENT_MEMORY;
+
+		goto on_error;
+	}
+	internal_item->is_managed = 1;
+
+	if( libfwsi_item_set_parent_item(
+	     (libfwsi_item_t *) internal_item,
+	     parent_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set parent shell item.",
+		 function );
+
+		goto on_error;
+	}
+	/* An error is needed to distinguish an allocation failure from invalid item data
+	 */
+	if( item_error == NULL )
+	{
+		item_error = &copy_error;
+	}
+	if( libfwsi_internal_item_copy_from_byte_stream(
+	     (libfwsi_item_t *) internal_item,
+	     byte_stream,
+	     shell_item_size,
+	     ascii_codepage,
+	     parse_options,
+	     item_error ) != 1 )
+	{
+		/* The error keeps the domain and code of the first failure, which is
+		 * an insufficient memory error when an allocation failed
+		 */
+		if( ( parse_options != NULL )
+		 && ( parse_options->limit_exceeded != 0 ) )
+		{
+			*parse_status = LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED;
+		}
+		else if( libcerror_error_matches(
+		          *item_error,
+		          LIBCERROR_ERROR_DOMAIN_MEMORY,
+		          LIBCERROR_MEMORY_ERROR_INSUFFICIENT ) != 0 )
+		{
+			*parse_status = LIBFWSI_PARSE_STATUS_INSUFFICIENT_MEMORY;
+		}
+		else
+		{
+			*parse_status = LIBFWSI_PARSE_STATUS_INVALID_ITEM_DATA;
+		}
+		libcerror_error_set(
+		 item_error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to shell item.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( parse_options != NULL )
+	 && ( parse_options->maximum_allocation_size != 0 ) )
+	{
+		if( libfwsi_internal_item_get_memory_usage(
+		     internal_item,
+		     &item_structs_size,
+		     &item_strings_size,
+		     &item_arrays_size,
+		     &item_extension_blocks_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of shell item.",
+			 function );
+
+			goto on_error;
+		}
+		*allocation_size += item_structs_size + item_strings_size + item_arrays_size + item_extension_blocks_size;
+
+		if( ( *allocation_size + list_arrays_size ) > parse_options->maximum_allocation_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: allocation size value exceeds maximum.",
+			 function );
+
+			*parse_status = LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+	}
+	if( libfwsi_internal_item_list_append_item(
+	     internal_item_list,
+	     internal_item,
+	     internal_item_list->data_size,
+	     internal_item->data_fingerprint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append shell item.",
+		 function );
+
+		*parse_status = LIBFWSI_PARSE_STATUS_INSUFFICIENT_MEMORY;
+
+		goto on_error;
+	}
+	internal_item = NULL;
+
+	internal_item_list->data_size += shell_item_size;
+
+	*parse_status = LIBFWSI_PARSE_STATUS_OK;
+
+	return( 1 );
+
+on_error:
+	if( copy_error != NULL )
+	{
+		libcerror_error_free(
+		 &copy_error );
+	}
+	if( internal_item != NULL )
+	{
+		libfwsi_item_release(
+		 (libfwsi_item_t **) &internal_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Validates a shell item list in a byte stream without copying it
+ * Applies the same bounds checks as libfwsi_item_list_copy_from_byte_stream
+ * without allocating memory or decoding strings
+ * Consumed contains the size of the shell item list including the terminator, if present
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libfwsi_item_list_validate(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t flags,
+     size_t *consumed,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwsi_item_list_validate";
+	size_t byte_stream_offset = 0;
+	uint32_t supported_flags  = 0;
+	uint16_t shell_item_size  = 0;
+	int shell_item_index      = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBFWSI_VALIDATE_FLAG_REQUIRE_TERMINATOR
+	                | LIBFWSI_VALIDATE_FLAG_STRICT_EXTENSION_BLOCKS;
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%08" PRIx32 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( consumed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid consumed.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	*consumed        = 0;
+	*number_of_items = 0;
+
+	if( byte_stream_size < 2 )
+	{
+		return( 0 );
+	}
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( ( byte_stream_size - byte_stream_offset ) < 2 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 shell_item_size );
+
+		if( (size_t) shell_item_size > ( byte_stream_size - byte_stream_offset ) )
+		{
+			return( 0 );
+		}
+		if( shell_item_size == 0 )
+		{
+			*consumed        = byte_stream_offset + 2;
+			*number_of_items = shell_item_index;
+
+			return( 1 );
+		}
+		if( libfwsi_item_validate_byte_stream(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     (size_t) shell_item_size,
+		     flags ) != 1 )
+		{
+			return( 0 );
+		}
+		byte_stream_offset += shell_item_size;
+
+		shell_item_index++;
+	}
+	if( ( flags & LIBFWSI_VALIDATE_FLAG_REQUIRE_TERMINATOR ) != 0 )
+	{
+		return( 0 );
+	}
+	*consumed        = byte_stream_offset;
+	*number_of_items = shell_item_index;
+
+	return( 1 );
+}
+
+/* Appends an item to the item list
+ * The item list takes over management of the item
+ * The item fingerprint is combined with the fingerprint of the preceding items
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_append_item(
+     libfwsi_internal_item_list_t *internal_item_list,
+     libfwsi_internal_item_t *internal_item,
+     size_t offset,
+     uint64_t item_fingerprint,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t **items    = NULL;
+	libfwsi_item_list_entry_t *entries = NULL;
+	libfwsi_item_list_entry_t *entry   = NULL;
+	static char *function              = "libfwsi_internal_item_list_append_item";
+	size_t entries_size                = 0;
+	size_t items_size                  = 0;
+	int number_of_allocated_items      = 0;
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item_list->number_of_items >= internal_item_list->number_of_allocated_items )
+	{
+		if( internal_item_list->number_of_allocated_items == 0 )
+		{
+			number_of_allocated_items = 8;
+		}
+		else if( internal_item_list->number_of_allocated_items < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_items = internal_item_list->number_of_allocated_items * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of items value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libfwsi_item_list_entry_t ) * (size_t) number_of_allocated_items;
+		items_size   = sizeof( libfwsi_internal_item_t * ) * (size_t) number_of_allocated_items;
+
+		entries = (libfwsi_item_list_entry_t *) memory_reallocate(
+		                                         internal_item_list->entries,
+		                                         entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize item entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_item_list->entries = entries;
+
+		items = (libfwsi_internal_item_t **) memory_reallocate(
+		                                      internal_item_list->items,
+		                                      items_size );
+
+		if( items == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize items.",
+			 function );
+
+			return( -1 );
+		}
+		internal_item_list->items                     = items;
+		internal_item_list->number_of_allocated_items = number_of_allocated_items;
+	}
+	entry = &( internal_item_list->entries[ internal_item_list->number_of_items ] );
+
+	entry->offset     = offset;
+	entry->signature  = internal_item->signature;
+	entry->type       = internal_item->type;
+	entry->data_size  = internal_item->data_size;
+	entry->class_type = internal_item->class_type;
+
+	if( internal_item_list->number_of_items == 0 )
+	{
+		entry->prefix_fingerprint = item_fingerprint;
+	}
+	else
+	{
+		entry->prefix_fingerprint = internal_item_list->entries[ internal_item_list->number_of_items - 1 ].prefix_fingerprint
+		                          * LIBFWSI_ITEM_LIST_FINGERPRINT_MULTIPLIER
+		                          + item_fingerprint;
+	}
+
+	internal_item_list->items[ internal_item_list->number_of_items ] = internal_item;
+
+	internal_item_list->number_of_items += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_data_size(
+     libfwsi_item_list_t *item_list,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_data_size";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = internal_item_list->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the memory usage of the item list by category
+ * The structs size contains the size of the item list, item and item value structures,
+ * the strings size the size of the strings of the item values, the arrays size
+ * the size of the item entries, items and extension blocks arrays, item data and
+ * MTP property stores and the extension blocks size the size of the extension blocks
+ * including their values and strings
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_memory_usage(
+     libfwsi_item_list_t *item_list,
+     size_t *structs_size,
+     size_t *strings_size,
+     size_t *arrays_size,
+     size_t *extension_blocks_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_memory_usage";
+	size_t item_arrays_size                          = 0;
+	size_t item_extension_blocks_size                = 0;
+	size_t item_strings_size                         = 0;
+	size_t item_structs_size                         = 0;
+	size_t safe_arrays_size                          = 0;
+	size_t safe_extension_blocks_size                = 0;
+	size_t safe_strings_size                         = 0;
+	size_t safe_structs_size                         = 0;
+	int item_index                                   = 0;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( structs_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structs size.",
+		 function );
+
+		return( -1 );
+	}
+	if( strings_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid strings size.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrays_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arrays size.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension_blocks_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension blocks size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_structs_size = sizeof( libfwsi_internal_item_list_t );
+	safe_arrays_size  = ( sizeof( libfwsi_item_list_entry_t ) + sizeof( libfwsi_internal_item_t * ) )
+	                  * (size_t) internal_item_list->number_of_allocated_items;
+
+	for( item_index = 0;
+	     item_index < internal_item_list->number_of_items;
+	     item_index++ )
+	{
+		if( libfwsi_internal_item_get_memory_usage(
+		     internal_item_list->items[ item_index ],
+		     &item_structs_size,
+		     &item_strings_size,
+		     &item_arrays_size,
+		     &item_extension_blocks_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		safe_structs_size          += item_structs_size;
+		safe_strings_size          += item_strings_size;
+		safe_arrays_size           += item_arrays_size;
+		safe_extension_blocks_size += item_extension_blocks_size;
+	}
+	*structs_size          = safe_structs_size;
+	*strings_size          = safe_strings_size;
+	*arrays_size           = safe_arrays_size;
+	*extension_blocks_size = safe_extension_blocks_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of items
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_number_of_items(
+     libfwsi_item_list_t *item_list,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_number_of_items";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_items = internal_item_list->number_of_items;
+
+	return( 1 );
+}
+
+/* Retrieves a specific item entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_get_entry(
+     libfwsi_internal_item_list_t *internal_item_list,
+     int item_index,
+     libfwsi_item_list_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_list_get_entry";
+
+	if( internal_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item_index < 0 )
+	 || ( item_index >= internal_item_list->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = &( internal_item_list->entries[ item_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves a specific item
+ * The item is managed by the item list, use libfwsi_item_retain to keep the item
+ * after the item list is freed and libfwsi_item_release to release it
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_item(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     libfwsi_item_t **item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_item";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item_index < 0 )
+	 || ( item_index >= internal_item_list->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*item = (libfwsi_item_t *) internal_item_list->items[ item_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the type of a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_item_type(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     int *type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	libfwsi_item_list_entry_t *entry                 = NULL;
+	static char *function                            = "libfwsi_item_list_get_item_type";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_entry(
+	     internal_item_list,
+	     item_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	*type = entry->type;
+
+	return( 1 );
+}
+
+/* Retrieves the class type of a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_item_class_type(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     uint8_t *class_type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	libfwsi_item_list_entry_t *entry                 = NULL;
+	static char *function                            = "libfwsi_item_list_get_item_class_type";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( class_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_entry(
+	     internal_item_list,
+	     item_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	*class_type = entry->class_type;
+
+	return( 1 );
+}
+
+/* Retrieves the signature of a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_item_signature(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     uint32_t *signature,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	libfwsi_item_list_entry_t *entry                 = NULL;
+	static char *function                            = "libfwsi_item_list_get_item_signature";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_entry(
+	     internal_item_list,
+	     item_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	*signature = entry->signature;
+
+	return( 1 );
+}
+
+/* Retrieves the data size of a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_item_data_size(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	libfwsi_item_list_entry_t *entry                 = NULL;
+	static char *function                            = "libfwsi_item_list_get_item_data_size";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_get_entry(
+	     internal_item_list,
+	     item_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	*data_size = (size_t) entry->data_size;
+
+	return( 1 );
+}
+
+/* Compares the items of two item lists up to the first item that differs
+ * The item entries are compared before the items so that lists with different types
+ * are ordered without accessing the item values
+ * Returns LIBFWSI_COMPARE_LESS, LIBFWSI_COMPARE_EQUAL, LIBFWSI_COMPARE_GREATER or -1 on error
+ */
+int libfwsi_internal_item_list_compare_items(
+     libfwsi_internal_item_list_t *first_internal_item_list,
+     libfwsi_internal_item_list_t *second_internal_item_list,
+     int *number_of_common_items,
+     libcerror_error_t **error )
+{
+	libfwsi_item_list_entry_t *first_entry  = NULL;
+	libfwsi_item_list_entry_t *second_entry = NULL;
+	static char *function                   = "libfwsi_internal_item_list_compare_items";
+	int item_index                          = 0;
+	int number_of_items                     = 0;
+	int result                              = LIBFWSI_COMPARE_EQUAL;
+
+	number_of_items = first_internal_item_list->number_of_items;
+
+	if( second_internal_item_list->number_of_items < number_of_items )
+	{
+		number_of_items = second_internal_item_list->number_of_items;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		first_entry  = &( first_internal_item_list->entries[ item_index ] );
+		second_entry = &( second_internal_item_list->entries[ item_index ] );
+
+		if( first_entry->type != second_entry->type )
+		{
+			result = ( first_entry->type < second_entry->type ) ? LIBFWSI_COMPARE_LESS : LIBFWSI_COMPARE_GREATER;
+		}
+		else if( first_entry->class_type != second_entry->class_type )
+		{
+			result = ( first_entry->class_type < second_entry->class_type ) ? LIBFWSI_COMPARE_LESS : LIBFWSI_COMPARE_GREATER;
+		}
+		else
+		{
+			if( ( first_internal_item_list->items[ item_index ] == NULL )
+			 || ( second_internal_item_list->items[ item_index ] == NULL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: missing item: %d.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+			result = libfwsi_internal_item_compare(
+			          first_internal_item_list->items[ item_index ],
+			          second_internal_item_list->items[ item_index ] );
+		}
+		if( result != LIBFWSI_COMPARE_EQUAL )
+		{
+			break;
+		}
+	}
+	*number_of_common_items = item_index;
+
+	if( result != LIBFWSI_COMPARE_EQUAL )
+	{
+		return( result );
+	}
+	if( first_internal_item_list->number_of_items < second_internal_item_list->number_of_items )
+	{
+		return( LIBFWSI_COMPARE_LESS );
+	}
+	else if( first_internal_item_list->number_of_items > second_internal_item_list->number_of_items )
+	{
+		return( LIBFWSI_COMPARE_GREATER );
+	}
+	return( LIBFWSI_COMPARE_EQUAL );
+}
+
+/* Compares two item lists
+ * The item lists are ordered by their items, where the items are compared on type, class type,
+ * names, identifiers (GUIDs), times and file reference and a list that is a prefix of the other comes first
+ * Items with values that have no such fields, such as unknown items, are compared on their data
+ * Returns LIBFWSI_COMPARE_LESS, LIBFWSI_COMPARE_EQUAL, LIBFWSI_COMPARE_GREATER or -1 on error
+ */
+int libfwsi_item_list_compare(
+     libfwsi_item_list_t *first_item_list,
+     libfwsi_item_list_t *second_item_list,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfwsi_item_list_compare";
+	int number_of_common_items = 0;
+	int result                 = 0;
+
+	if( first_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second item list.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_internal_item_list_compare_items(
+	          (libfwsi_internal_item_list_t *) first_item_list,
+	          (libfwsi_internal_item_list_t *) second_item_list,
+	          &number_of_common_items,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to compare items.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines the differences between two item lists
+ * The items before the number of common items are equal in both item lists, the remaining
+ * items of each item list, which can be retrieved by index, differ
+ * Returns 1 if the item lists differ, 0 if they are equal or -1 on error
+ */
+int libfwsi_item_list_diff(
+     libfwsi_item_list_t *first_item_list,
+     libfwsi_item_list_t *second_item_list,
+     int *number_of_common_items,
+     int *first_number_of_differing_items,
+     int *second_number_of_differing_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *first_internal_item_list  = NULL;
+	libfwsi_internal_item_list_t *second_internal_item_list = NULL;
+	static char *function                                   = "libfwsi_item_list_diff";
+	int common_items                                        = 0;
+
+	if( first_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first item list.",
+		 function );
+
+		return( -1 );
+	}
+	first_internal_item_list = (libfwsi_internal_item_list_t *) first_item_list;
+
+	if( second_item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second item list.",
+		 function );
+
+		return( -1 );
+	}
+	second_internal_item_list = (libfwsi_internal_item_list_t *) second_item_list;
+
+	if( number_of_common_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of common items.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_number_of_differing_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first number of differing items.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_number_of_differing_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second number of differing items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_internal_item_list_compare_items(
+	     first_internal_item_list,
+	     second_internal_item_list,
+	     &common_items,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to compare items.",
+		 function );
+
+		return( -1 );
+	}
+
+	*number_of_common_items           = common_items;
+	*first_number_of_differing_items  = first_internal_item_list->number_of_items - common_items;
+	*second_number_of_differing_items = second_internal_item_list->number_of_items - common_items;
+
+	if( ( *first_number_of_differing_items == 0 )
+	 && ( *second_number_of_differing_items == 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Calculates the fingerprint of the data of an item
+ * The fingerprint is a 64-bit FNV-1a hash of the item data
+ * Returns the fingerprint
+ */
+uint64_t libfwsi_item_list_calculate_item_fingerprint(
+          const uint8_t *data,
+          size_t data_size )
+{
+	uint64_t fingerprint = (uint64_t) 0xcbf29ce484222325ULL;
+	size_t data_offset   = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		fingerprint ^= data[ data_offset ];
+		fingerprint *= LIBFWSI_ITEM_LIST_FINGERPRINT_MULTIPLIER;
+	}
+	return( fingerprint );
+}
+
+/* Retrieves the fingerprint multiplier raised to the power of the number of items
+ * Returns the multiplier
+ */
+uint64_t libfwsi_item_list_get_fingerprint_multiplier(
+          int number_of_items )
+{
+	uint64_t multiplier = LIBFWSI_ITEM_LIST_FINGERPRINT_MULTIPLIER;
+	uint64_t result     = 1;
+
+	while( number_of_items > 0 )
+	{
+		if( ( number_of_items & 1 ) != 0 )
+		{
+			result *= multiplier;
+		}
+		multiplier      *= multiplier;
+		number_of_items >>= 1;
+	}
+	return( result );
+}
+
+/* Retrieves the fingerprint of a range of items
+ * The fingerprint of the range is derived from the prefix fingerprints, hence the same
+ * sequence of items has the same fingerprint regardless of where it starts in an item list
+ * The range is expected to be valid
+ * Returns the fingerprint, which is 0 for an empty range
+ */
+uint64_t libfwsi_internal_item_list_get_range_fingerprint(
+          libfwsi_internal_item_list_t *internal_item_list,
+          int first_item_index,
+          int number_of_items )
+{
+	uint64_t fingerprint = 0;
+
+	if( number_of_items == 0 )
+	{
+		return( 0 );
+	}
+	fingerprint = internal_item_list->entries[ first_item_index + number_of_items - 1 ].prefix_fingerprint;
+
+	if( first_item_index > 0 )
+	{
+		fingerprint -= internal_item_list->entries[ first_item_index - 1 ].prefix_fingerprint
+		             * libfwsi_item_list_get_fingerprint_multiplier(
+		                number_of_items );
+	}
+	return( fingerprint );
+}
+
+/* Retrieves the fingerprint of the first number of items
+ * The fingerprint identifies the path formed by the items, so that the fingerprint of
+ * the parent path is the prefix fingerprint of one item less
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_get_prefix_fingerprint(
+     libfwsi_item_list_t *item_list,
+     int number_of_items,
+     uint64_t *fingerprint,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	static char *function                            = "libfwsi_item_list_get_prefix_fingerprint";
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( ( number_of_items < 0 )
+	 || ( number_of_items > internal_item_list->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == 0 )
+	{
+		*fingerprint = 0;
+	}
+	else
+	{
+		*fingerprint = internal_item_list->entries[ number_of_items - 1 ].prefix_fingerprint;
+	}
+	return( 1 );
+}
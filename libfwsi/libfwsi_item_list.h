@@ -26,21 +26,70 @@
 #include <types.h>
 
 #include "libfwsi_extern.h"
-#include "libfwsi_libcdata.h"
+#include "libfwsi_item.h"
 #include "libfwsi_libcerror.h"
+#include "libfwsi_parse_options.h"
+#include "libfwsi_reference_count.h"
 #include "libfwsi_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The multiplier of the polynomial fingerprint of a sequence of items
+ */
+#define LIBFWSI_ITEM_LIST_FINGERPRINT_MULTIPLIER	(uint64_t) 0x00000100000001b3ULL
+
+typedef struct libfwsi_item_list_entry libfwsi_item_list_entry_t;
+
+struct libfwsi_item_list_entry
+{
+	/* The offset of the item relative to the start of the list
+	 */
+	size_t offset;
+
+	/* The signature
+	 */
+	uint32_t signature;
+
+	/* The (item) type
+	 */
+	int type;
+
+	/* The data size
+	 */
+	uint16_t data_size;
+
+	/* The class type
+	 */
+	uint8_t class_type;
+
+	/* The fingerprint of the items up to and including this item
+	 */
+	uint64_t prefix_fingerprint;
+};
+
 typedef struct libfwsi_internal_item_list libfwsi_internal_item_list_t;
 
 struct libfwsi_internal_item_list
 {
-	/* The items array
+	/* The item entries, stored contiguously
+	 * The entry and the item pointer of an item share the same item index
+	 */
+	libfwsi_item_list_entry_t *entries;
+
+	/* The item pointers, stored contiguously and parallel to the item entries
+	 * The items themselves are allocated individually
+	 */
+	libfwsi_internal_item_t **items;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The number of allocated entries and items
 	 */
-	libcdata_array_t *items_array;
+	int number_of_allocated_items;
 
 	/* The data size
 	 */
@@ -49,6 +98,10 @@ struct libfwsi_internal_item_list
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
+
+	/* The reference count
+	 */
+	libfwsi_reference_count_t reference_count;
 };
 
 LIBFWSI_EXTERN \
@@ -56,6 +109,11 @@ int libfwsi_item_list_initialize(
      libfwsi_item_list_t **item_list,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_list_retain(
+     libfwsi_item_list_t *item_list,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_list_free(
      libfwsi_item_list_t **item_list,
@@ -69,18 +127,100 @@ int libfwsi_item_list_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_list_copy_from_byte_stream_with_options(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     int *parse_status,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_copy_from_byte_stream_with_status(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     int *parse_status,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_copy_from_byte_stream_with_filter(
+     libfwsi_item_list_t *item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_filter_t *filter,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_validate(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint32_t flags,
+     size_t *consumed,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_read_items(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwsi_internal_parse_options_t *parse_options,
+     int *parse_status,
+     size_t *parse_offset,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_read_item(
+     libfwsi_internal_item_list_t *internal_item_list,
+     const uint8_t *byte_stream,
+     size_t shell_item_size,
+     int ascii_codepage,
+     libfwsi_internal_parse_options_t *parse_options,
+     libfwsi_item_t *parent_item,
+     size_t *allocation_size,
+     int *parse_status,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_append_item(
+     libfwsi_internal_item_list_t *internal_item_list,
+     libfwsi_internal_item_t *internal_item,
+     size_t offset,
+     uint64_t item_fingerprint,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_list_get_data_size(
      libfwsi_item_list_t *item_list,
      size_t *data_size,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_memory_usage(
+     libfwsi_item_list_t *item_list,
+     size_t *structs_size,
+     size_t *strings_size,
+     size_t *arrays_size,
+     size_t *extension_blocks_size,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_list_get_number_of_items(
      libfwsi_item_list_t *item_list,
      int *number_of_items,
      libcerror_error_t **error );
 
+int libfwsi_internal_item_list_get_entry(
+     libfwsi_internal_item_list_t *internal_item_list,
+     int item_index,
+     libfwsi_item_list_entry_t **entry,
+     libcerror_error_t **error );
+
 LIBFWSI_EXTERN \
 int libfwsi_item_list_get_item(
      libfwsi_item_list_t *item_list,
@@ -88,6 +228,74 @@ int libfwsi_item_list_get_item(
      libfwsi_item_t **item,
      libcerror_error_t **error );
 
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_item_type(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     int *type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_item_class_type(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     uint8_t *class_type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_item_signature(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     uint32_t *signature,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_item_data_size(
+     libfwsi_item_list_t *item_list,
+     int item_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+uint64_t libfwsi_item_list_calculate_item_fingerprint(
+          const uint8_t *data,
+          size_t data_size );
+
+uint64_t libfwsi_item_list_get_fingerprint_multiplier(
+          int number_of_items );
+
+uint64_t libfwsi_internal_item_list_get_range_fingerprint(
+          libfwsi_internal_item_list_t *internal_item_list,
+          int first_item_index,
+          int number_of_items );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_get_prefix_fingerprint(
+     libfwsi_item_list_t *item_list,
+     int number_of_items,
+     uint64_t *fingerprint,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_compare_items(
+     libfwsi_internal_item_list_t *first_internal_item_list,
+     libfwsi_internal_item_list_t *second_internal_item_list,
+     int *number_of_common_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_compare(
+     libfwsi_item_list_t *first_item_list,
+     libfwsi_item_list_t *second_item_list,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_diff(
+     libfwsi_item_list_t *first_item_list,
+     libfwsi_item_list_t *second_item_list,
+     int *number_of_common_items,
+     int *first_number_of_differing_items,
+     int *second_number_of_differing_items,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
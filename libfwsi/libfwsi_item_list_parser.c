@@ -0,0 +1,676 @@
+/*
+ * Incremental shell item list parser functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_codepage.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_item_list_parser.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_parse_options.h"
+#include "libfwsi_types.h"
+
+/* Creates an item list parser
+ * Make sure the value item_list_parser is referencing, is set to NULL
+ * The shell items are appended to the item list and the item list parser holds
+ * a reference to the item list, hence the item list remains available
+ * until the item list parser is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_parser_initialize(
+     libfwsi_item_list_parser_t **item_list_parser,
+     libfwsi_item_list_t *item_list,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_parser_t *internal_item_list_parser = NULL;
+	static char *function                                          = "libfwsi_item_list_parser_initialize";
+
+	if( item_list_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_list_parser != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item list parser value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBFWSI_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBFWSI_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_parser = memory_allocate_structure(
+	                             libfwsi_internal_item_list_parser_t );
+
+	if( internal_item_list_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item list parser.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_item_list_parser,
+	     0,
+	     sizeof( libfwsi_internal_item_list_parser_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item list parser.",
+		 function );
+
+		goto on_error;
+	}
+	libfwsi_reference_count_increment(
+	 &( ( (libfwsi_internal_item_list_t *) item_list )->reference_count ) );
+
+	internal_item_list_parser->internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+	internal_item_list_parser->ascii_codepage     = ascii_codepage;
+
+	internal_item_list_parser->internal_item_list->ascii_codepage = ascii_codepage;
+
+	*item_list_parser = (libfwsi_item_list_parser_t *) internal_item_list_parser;
+
+	return( 1 );
+
+on_error:
+	if( internal_item_list_parser != NULL )
+	{
+		memory_free(
+		 internal_item_list_parser );
+	}
+	return( -1 );
+}
+
+/* Frees an item list parser
+ * Releases the reference the item list parser holds to the item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_parser_free(
+     libfwsi_item_list_parser_t **item_list_parser,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_parser_t *internal_item_list_parser = NULL;
+	static char *function                                          = "libfwsi_item_list_parser_free";
+	int result                                                     = 1;
+
+	if( item_list_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_list_parser != NULL )
+	{
+		internal_item_list_parser = (libfwsi_internal_item_list_parser_t *) *item_list_parser;
+		*item_list_parser         = NULL;
+
+		if( libfwsi_item_list_free(
+		     (libfwsi_item_list_t **) &( internal_item_list_parser->internal_item_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release item list.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_item_list_parser->buffer != NULL )
+		{
+			memory_free(
+			 internal_item_list_parser->buffer );
+		}
+		memory_free(
+		 internal_item_list_parser );
+	}
+	return( result );
+}
+
+/* Sets the parse options
+ * The limits of the parse options are copied and applied to the shell items read
+ * by subsequent calls of libfwsi_item_list_parser_append_data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_parser_set_parse_options(
+     libfwsi_item_list_parser_t *item_list_parser,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_parser_t *internal_item_list_parser = NULL;
+	static char *function                                          = "libfwsi_item_list_parser_set_parse_options";
+
+	if( item_list_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_parser = (libfwsi_internal_item_list_parser_t *) item_list_parser;
+
+	if( parse_options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse options.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( internal_item_list_parser->parse_options ),
+	     parse_options,
+	     sizeof( libfwsi_internal_parse_options_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy parse options.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends data to the buffer of the partial shell item
+ * The buffer is resized to the required buffer size if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_parser_buffer_data(
+     libfwsi_internal_item_list_parser_t *internal_item_list_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t required_buffer_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libfwsi_internal_item_list_parser_buffer_data";
+
+	if( internal_item_list_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( required_buffer_size > (size_t) UINT16_MAX )
+	 || ( data_size > ( required_buffer_size - internal_item_list_parser->buffer_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid required buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_buffer_size > internal_item_list_parser->allocated_buffer_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_item_list_parser->buffer,
+		                            sizeof( uint8_t ) * required_buffer_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_item_list_parser->buffer                = reallocation;
+		internal_item_list_parser->allocated_buffer_size = required_buffer_size;
+	}
+	if( memory_copy(
+	     &( internal_item_list_parser->buffer[ internal_item_list_parser->buffer_size ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_parser->buffer_size += data_size;
+
+	return( 1 );
+}
+
+/* Reads a complete shell item and appends it to the item list
+ * The previously read shell item is used as the parent shell item
+ * The limits of the parse options of the parser are applied
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_parser_read_item(
+     libfwsi_internal_item_list_parser_t *internal_item_list_parser,
+     const uint8_t *byte_stream,
+     size_t shell_item_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list = NULL;
+	libfwsi_item_t *parent_item                      = NULL;
+	static char *function                            = "libfwsi_internal_item_list_parser_read_item";
+	int parse_status                                 = 0;
+
+	if( internal_item_list_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = internal_item_list_parser->internal_item_list;
+
+	if( ( internal_item_list_parser->parse_options.maximum_number_of_items != 0 )
+	 && ( internal_item_list_parser->number_of_items >= internal_item_list_parser->parse_options.maximum_number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: number of items value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item_list->number_of_items > 0 )
+	{
+		parent_item = (libfwsi_item_t *) internal_item_list->items[ internal_item_list->number_of_items - 1 ];
+	}
+	if( libfwsi_internal_item_list_read_item(
+	     internal_item_list,
+	     byte_stream,
+	     shell_item_size,
+	     internal_item_list_parser->ascii_codepage,
+	     &( internal_item_list_parser->parse_options ),
+	     parent_item,
+	     &( internal_item_list_parser->allocation_size ),
+	     &parse_status,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read shell item: %d.",
+		 function,
+		 internal_item_list->number_of_items );
+
+		return( -1 );
+	}
+	internal_item_list_parser->number_of_items += 1;
+
+	return( 1 );
+}
+
+/* Appends data to the shell item list
+ * The data is treated as the continuation of the data of previous calls
+ * Shell items are read as soon as all their data is available, data of
+ * a partial shell item is retained until the next call
+ * Consumed contains the number of bytes of the data that were used, which
+ * is less than the data size if the terminator was read
+ * Returns 1 if the terminator was read, 0 if more data is expected or -1 on error
+ */
+int libfwsi_item_list_parser_append_data(
+     libfwsi_item_list_parser_t *item_list_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *consumed,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_parser_t *internal_item_list_parser = NULL;
+	static char *function                                          = "libfwsi_item_list_parser_append_data";
+	size_t data_offset                                             = 0;
+	size_t read_size                                               = 0;
+	size_t required_buffer_size                                    = 0;
+	uint16_t shell_item_size                                       = 0;
+
+	if( item_list_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_parser = (libfwsi_internal_item_list_parser_t *) item_list_parser;
+
+	if( internal_item_list_parser->is_corrupted != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item list parser - previous data is corrupted.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( consumed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid consumed.",
+		 function );
+
+		return( -1 );
+	}
+	*consumed = 0;
+
+	if( internal_item_list_parser->is_complete != 0 )
+	{
+		return( 1 );
+	}
+	/* Complete the partial shell item of the previous call
+	 */
+	while( internal_item_list_parser->buffer_size > 0 )
+	{
+		required_buffer_size = 2;
+
+		if( internal_item_list_parser->buffer_size >= 2 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 internal_item_list_parser->buffer,
+			 shell_item_size );
+
+			if( shell_item_size == 0 )
+			{
+				internal_item_list_parser->internal_item_list->data_size += 2;
+
+				internal_item_list_parser->buffer_size = 0;
+				internal_item_list_parser->is_complete = 1;
+
+				break;
+			}
+			if( internal_item_list_parser->buffer_size >= (size_t) shell_item_size )
+			{
+				if( libfwsi_internal_item_list_parser_read_item(
+				     internal_item_list_parser,
+				     internal_item_list_parser->buffer,
+				     (size_t) shell_item_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffered shell item.",
+					 function );
+
+					goto on_error;
+				}
+				internal_item_list_parser->buffer_size = 0;
+
+				break;
+			}
+			required_buffer_size = (size_t) shell_item_size;
+		}
+		if( data_offset >= data_size )
+		{
+			break;
+		}
+		read_size = required_buffer_size - internal_item_list_parser->buffer_size;
+
+		if( read_size > ( data_size - data_offset ) )
+		{
+			read_size = data_size - data_offset;
+		}
+		if( libfwsi_internal_item_list_parser_buffer_data(
+		     internal_item_list_parser,
+		     &( data[ data_offset ] ),
+		     read_size,
+		     required_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to buffer data.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += read_size;
+	}
+	/* Read the shell items that are fully contained in the data without buffering
+	 */
+	if( ( internal_item_list_parser->buffer_size == 0 )
+	 && ( internal_item_list_parser->is_complete == 0 ) )
+	{
+		while( ( data_size - data_offset ) >= 2 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ data_offset ] ),
+			 shell_item_size );
+
+			if( shell_item_size == 0 )
+			{
+				internal_item_list_parser->internal_item_list->data_size += 2;
+
+				internal_item_list_parser->is_complete = 1;
+
+				data_offset += 2;
+
+				break;
+			}
+			if( (size_t) shell_item_size > ( data_size - data_offset ) )
+			{
+				break;
+			}
+			if( libfwsi_internal_item_list_parser_read_item(
+			     internal_item_list_parser,
+			     &( data[ data_offset ] ),
+			     (size_t) shell_item_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read shell item at offset: %" PRIzd ".",
+				 function,
+				 data_offset );
+
+				goto on_error;
+			}
+			data_offset += shell_item_size;
+		}
+		if( ( internal_item_list_parser->is_complete == 0 )
+		 && ( data_offset < data_size ) )
+		{
+			read_size            = data_size - data_offset;
+			required_buffer_size = 2;
+
+			if( read_size >= 2 )
+			{
+				required_buffer_size = (size_t) shell_item_size;
+			}
+			if( libfwsi_internal_item_list_parser_buffer_data(
+			     internal_item_list_parser,
+			     &( data[ data_offset ] ),
+			     read_size,
+			     required_buffer_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to buffer data.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset += read_size;
+		}
+	}
+	*consumed = data_offset;
+
+	return( (int) internal_item_list_parser->is_complete );
+
+on_error:
+	internal_item_list_parser->is_corrupted = 1;
+
+	return( -1 );
+}
+
+/* Determines if the terminator of the shell item list was read
+ * Returns 1 if complete, 0 if not or -1 on error
+ */
+int libfwsi_item_list_parser_is_complete(
+     libfwsi_item_list_parser_t *item_list_parser,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_parser_t *internal_item_list_parser = NULL;
+	static char *function                                          = "libfwsi_item_list_parser_is_complete";
+
+	if( item_list_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_parser = (libfwsi_internal_item_list_parser_t *) item_list_parser;
+
+	return( (int) internal_item_list_parser->is_complete );
+}
+
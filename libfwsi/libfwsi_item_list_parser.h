@@ -0,0 +1,132 @@
+/*
+ * Incremental shell item list parser functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_ITEM_LIST_PARSER_H )
+#define _LIBFWSI_ITEM_LIST_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_parse_options.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_internal_item_list_parser libfwsi_internal_item_list_parser_t;
+
+struct libfwsi_internal_item_list_parser
+{
+	/* The item list
+	 */
+	libfwsi_internal_item_list_t *internal_item_list;
+
+	/* The codepage of the extended ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The parse options, where zero values represent no limits
+	 */
+	libfwsi_internal_parse_options_t parse_options;
+
+	/* The number of shell items read by the parser
+	 */
+	int number_of_items;
+
+	/* The number of bytes allocated by the shell items read by the parser
+	 */
+	size_t allocation_size;
+
+	/* The buffer containing the data of a partial shell item
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The allocated buffer size
+	 */
+	size_t allocated_buffer_size;
+
+	/* Value to indicate the terminator was read
+	 */
+	uint8_t is_complete;
+
+	/* Value to indicate a previous call failed
+	 */
+	uint8_t is_corrupted;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_parser_initialize(
+     libfwsi_item_list_parser_t **item_list_parser,
+     libfwsi_item_list_t *item_list,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_parser_free(
+     libfwsi_item_list_parser_t **item_list_parser,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_parser_set_parse_options(
+     libfwsi_item_list_parser_t *item_list_parser,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_parser_buffer_data(
+     libfwsi_internal_item_list_parser_t *internal_item_list_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t required_buffer_size,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_parser_read_item(
+     libfwsi_internal_item_list_parser_t *internal_item_list_parser,
+     const uint8_t *byte_stream,
+     size_t shell_item_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_parser_append_data(
+     libfwsi_item_list_parser_t *item_list_parser,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *consumed,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_parser_is_complete(
+     libfwsi_item_list_parser_t *item_list_parser,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ITEM_LIST_PARSER_H ) */
+
@@ -0,0 +1,787 @@
+/*
+ * Item list view functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_item_list_view.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+/* Creates an item list view
+ * Make sure the value item_list_view is referencing, is set to NULL
+ * The item list view references the items of the item list without copying them
+ * and holds a reference to the item list, hence the item list remains available
+ * until the item list view is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_initialize(
+     libfwsi_item_list_view_t **item_list_view,
+     libfwsi_item_list_t *item_list,
+     int first_item_index,
+     int number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_t *internal_item_list           = NULL;
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_initialize";
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_list_view != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item list view value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	if( ( first_item_index < 0 )
+	 || ( first_item_index > internal_item_list->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_items < 0 )
+	 || ( number_of_items > ( internal_item_list->number_of_items - first_item_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = memory_allocate_structure(
+	                           libfwsi_internal_item_list_view_t );
+
+	if( internal_item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item list view.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_item_list_view,
+	     0,
+	     sizeof( libfwsi_internal_item_list_view_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item list view.",
+		 function );
+
+		memory_free(
+		 internal_item_list_view );
+
+		return( -1 );
+	}
+	libfwsi_reference_count_increment(
+	 &( internal_item_list->reference_count ) );
+
+	internal_item_list_view->item_list        = internal_item_list;
+	internal_item_list_view->first_item_index = first_item_index;
+	internal_item_list_view->number_of_items  = number_of_items;
+
+	internal_item_list_view->fingerprint = libfwsi_internal_item_list_get_range_fingerprint(
+	                                        internal_item_list,
+	                                        first_item_index,
+	                                        number_of_items );
+
+	*item_list_view = (libfwsi_item_list_view_t *) internal_item_list_view;
+
+	return( 1 );
+}
+
+/* Frees an item list view
+ * Releases the reference the item list view holds to the item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_free(
+     libfwsi_item_list_view_t **item_list_view,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_free";
+	int result                                                 = 1;
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_list_view != NULL )
+	{
+		internal_item_list_view = (libfwsi_internal_item_list_view_t *) *item_list_view;
+		*item_list_view         = NULL;
+
+		if( libfwsi_item_list_free(
+		     (libfwsi_item_list_t **) &( internal_item_list_view->item_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release item list.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_item_list_view );
+	}
+	return( result );
+}
+
+/* Retrieves the item index in the item list of a specific item of the item list view
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_item_list_view_get_list_item_index(
+     libfwsi_internal_item_list_view_t *internal_item_list_view,
+     int item_index,
+     int *list_item_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_internal_item_list_view_get_list_item_index";
+
+	if( internal_item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item_index < 0 )
+	 || ( item_index >= internal_item_list_view->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( list_item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid list item index.",
+		 function );
+
+		return( -1 );
+	}
+	*list_item_index = internal_item_list_view->first_item_index + item_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of items
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_number_of_items(
+     libfwsi_item_list_view_t *item_list_view,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_number_of_items";
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_items = internal_item_list_view->number_of_items;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the first item in the item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_first_item_index(
+     libfwsi_item_list_view_t *item_list_view,
+     int *first_item_index,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_first_item_index";
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( first_item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first item index.",
+		 function );
+
+		return( -1 );
+	}
+	*first_item_index = internal_item_list_view->first_item_index;
+
+	return( 1 );
+}
+
+/* Retrieves the data size of the items
+ * The data size does not include the size of the terminator
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_data_size(
+     libfwsi_item_list_view_t *item_list_view,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	libfwsi_item_list_entry_t *first_entry                     = NULL;
+	libfwsi_item_list_entry_t *last_entry                      = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_data_size";
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = 0;
+
+	if( internal_item_list_view->number_of_items > 0 )
+	{
+		first_entry = &( internal_item_list_view->item_list->entries[ internal_item_list_view->first_item_index ] );
+		last_entry  = &( internal_item_list_view->item_list->entries[ internal_item_list_view->first_item_index + internal_item_list_view->number_of_items - 1 ] );
+
+		*data_size = ( last_entry->offset + last_entry->data_size ) - first_entry->offset;
+	}
+
+	return( 1 );
+}
+
+/* Retrieves the fingerprint of the items
+ * The same sequence of items has the same fingerprint in any item list or item list view
+ * and an item list view of the first items has the prefix fingerprint of the item list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_fingerprint(
+     libfwsi_item_list_view_t *item_list_view,
+     uint64_t *fingerprint,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_fingerprint";
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	*fingerprint = internal_item_list_view->fingerprint;
+
+	return( 1 );
+}
+
+/* Retrieves the fingerprint of the items without the last item
+ * This is the fingerprint of the parent path of the item list view
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_parent_fingerprint(
+     libfwsi_item_list_view_t *item_list_view,
+     uint64_t *fingerprint,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_parent_fingerprint";
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item_list_view->number_of_items == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item list view - number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*fingerprint = libfwsi_internal_item_list_get_range_fingerprint(
+	                internal_item_list_view->item_list,
+	                internal_item_list_view->first_item_index,
+	                internal_item_list_view->number_of_items - 1 );
+
+	return( 1 );
+}
+
+/* Retrieves a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_item(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     libfwsi_item_t **item,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_item";
+	int list_item_index                                        = 0;
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( libfwsi_internal_item_list_view_get_list_item_index(
+	     internal_item_list_view,
+	     item_index,
+	     &list_item_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item index of item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( libfwsi_item_list_get_item(
+	     (libfwsi_item_list_t *) internal_item_list_view->item_list,
+	     list_item_index,
+	     item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item: %d.",
+		 function,
+		 list_item_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the type of a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_item_type(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     int *type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_item_type";
+	int list_item_index                                        = 0;
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( libfwsi_internal_item_list_view_get_list_item_index(
+	     internal_item_list_view,
+	     item_index,
+	     &list_item_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item index of item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( libfwsi_item_list_get_item_type(
+	     (libfwsi_item_list_t *) internal_item_list_view->item_list,
+	     list_item_index,
+	     type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type of list item: %d.",
+		 function,
+		 list_item_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the class type of a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_item_class_type(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     uint8_t *class_type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_item_class_type";
+	int list_item_index                                        = 0;
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( libfwsi_internal_item_list_view_get_list_item_index(
+	     internal_item_list_view,
+	     item_index,
+	     &list_item_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item index of item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( libfwsi_item_list_get_item_class_type(
+	     (libfwsi_item_list_t *) internal_item_list_view->item_list,
+	     list_item_index,
+	     class_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve class type of list item: %d.",
+		 function,
+		 list_item_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the signature of a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_item_signature(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     uint32_t *signature,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_item_signature";
+	int list_item_index                                        = 0;
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( libfwsi_internal_item_list_view_get_list_item_index(
+	     internal_item_list_view,
+	     item_index,
+	     &list_item_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item index of item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( libfwsi_item_list_get_item_signature(
+	     (libfwsi_item_list_t *) internal_item_list_view->item_list,
+	     list_item_index,
+	     signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve signature of list item: %d.",
+		 function,
+		 list_item_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data size of a specific item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_list_view_get_item_data_size(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_list_view_t *internal_item_list_view = NULL;
+	static char *function                                      = "libfwsi_item_list_view_get_item_data_size";
+	int list_item_index                                        = 0;
+
+	if( item_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list_view = (libfwsi_internal_item_list_view_t *) item_list_view;
+
+	if( libfwsi_internal_item_list_view_get_list_item_index(
+	     internal_item_list_view,
+	     item_index,
+	     &list_item_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list item index of item: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	if( libfwsi_item_list_get_item_data_size(
+	     (libfwsi_item_list_t *) internal_item_list_view->item_list,
+	     list_item_index,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size of list item: %d.",
+		 function,
+		 list_item_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,148 @@
+/*
+ * Item list view functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFWSI_ITEM_LIST_VIEW_H )
+#define _LIBFWSI_ITEM_LIST_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_internal_item_list_view libfwsi_internal_item_list_view_t;
+
+struct libfwsi_internal_item_list_view
+{
+	/* The item list
+	 */
+	libfwsi_internal_item_list_t *item_list;
+
+	/* The index of the first item in the item list
+	 */
+	int first_item_index;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The fingerprint of the items
+	 */
+	uint64_t fingerprint;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_initialize(
+     libfwsi_item_list_view_t **item_list_view,
+     libfwsi_item_list_t *item_list,
+     int first_item_index,
+     int number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_free(
+     libfwsi_item_list_view_t **item_list_view,
+     libcerror_error_t **error );
+
+int libfwsi_internal_item_list_view_get_list_item_index(
+     libfwsi_internal_item_list_view_t *internal_item_list_view,
+     int item_index,
+     int *list_item_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_number_of_items(
+     libfwsi_item_list_view_t *item_list_view,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_first_item_index(
+     libfwsi_item_list_view_t *item_list_view,
+     int *first_item_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_data_size(
+     libfwsi_item_list_view_t *item_list_view,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_fingerprint(
+     libfwsi_item_list_view_t *item_list_view,
+     uint64_t *fingerprint,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_parent_fingerprint(
+     libfwsi_item_list_view_t *item_list_view,
+     uint64_t *fingerprint,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_item(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     libfwsi_item_t **item,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_item_type(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     int *type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_item_class_type(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     uint8_t *class_type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_item_signature(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     uint32_t *signature,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_item_list_view_get_item_data_size(
+     libfwsi_item_list_view_t *item_list_view,
+     int item_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ITEM_LIST_VIEW_H ) */
+
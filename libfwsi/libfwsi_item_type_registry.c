@@ -0,0 +1,1330 @@
+/*
+ * Item type registry functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_cdburn_values.h"
+#include "libfwsi_compressed_folder_values.h"
+#include "libfwsi_control_panel_values.h"
+#include "libfwsi_control_panel_category_values.h"
+#include "libfwsi_control_panel_cpl_file_values.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_delegate_values.h"
+#include "libfwsi_file_entry_values.h"
+#include "libfwsi_game_folder_values.h"
+#include "libfwsi_item_type_registry.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_mtp_file_entry_values.h"
+#include "libfwsi_mtp_volume_values.h"
+#include "libfwsi_network_location_values.h"
+#include "libfwsi_parse_options.h"
+#include "libfwsi_root_folder_values.h"
+#include "libfwsi_types.h"
+#include "libfwsi_unknown_0x74_values.h"
+#include "libfwsi_unused.h"
+#include "libfwsi_uri_values.h"
+#include "libfwsi_uri_sub_values.h"
+#include "libfwsi_users_property_view_values.h"
+#include "libfwsi_values_type.h"
+#include "libfwsi_volume_values.h"
+
+/* The built-in item type definitions, indexed by the item type
+ */
+const libfwsi_item_type_definition_t libfwsi_item_type_registry_definitions[ LIBFWSI_ITEM_TYPE_UNKNOWN_0x74 + 1 ] = {
+	{ LIBFWSI_ITEM_TYPE_UNKNOWN,
+	  NULL,
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+
+#if !defined( LIBFWSI_WITHOUT_CDBURN_PARSER )
+	{ LIBFWSI_ITEM_TYPE_CDBURN,
+	  "CD burn",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_CDBURN,
+	  NULL,
+	  sizeof( libfwsi_cdburn_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_cdburn_values_initialize,
+	  &libfwsi_item_type_registry_read_cdburn_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_cdburn_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_CDBURN,
+	  "CD burn",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER )
+	{ LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER,
+	  "compressed folder",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_COMPRESSED_FOLDER,
+	  NULL,
+	  sizeof( libfwsi_compressed_folder_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_compressed_folder_values_initialize,
+	  &libfwsi_item_type_registry_read_compressed_folder_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_compressed_folder_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER,
+	  "compressed folder",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER )
+	{ LIBFWSI_ITEM_TYPE_CONTROL_PANEL,
+	  "control panel",
+	  0,
+	  LIBFWSI_VALUES_TYPE_CONTROL_PANEL,
+	  NULL,
+	  sizeof( libfwsi_control_panel_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_values_initialize,
+	  &libfwsi_item_type_registry_read_control_panel_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_CONTROL_PANEL,
+	  "control panel",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CATEGORY_PARSER )
+	{ LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY,
+	  "control panel category",
+	  0,
+	  LIBFWSI_VALUES_TYPE_CONTROL_PANEL_CATEGORY,
+	  NULL,
+	  sizeof( libfwsi_control_panel_category_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_category_values_initialize,
+	  &libfwsi_item_type_registry_read_control_panel_category_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_category_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY,
+	  "control panel category",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER )
+	{ LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE,
+	  "control panel CPL file",
+	  0,
+	  LIBFWSI_VALUES_TYPE_CONTROL_PANEL_CPL_FILE,
+	  NULL,
+	  sizeof( libfwsi_control_panel_cpl_file_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_cpl_file_values_initialize,
+	  &libfwsi_item_type_registry_read_control_panel_cpl_file_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_control_panel_cpl_file_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE,
+	  "control panel CPL file",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER )
+	{ LIBFWSI_ITEM_TYPE_DELEGATE,
+	  "delegate",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_DELEGATE,
+	  NULL,
+	  sizeof( libfwsi_delegate_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_delegate_values_initialize,
+	  &libfwsi_item_type_registry_read_delegate_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_delegate_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_DELEGATE,
+	  "delegate",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+	{ LIBFWSI_ITEM_TYPE_FILE_ENTRY,
+	  "file entry",
+	  0,
+	  LIBFWSI_VALUES_TYPE_FILE_ENTRY,
+	  NULL,
+	  sizeof( libfwsi_file_entry_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_values_initialize,
+	  &libfwsi_item_type_registry_read_file_entry_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_file_entry_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_FILE_ENTRY,
+	  "file entry",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_GAME_FOLDER_PARSER )
+	{ LIBFWSI_ITEM_TYPE_GAME_FOLDER,
+	  "game folder",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_GAME_FOLDER,
+	  NULL,
+	  sizeof( libfwsi_game_folder_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_game_folder_values_initialize,
+	  &libfwsi_item_type_registry_read_game_folder_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_game_folder_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_GAME_FOLDER,
+	  "game folder",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER )
+	{ LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY,
+	  "MTP file entry",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_MTP_FILE_ENTRY,
+	  NULL,
+	  sizeof( libfwsi_mtp_file_entry_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_file_entry_values_initialize,
+	  &libfwsi_item_type_registry_read_mtp_file_entry_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_file_entry_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY,
+	  "MTP file entry",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+	{ LIBFWSI_ITEM_TYPE_MTP_VOLUME,
+	  "MTP volume",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_MTP_VOLUME,
+	  NULL,
+	  sizeof( libfwsi_mtp_volume_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_volume_values_initialize,
+	  &libfwsi_item_type_registry_read_mtp_volume_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_mtp_volume_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_MTP_VOLUME,
+	  "MTP volume",
+	  LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER )
+	{ LIBFWSI_ITEM_TYPE_NETWORK_LOCATION,
+	  "network location",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NETWORK_LOCATION,
+	  NULL,
+	  sizeof( libfwsi_network_location_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_network_location_values_initialize,
+	  &libfwsi_item_type_registry_read_network_location_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_network_location_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_NETWORK_LOCATION,
+	  "network location",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER )
+	{ LIBFWSI_ITEM_TYPE_ROOT_FOLDER,
+	  "root folder",
+	  0,
+	  LIBFWSI_VALUES_TYPE_ROOT_FOLDER,
+	  NULL,
+	  sizeof( libfwsi_root_folder_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_root_folder_values_initialize,
+	  &libfwsi_item_type_registry_read_root_folder_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_root_folder_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_ROOT_FOLDER,
+	  "root folder",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+	{ LIBFWSI_ITEM_TYPE_URI,
+	  "URI",
+	  0,
+	  LIBFWSI_VALUES_TYPE_URI,
+	  NULL,
+	  sizeof( libfwsi_uri_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_values_initialize,
+	  &libfwsi_item_type_registry_read_uri_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_URI,
+	  "URI",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER )
+	{ LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW,
+	  "users property view",
+	  0,
+	  LIBFWSI_VALUES_TYPE_USERS_PROPERTY_VIEW,
+	  NULL,
+	  sizeof( libfwsi_users_property_view_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_users_property_view_values_initialize,
+	  &libfwsi_item_type_registry_read_users_property_view_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_users_property_view_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW,
+	  "users property view",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_VOLUME_PARSER )
+	{ LIBFWSI_ITEM_TYPE_VOLUME,
+	  "volume",
+	  0,
+	  LIBFWSI_VALUES_TYPE_VOLUME,
+	  NULL,
+	  sizeof( libfwsi_volume_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_volume_values_initialize,
+	  &libfwsi_item_type_registry_read_volume_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_volume_values_free },
+#else
+	{ LIBFWSI_ITEM_TYPE_VOLUME,
+	  "volume",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL },
+#endif
+
+#if !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER )
+	{ LIBFWSI_ITEM_TYPE_UNKNOWN_0x74,
+	  "unknown 0x74",
+	  0,
+	  LIBFWSI_VALUES_TYPE_UNKNOWN_0x74,
+	  NULL,
+	  sizeof( libfwsi_unknown_0x74_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_unknown_0x74_values_initialize,
+	  &libfwsi_item_type_registry_read_unknown_0x74_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_unknown_0x74_values_free }
+#else
+	{ LIBFWSI_ITEM_TYPE_UNKNOWN_0x74,
+	  "unknown 0x74",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL }
+#endif
+};
+
+/* The definition of the sub items of an URI item
+ */
+const libfwsi_item_type_definition_t libfwsi_item_type_registry_uri_sub_definition =
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+	{ LIBFWSI_ITEM_TYPE_URI,
+	  "URI sub",
+	  0,
+	  LIBFWSI_VALUES_TYPE_URI_SUB,
+	  NULL,
+	  sizeof( libfwsi_uri_sub_values_t ),
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_sub_values_initialize,
+	  &libfwsi_item_type_registry_read_uri_sub_values,
+	  (int (*)(intptr_t **, libcerror_error_t **)) &libfwsi_uri_sub_values_free };
+#else
+	{ LIBFWSI_ITEM_TYPE_URI,
+	  "URI sub",
+	  0,
+	  LIBFWSI_VALUES_TYPE_NONE,
+	  NULL,
+	  0,
+	  NULL,
+	  NULL,
+	  NULL };
+#endif
+
+/* The signatures decision table, sorted by offset
+ * An item with a data size that cannot contain the signature at the offset is not matched
+ */
+const libfwsi_item_type_signature_t libfwsi_item_type_registry_signatures[ 12 ] = {
+	{ 4, 0x39de2184UL, LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CATEGORY },
+	/* "AugM" */
+	{ 4, 0x4d677541UL, LIBFWSI_ITEM_TYPE_CDBURN },
+	/* "GFSI" */
+	{ 4, 0x49534647UL, LIBFWSI_ITEM_TYPE_GAME_FOLDER },
+	{ 4, 0xffffff38UL, LIBFWSI_ITEM_TYPE_CONTROL_PANEL_CPL_FILE },
+
+	{ 6, 0x07192006UL, LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY },
+	{ 6, 0x10312005UL, LIBFWSI_ITEM_TYPE_MTP_VOLUME },
+	{ 6, 0x10141981UL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 6, 0x23a3dfd5UL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 6, 0x23febbeeUL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 6, 0x3b93afbbUL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 6, 0xbeebee00UL, LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW },
+	{ 6, 0x46534643UL, LIBFWSI_ITEM_TYPE_UNKNOWN_0x74 } };
+
+/* The class types decision table, indexed by bits 4 to 6 of the class type
+ */
+const libfwsi_item_type_class_type_t libfwsi_item_type_registry_class_types[ 8 ] = {
+	{ 0x00, LIBFWSI_ITEM_TYPE_UNKNOWN },
+	{ 0x1f, LIBFWSI_ITEM_TYPE_ROOT_FOLDER },
+	{ 0x00, LIBFWSI_ITEM_TYPE_VOLUME },
+	{ 0x00, LIBFWSI_ITEM_TYPE_FILE_ENTRY },
+	{ 0x00, LIBFWSI_ITEM_TYPE_NETWORK_LOCATION },
+	{ 0x52, LIBFWSI_ITEM_TYPE_COMPRESSED_FOLDER },
+	{ 0x61, LIBFWSI_ITEM_TYPE_URI },
+	{ 0x71, LIBFWSI_ITEM_TYPE_CONTROL_PANEL } };
+
+/* The registered item type definitions
+ */
+static libfwsi_item_type_definition_t libfwsi_item_type_registry_registered_item_types[ LIBFWSI_ITEM_TYPE_REGISTRY_MAXIMUM_NUMBER_OF_REGISTERED_ITEM_TYPES ];
+
+/* The number of registered item type definitions
+ */
+static int libfwsi_item_type_registry_number_of_registered_item_types = 0;
+
+/* Registers an item type
+ * The item type must be LIBFWSI_ITEM_TYPE_USER_DEFINED or greater
+ * Registered item types are matched in order of registration before the built-in item types
+ * The match function is passed the item data including the 16-bit size and
+ * returns 1 if the item data contains the item type, 0 if not or -1 on error
+ * The read function returns 1 if successful, 0 if not supported or -1 on error
+ * The item types must not be changed while items are being read
+ * and are not protected against concurrent modification
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_register_item_type(
+     int item_type,
+     int (*match_function)(
+            const uint8_t *data,
+            size_t data_size,
+            libcerror_error_t **error ),
+     size_t values_size,
+     int (*initialize_function)(
+            intptr_t **values,
+            libcerror_error_t **error ),
+     int (*read_function)(
+            intptr_t *values,
+            const uint8_t *data,
+            size_t data_size,
+            int ascii_codepage,
+            libfwsi_parse_options_t *parse_options,
+            libcerror_error_t **error ),
+     int (*free_function)(
+            intptr_t **values,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libfwsi_item_type_definition_t *definition = NULL;
+	static char *function                      = "libfwsi_register_item_type";
+	int definition_index                       = 0;
+
+	if( item_type < LIBFWSI_ITEM_TYPE_USER_DEFINED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match function.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid values size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialize_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialize function.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free function.",
+		 function );
+
+		return( -1 );
+	}
+	for( definition_index = 0;
+	     definition_index < libfwsi_item_type_registry_number_of_registered_item_types;
+	     definition_index++ )
+	{
+		if( libfwsi_item_type_registry_registered_item_types[ definition_index ].item_type == item_type )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: item type: %d already registered.",
+			 function,
+			 item_type );
+
+			return( -1 );
+		}
+	}
+	if( libfwsi_item_type_registry_number_of_registered_item_types >= LIBFWSI_ITEM_TYPE_REGISTRY_MAXIMUM_NUMBER_OF_REGISTERED_ITEM_TYPES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of registered item types value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	definition = &( libfwsi_item_type_registry_registered_item_types[ libfwsi_item_type_registry_number_of_registered_item_types ] );
+
+	definition->item_type         = item_type;
+	definition->name              = "user defined";
+	definition->flags             = 0;
+	definition->values_type       = LIBFWSI_VALUES_TYPE_USER_DEFINED;
+	definition->match             = match_function;
+	definition->values_size       = values_size;
+	definition->initialize_values = initialize_function;
+	definition->read_values       = read_function;
+	definition->free_values       = free_function;
+
+	libfwsi_item_type_registry_number_of_registered_item_types++;
+
+	return( 1 );
+}
+
+/* Unregisters an item type
+ * Items of the item type that were read before must be freed before the item type is unregistered
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_unregister_item_type(
+     int item_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_unregister_item_type";
+	int definition_index  = 0;
+
+	for( definition_index = 0;
+	     definition_index < libfwsi_item_type_registry_number_of_registered_item_types;
+	     definition_index++ )
+	{
+		if( libfwsi_item_type_registry_registered_item_types[ definition_index ].item_type == item_type )
+		{
+			break;
+		}
+	}
+	if( definition_index >= libfwsi_item_type_registry_number_of_registered_item_types )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: %d not registered.",
+		 function,
+		 item_type );
+
+		return( -1 );
+	}
+	libfwsi_item_type_registry_number_of_registered_item_types--;
+
+	while( definition_index < libfwsi_item_type_registry_number_of_registered_item_types )
+	{
+		libfwsi_item_type_registry_registered_item_types[ definition_index ] = libfwsi_item_type_registry_registered_item_types[ definition_index + 1 ];
+
+		definition_index++;
+	}
+	return( 1 );
+}
+
+/* Classifies item data
+ * The data must start with the 16-bit item size and the data size must be the item size
+ * The class type is only set if the item type was determined from the class type
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_type_registry_classify(
+     const uint8_t *data,
+     size_t data_size,
+     int *item_type,
+     uint8_t *class_type,
+     uint32_t *signature,
+     libcerror_error_t **error )
+{
+	const libfwsi_item_type_class_type_t *class_type_entry = NULL;
+	static char *function                                  = "libfwsi_item_type_registry_classify";
+	size_t signature_offset                                = 0;
+	uint32_t safe_signature                                = 0;
+	uint8_t safe_class_type                                = 0;
+	int definition_index                                   = 0;
+	int result                                             = 0;
+	int safe_item_type                                     = LIBFWSI_ITEM_TYPE_UNKNOWN;
+	int signature_index                                    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 4 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( class_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid class type.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	for( definition_index = 0;
+	     definition_index < libfwsi_item_type_registry_number_of_registered_item_types;
+	     definition_index++ )
+	{
+		result = libfwsi_item_type_registry_registered_item_types[ definition_index ].match(
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to match registered item type: %d.",
+			 function,
+			 libfwsi_item_type_registry_registered_item_types[ definition_index ].item_type );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			safe_item_type = libfwsi_item_type_registry_registered_item_types[ definition_index ].item_type;
+
+			break;
+		}
+	}
+	for( signature_index = 0;
+	     ( safe_item_type == LIBFWSI_ITEM_TYPE_UNKNOWN ) && ( signature_index < 12 );
+	     signature_index++ )
+	{
+		if( ( (size_t) libfwsi_item_type_registry_signatures[ signature_index ].offset + 4 ) > data_size )
+		{
+			break;
+		}
+		if( signature_offset != (size_t) libfwsi_item_type_registry_signatures[ signature_index ].offset )
+		{
+			signature_offset = (size_t) libfwsi_item_type_registry_signatures[ signature_index ].offset;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ signature_offset ] ),
+			 safe_signature );
+		}
+		if( safe_signature == libfwsi_item_type_registry_signatures[ signature_index ].signature )
+		{
+			safe_item_type = libfwsi_item_type_registry_signatures[ signature_index ].item_type;
+		}
+	}
+	if( ( safe_item_type == LIBFWSI_ITEM_TYPE_UNKNOWN )
+	 && ( data_size >= 38 ) )
+	{
+		if( memory_compare(
+		     &( data[ data_size - 32 ] ),
+		     libfwsi_delegate_item_identifier,
+		     16 ) == 0 )
+		{
+			safe_item_type = LIBFWSI_ITEM_TYPE_DELEGATE;
+		}
+	}
+	if( safe_item_type == LIBFWSI_ITEM_TYPE_UNKNOWN )
+	{
+		safe_class_type = data[ 2 ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: class type indicator\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 safe_class_type );
+		}
+#endif
+		class_type_entry = &( libfwsi_item_type_registry_class_types[ ( safe_class_type & 0x70 ) >> 4 ] );
+
+		if( ( class_type_entry->class_type == 0 )
+		 || ( class_type_entry->class_type == safe_class_type ) )
+		{
+			safe_item_type = class_type_entry->item_type;
+		}
+	}
+	/* An item type of which the parser was compiled out is handled as unknown
+	 */
+	if( ( safe_item_type > LIBFWSI_ITEM_TYPE_UNKNOWN )
+	 && ( safe_item_type <= LIBFWSI_ITEM_TYPE_UNKNOWN_0x74 )
+	 && ( libfwsi_item_type_registry_definitions[ safe_item_type ].read_values == NULL ) )
+	{
+		safe_item_type = LIBFWSI_ITEM_TYPE_UNKNOWN;
+	}
+	*item_type  = safe_item_type;
+	*class_type = safe_class_type;
+	*signature  = safe_signature;
+
+	return( 1 );
+}
+
+/* Retrieves the definition of an item type
+ * The sub items of an URI item are read using the URI sub values regardless of their item type
+ * The definition is set to NULL if the item type has no values or its parser was compiled out
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_item_type_registry_get_definition(
+     int item_type,
+     int parent_item_type,
+     const libfwsi_item_type_definition_t **definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_item_type_registry_get_definition";
+	int definition_index  = 0;
+
+	if( definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid definition.",
+		 function );
+
+		return( -1 );
+	}
+	*definition = NULL;
+
+	if( item_type >= LIBFWSI_ITEM_TYPE_USER_DEFINED )
+	{
+		for( definition_index = 0;
+		     definition_index < libfwsi_item_type_registry_number_of_registered_item_types;
+		     definition_index++ )
+		{
+			if( libfwsi_item_type_registry_registered_item_types[ definition_index ].item_type == item_type )
+			{
+				*definition = &( libfwsi_item_type_registry_registered_item_types[ definition_index ] );
+
+				break;
+			}
+		}
+	}
+	else if( parent_item_type == LIBFWSI_ITEM_TYPE_URI )
+	{
+		*definition = &libfwsi_item_type_registry_uri_sub_definition;
+	}
+	else if( ( item_type > LIBFWSI_ITEM_TYPE_UNKNOWN )
+	      && ( item_type <= LIBFWSI_ITEM_TYPE_UNKNOWN_0x74 ) )
+	{
+		*definition = &( libfwsi_item_type_registry_definitions[ item_type ] );
+	}
+	if( ( *definition != NULL )
+	 && ( ( *definition )->read_values == NULL ) )
+	{
+		*definition = NULL;
+	}
+	return( 1 );
+}
+
+#if !defined( LIBFWSI_WITHOUT_CDBURN_PARSER )
+
+/* Reads CD burn values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_cdburn_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_cdburn_values_read_data(
+	         (libfwsi_cdburn_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_CDBURN_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER )
+
+/* Reads compressed folder values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_compressed_folder_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_compressed_folder_values_read_data(
+	         (libfwsi_compressed_folder_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER )
+
+/* Reads control panel values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_control_panel_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_control_panel_values_read_data(
+	         (libfwsi_control_panel_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CATEGORY_PARSER )
+
+/* Reads control panel category values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_control_panel_category_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_control_panel_category_values_read_data(
+	         (libfwsi_control_panel_category_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CATEGORY_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER )
+
+/* Reads control panel CPL file values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_control_panel_cpl_file_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_control_panel_cpl_file_values_read_data(
+	         (libfwsi_control_panel_cpl_file_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER )
+
+/* Reads delegate values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_delegate_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error )
+{
+	return( libfwsi_delegate_values_read_data(
+	         (libfwsi_delegate_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         (libfwsi_internal_parse_options_t *) parse_options,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+
+/* Reads file entry values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_file_entry_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_file_entry_values_read_data(
+	         (libfwsi_file_entry_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_GAME_FOLDER_PARSER )
+
+/* Reads game folder values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_game_folder_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_game_folder_values_read_data(
+	         (libfwsi_game_folder_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_GAME_FOLDER_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER )
+
+/* Reads MTP file entry values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_mtp_file_entry_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_mtp_file_entry_values_read_data(
+	         (libfwsi_mtp_file_entry_values_t *) values,
+	         data,
+	         data_size,
+	         (libfwsi_internal_parse_options_t *) parse_options,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
+/* Reads MTP volume values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_mtp_volume_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	return( libfwsi_mtp_volume_values_read_data(
+	         (libfwsi_mtp_volume_values_t *) values,
+	         data,
+	         data_size,
+	         (libfwsi_internal_parse_options_t *) parse_options,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER )
+
+/* Reads network location values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_network_location_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_network_location_values_read_data(
+	         (libfwsi_network_location_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER )
+
+/* Reads root folder values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_root_folder_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage LIBFWSI_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( ascii_codepage )
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_root_folder_values_read_data(
+	         (libfwsi_root_folder_values_t *) values,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
+/* Reads URI values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_uri_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_uri_values_read_data(
+	         (libfwsi_uri_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER )
+
+/* Reads users property view values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_users_property_view_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_users_property_view_values_read_data(
+	         (libfwsi_users_property_view_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_VOLUME_PARSER )
+
+/* Reads volume values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_volume_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_volume_values_read_data(
+	         (libfwsi_volume_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_VOLUME_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER )
+
+/* Reads unknown 0x74 values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_unknown_0x74_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_unknown_0x74_values_read_data(
+	         (libfwsi_unknown_0x74_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
+/* Reads URI sub values
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwsi_item_type_registry_read_uri_sub_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options LIBFWSI_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	LIBFWSI_UNREFERENCED_PARAMETER( parse_options )
+
+	return( libfwsi_uri_sub_values_read_data(
+	         (libfwsi_uri_sub_values_t *) values,
+	         data,
+	         data_size,
+	         ascii_codepage,
+	         error ) );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
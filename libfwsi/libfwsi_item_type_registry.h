@@ -0,0 +1,380 @@
+/*
+ * Item type registry functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_ITEM_TYPE_REGISTRY_H )
+#define _LIBFWSI_ITEM_TYPE_REGISTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of item types that can be registered
+ */
+#define LIBFWSI_ITEM_TYPE_REGISTRY_MAXIMUM_NUMBER_OF_REGISTERED_ITEM_TYPES	32
+
+/* The item type definition flags
+ */
+#define LIBFWSI_ITEM_TYPE_DEFINITION_FLAG_HAS_SIGNATURE			0x01
+
+typedef struct libfwsi_item_type_definition libfwsi_item_type_definition_t;
+
+struct libfwsi_item_type_definition
+{
+	/* The (item) type
+	 */
+	int item_type;
+
+	/* The name used in error messages
+	 */
+	const char *name;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The values type
+	 */
+	int values_type;
+
+	/* The match function, where NULL indicates the item type
+	 * is classified by the built-in decision tables
+	 */
+	int (*match)(
+	       const uint8_t *data,
+	       size_t data_size,
+	       libcerror_error_t **error );
+
+	/* The size of the values structure
+	 */
+	size_t values_size;
+
+	/* The initialize values function
+	 */
+	int (*initialize_values)(
+	       intptr_t **values,
+	       libcerror_error_t **error );
+
+	/* The read values function
+	 */
+	int (*read_values)(
+	       intptr_t *values,
+	       const uint8_t *data,
+	       size_t data_size,
+	       int ascii_codepage,
+	       libfwsi_parse_options_t *parse_options,
+	       libcerror_error_t **error );
+
+	/* The free values function
+	 */
+	int (*free_values)(
+	       intptr_t **values,
+	       libcerror_error_t **error );
+};
+
+typedef struct libfwsi_item_type_signature libfwsi_item_type_signature_t;
+
+struct libfwsi_item_type_signature
+{
+	/* The offset of the signature relative to the start of the item data
+	 */
+	uint8_t offset;
+
+	/* The signature
+	 */
+	uint32_t signature;
+
+	/* The (item) type
+	 */
+	int item_type;
+};
+
+typedef struct libfwsi_item_type_class_type libfwsi_item_type_class_type_t;
+
+struct libfwsi_item_type_class_type
+{
+	/* The class type the item type requires, where 0 represents any class type
+	 */
+	uint8_t class_type;
+
+	/* The (item) type
+	 */
+	int item_type;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_register_item_type(
+     int item_type,
+     int (*match_function)(
+            const uint8_t *data,
+            size_t data_size,
+            libcerror_error_t **error ),
+     size_t values_size,
+     int (*initialize_function)(
+            intptr_t **values,
+            libcerror_error_t **error ),
+     int (*read_function)(
+            intptr_t *values,
+            const uint8_t *data,
+            size_t data_size,
+            int ascii_codepage,
+            libfwsi_parse_options_t *parse_options,
+            libcerror_error_t **error ),
+     int (*free_function)(
+            intptr_t **values,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_unregister_item_type(
+     int item_type,
+     libcerror_error_t **error );
+
+int libfwsi_item_type_registry_classify(
+     const uint8_t *data,
+     size_t data_size,
+     int *item_type,
+     uint8_t *class_type,
+     uint32_t *signature,
+     libcerror_error_t **error );
+
+int libfwsi_item_type_registry_get_definition(
+     int item_type,
+     int parent_item_type,
+     const libfwsi_item_type_definition_t **definition,
+     libcerror_error_t **error );
+
+#if !defined( LIBFWSI_WITHOUT_CDBURN_PARSER )
+
+int libfwsi_item_type_registry_read_cdburn_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_CDBURN_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER )
+
+int libfwsi_item_type_registry_read_compressed_folder_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_COMPRESSED_FOLDER_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER )
+
+int libfwsi_item_type_registry_read_control_panel_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CATEGORY_PARSER )
+
+int libfwsi_item_type_registry_read_control_panel_category_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CATEGORY_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER )
+
+int libfwsi_item_type_registry_read_control_panel_cpl_file_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER )
+
+int libfwsi_item_type_registry_read_delegate_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+
+int libfwsi_item_type_registry_read_file_entry_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_GAME_FOLDER_PARSER )
+
+int libfwsi_item_type_registry_read_game_folder_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_GAME_FOLDER_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER )
+
+int libfwsi_item_type_registry_read_mtp_file_entry_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
+int libfwsi_item_type_registry_read_mtp_volume_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER )
+
+int libfwsi_item_type_registry_read_network_location_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER )
+
+int libfwsi_item_type_registry_read_root_folder_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
+int libfwsi_item_type_registry_read_uri_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER )
+
+int libfwsi_item_type_registry_read_users_property_view_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_VOLUME_PARSER )
+
+int libfwsi_item_type_registry_read_volume_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_VOLUME_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER )
+
+int libfwsi_item_type_registry_read_unknown_0x74_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER ) */
+
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
+int libfwsi_item_type_registry_read_uri_sub_values(
+     intptr_t *values,
+     const uint8_t *data,
+     size_t data_size,
+     int ascii_codepage,
+     libfwsi_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_ITEM_TYPE_REGISTRY_H ) */
+
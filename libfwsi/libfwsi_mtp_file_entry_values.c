@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
@@ -31,6 +32,7 @@
 #include "libfwsi_libfole.h"
 #include "libfwsi_libuna.h"
 #include "libfwsi_mtp_file_entry_values.h"
+#include "libfwsi_mtp_property_store.h"
 
 /* Creates MTP file entry values
  * Make sure the value mtp_file_entry_values is referencing, is set to NULL
@@ -113,6 +115,7 @@ int libfwsi_mtp_file_entry_values_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfwsi_mtp_file_entry_values_free";
+	int result            = 1;
 
 	if( mtp_file_entry_values == NULL )
 	{
@@ -127,21 +130,41 @@ int libfwsi_mtp_file_entry_values_free(
 	}
 	if( *mtp_file_entry_values != NULL )
 	{
+		if( ( *mtp_file_entry_values )->property_store != NULL )
+		{
+			if( libfwsi_mtp_property_store_free(
+			     &( ( *mtp_file_entry_values )->property_store ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free property store.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *mtp_file_entry_values );
 
 		*mtp_file_entry_values = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER )
+
 /* Reads the MTP file entry values
+ * The parse options can be NULL in which case no limits are applied
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
 int libfwsi_mtp_file_entry_values_read_data(
      libfwsi_mtp_file_entry_values_t *mtp_file_entry_values,
      const uint8_t *data,
      size_t data_size,
+     libfwsi_internal_parse_options_t *parse_options,
      libcerror_error_t **error )
 {
 	static char *function           = "libfwsi_mtp_file_entry_values_read_data";
@@ -149,11 +172,7 @@ int libfwsi_mtp_file_entry_values_read_data(
 	uint32_t identifier_string_size = 0;
 	uint32_t name2_string_size      = 0;
 	uint32_t name_string_size       = 0;
-	uint32_t number_of_properties   = 0;
-	uint32_t property_index         = 0;
-	uint32_t property_value_type    = 0;
         uint32_t signature              = 0;
-	uint32_t string_size            = 0;
 	uint16_t item_data_size         = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -254,6 +273,17 @@ int libfwsi_mtp_file_entry_values_read_data(
 
 		return( -1 );
 	}
+	if( data_size < 74 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 /* TODO */
 	byte_stream_copy_to_uint32_little_endian(
 	 &( data[ 62 ] ),
@@ -355,9 +385,19 @@ int libfwsi_mtp_file_entry_values_read_data(
 
 	if( name_string_size > 0 )
 	{
+		if( (size_t) name_string_size > ( ( data_size - data_offset ) / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name string size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 		name_string_size *= 2;
 
-/* TODO check bounds */
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -384,9 +424,19 @@ int libfwsi_mtp_file_entry_values_read_data(
 	}
 	if( name2_string_size > 0 )
 	{
+		if( (size_t) name2_string_size > ( ( data_size - data_offset ) / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name2 string size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 		name2_string_size *= 2;
 
-/* TODO check bounds */
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -413,9 +463,19 @@ int libfwsi_mtp_file_entry_values_read_data(
 	}
 	if( identifier_string_size > 0 )
 	{
+		if( (size_t) identifier_string_size > ( ( data_size - data_offset ) / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid identifier string size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 		identifier_string_size *= 2;
 
-/* TODO check bounds */
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -440,66 +500,34 @@ int libfwsi_mtp_file_entry_values_read_data(
 #endif
 		data_offset += identifier_string_size;
 	}
-/* TODO refactor */
-	if( data_offset < ( data_size - 4 ) )
+	if( libfwsi_mtp_property_store_initialize(
+	     &( mtp_file_entry_values->property_store ),
+	     error ) != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: unknown10\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-		}
-#endif
-		data_offset += 4;
-	}
-	if( data_offset < ( data_size - 16 ) )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libfwsi_debug_print_guid_value(
-			     function,
-			     "class identifier\t\t\t",
-			     &( data[ data_offset ] ),
-			     16,
-			     LIBFGUID_ENDIAN_LITTLE,
-			     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print GUID value.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property store.",
+		 function );
 
-				return( -1 );
-			}
-		}
-#endif
-		data_offset += 16;
+		goto on_error;
 	}
-	if( data_offset < ( data_size - 4 ) )
+	if( libfwsi_mtp_property_store_read_data(
+	     mtp_file_entry_values->property_store,
+	     &( data[ data_offset ] ),
+	     data_size - data_offset,
+	     parse_options,
+	     error ) != 1 )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( data[ data_offset ] ),
-		 number_of_properties );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property store.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: number of properties\t\t: %" PRIu32 "\n",
-			 function,
-			 number_of_properties );
-		}
-#endif
-		data_offset += 4;
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -508,243 +536,17 @@ int libfwsi_mtp_file_entry_values_read_data(
 		 "\n" );
 	}
 #endif
-	for( property_index = 0;
-	     property_index < number_of_properties;
-	     property_index++ )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: property value: %" PRIu32 "\n",
-			 function,
-			 property_index );
-		}
-#endif
-/* TODO at least 24 bytes in size ? */
-		if( data_offset < ( data_size - 16 ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( libfwsi_debug_print_guid_value(
-				     function,
-				     "property set identifier\t\t",
-				     &( data[ data_offset ] ),
-				     16,
-				     LIBFGUID_ENDIAN_LITTLE,
-				     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to print GUID value.",
-					 function );
-
-					return( -1 );
-				}
-			}
-#endif
-			data_offset += 16;
-		}
-		if( data_offset < ( data_size - 4 ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				byte_stream_copy_to_uint32_little_endian(
-				 &( data[ data_offset ] ),
-				 value_32bit );
-				libcnotify_printf(
-				 "%s: property value identifier\t\t: %" PRIu32 "\n",
-				 function,
-				 value_32bit );
-			}
-#endif
-			data_offset += 4;
-		}
-		if( data_offset < ( data_size - 4 ) )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset ] ),
-			 property_value_type );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: property value type\t\t\t: 0x%08" PRIx32 " (%s : %s)\n",
-				 function,
-				 property_value_type,
-				 libfole_value_type_get_identifier(
-				  property_value_type ),
-				 libfole_value_type_get_description(
-				  property_value_type ) );
-			}
-#endif
-			data_offset += 4;
-		}
-/* TODO merge with FOLE */
-		switch( property_value_type )
-		{
-			case 0x00000005UL:
-			case 0x00000007UL:
-			case 0x00000015UL:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: value data:\n",
-					 function );
-					libcnotify_print_data(
-					 &( data[ data_offset ] ),
-					 8,
-					 0 );
-				}
-#endif
-				data_offset += 8;
-
-				break;
-
-			case 0x0000000bUL:
-			case 0x00000012UL:
-				if( data_offset < ( data_size - 2 ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						byte_stream_copy_to_uint16_little_endian(
-						 &( data[ data_offset ] ),
-						 value_16bit );
-						libcnotify_printf(
-						 "%s: value\t\t\t\t: 0x%04" PRIx16 "\n",
-						 function,
-						 value_16bit );
-
-						libcnotify_printf(
-						 "\n" );
-					}
-#endif
-					data_offset += 2;
-				}
-				break;
-
-			case 0x0000000aUL:
-			case 0x00000013UL:
-				if( data_offset < ( data_size - 4 ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						byte_stream_copy_to_uint32_little_endian(
-						 &( data[ data_offset ] ),
-						 value_32bit );
-						libcnotify_printf(
-						 "%s: value\t\t\t\t: 0x%08" PRIx32 "\n",
-						 function,
-						 value_32bit );
-
-						libcnotify_printf(
-						 "\n" );
-					}
-#endif
-					data_offset += 4;
-				}
-				break;
-
-			case 0x0000001fUL:
-				if( data_offset < ( data_size - 4 ) )
-				{
-					byte_stream_copy_to_uint32_little_endian(
-					 &( data[ data_offset ] ),
-					 string_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: string size\t\t\t\t: %" PRIu32 "\n",
-						 function,
-						 string_size );
-					}
-#endif
-					data_offset += 4;
-
-					if( string_size > 0 )
-					{
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							if( libfwsi_debug_print_utf16_string_value(
-							     function,
-							     "string\t\t\t\t",
-							     &( data[ data_offset ] ),
-							     string_size,
-							     LIBUNA_ENDIAN_LITTLE,
-							     error ) != 1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-								 "%s: unable to print UTF-16 string value.",
-								 function );
-
-								return( -1 );
-							}
-							libcnotify_printf(
-							 "\n" );
-						}
-#endif
-						data_offset += string_size;
-					}
-				}
-				break;
-
-			case 0x00000048UL:
-				if( data_offset < ( data_size - 16 ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						if( libfwsi_debug_print_guid_value(
-						     function,
-						     "GUID\t\t\t\t",
-						     &( data[ data_offset ] ),
-						     16,
-						     LIBFGUID_ENDIAN_LITTLE,
-						     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-							 "%s: unable to print GUID value.",
-							 function );
-
-							return( -1 );
-						}
-						libcnotify_printf(
-						 "\n" );
-					}
-#endif
-					data_offset += 16;
-				}
-				break;
-		}
-	}
-/* TODO */
+	return( 1 );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+on_error:
+	if( mtp_file_entry_values->property_store != NULL )
 	{
-		libcnotify_printf(
-		 "\n" );
+		libfwsi_mtp_property_store_free(
+		 &( mtp_file_entry_values->property_store ),
+		 NULL );
 	}
-#endif
-	return( 1 );
+	return( -1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) */
+
@@ -26,6 +26,8 @@
 #include <types.h>
 
 #include "libfwsi_libcerror.h"
+#include "libfwsi_mtp_property_store.h"
+#include "libfwsi_parse_options.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -35,9 +37,9 @@ typedef struct libfwsi_mtp_file_entry_values libfwsi_mtp_file_entry_values_t;
 
 struct libfwsi_mtp_file_entry_values
 {
-	/* Dummy
+	/* The property store
 	 */
-	int dummy;
+	libfwsi_mtp_property_store_t *property_store;
 };
 
 int libfwsi_mtp_file_entry_values_initialize(
@@ -48,12 +50,17 @@ int libfwsi_mtp_file_entry_values_free(
      libfwsi_mtp_file_entry_values_t **mtp_file_entry_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER )
+
 int libfwsi_mtp_file_entry_values_read_data(
      libfwsi_mtp_file_entry_values_t *mtp_file_entry_values,
      const uint8_t *data,
      size_t data_size,
+     libfwsi_internal_parse_options_t *parse_options,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
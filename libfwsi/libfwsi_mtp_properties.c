@@ -0,0 +1,1411 @@
+/*
+ * MTP property functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_definitions.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_mtp_file_entry_values.h"
+#include "libfwsi_mtp_properties.h"
+#include "libfwsi_mtp_property_store.h"
+#include "libfwsi_mtp_volume_values.h"
+
+/* Retrieves the property store of a MTP volume or MTP file entry item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_property_store(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_mtp_property_store_t **property_store,
+     libcerror_error_t **error )
+{
+	libfwsi_mtp_property_store_t *safe_property_store = NULL;
+	static char *function                             = "libfwsi_mtp_properties_get_property_store";
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY )
+	 && ( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->type == LIBFWSI_ITEM_TYPE_MTP_FILE_ENTRY )
+	{
+		safe_property_store = ( (libfwsi_mtp_file_entry_values_t *) internal_item->value )->property_store;
+	}
+	else
+	{
+		safe_property_store = ( (libfwsi_mtp_volume_values_t *) internal_item->value )->property_store;
+	}
+	if( safe_property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing property store.",
+		 function );
+
+		return( -1 );
+	}
+	*property_store = safe_property_store;
+
+	return( 1 );
+}
+
+/* Retrieves the number of properties
+ * The number of properties only includes the properties that could be read
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_number_of_properties(
+     libfwsi_item_t *item,
+     int *number_of_properties,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_number_of_properties";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_number_of_properties(
+	     property_store,
+	     number_of_properties,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of properties.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the property with a specific property set identifier and identifier
+ * The property set identifier is a little-endian GUID
+ * Returns 1 if successful, 0 if no such property or -1 on error
+ */
+int libfwsi_mtp_properties_get_property_index_by_identifier(
+     libfwsi_item_t *item,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint32_t identifier,
+     int *property_index,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_property_index_by_identifier";
+	int result                                   = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_mtp_property_store_get_index_by_identifier(
+	          property_store,
+	          guid_data,
+	          guid_data_size,
+	          identifier,
+	          property_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property index.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the property set identifier of a specific property
+ * The property set identifier is a little-endian GUID
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_set_identifier(
+     libfwsi_item_t *item,
+     int property_index,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_set_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid GUID data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     &( property_store->data[ property->set_identifier_offset ] ),
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy property set identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the identifier of a specific property
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_identifier(
+     libfwsi_item_t *item,
+     int property_index,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier = property->identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the value type of a specific property
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_type(
+     libfwsi_item_t *item,
+     int property_index,
+     uint32_t *value_type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_type";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
+
+		return( -1 );
+	}
+	*value_type = property->value_type;
+
+	return( 1 );
+}
+
+/* Retrieves the value data size of a specific property
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_data_size(
+     libfwsi_item_t *item,
+     int property_index,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_data_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	*value_data_size = (size_t) property->value_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the value data of a specific property
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_data(
+     libfwsi_item_t *item,
+     int property_index,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_data";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size < (size_t) property->value_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( property->value_data_size > 0 )
+	{
+		if( memory_copy(
+		     value_data,
+		     &( property_store->data[ property->value_data_offset ] ),
+		     (size_t) property->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the 16-bit value of a specific property
+ * This function supports the value types: 0x000b (boolean) and 0x0012 (16-bit unsigned integer)
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_16bit(
+     libfwsi_item_t *item,
+     int property_index,
+     uint16_t *value_16bit,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_16bit";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( value_16bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 16-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( property->value_type != 0x0000000bUL )
+	 && ( property->value_type != 0x00000012UL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%08" PRIx32 " for 16-bit value.",
+		 function,
+		 property->value_type );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( property_store->data[ property->value_data_offset ] ),
+	 *value_16bit );
+
+	return( 1 );
+}
+
+/* Retrieves the 32-bit value of a specific property
+ * This function supports the value types: 0x000a (error) and 0x0013 (32-bit unsigned integer)
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_32bit(
+     libfwsi_item_t *item,
+     int property_index,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_32bit";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( property->value_type != 0x0000000aUL )
+	 && ( property->value_type != 0x00000013UL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%08" PRIx32 " for 32-bit value.",
+		 function,
+		 property->value_type );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( property_store->data[ property->value_data_offset ] ),
+	 *value_32bit );
+
+	return( 1 );
+}
+
+/* Retrieves the 64-bit value of a specific property
+ * This function supports the value types: 0x0005 (double precision floating-point),
+ * 0x0007 (application time) and 0x0015 (64-bit unsigned integer)
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_64bit(
+     libfwsi_item_t *item,
+     int property_index,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_64bit";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( property->value_type != 0x00000005UL )
+	 && ( property->value_type != 0x00000007UL )
+	 && ( property->value_type != 0x00000015UL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%08" PRIx32 " for 64-bit value.",
+		 function,
+		 property->value_type );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( property_store->data[ property->value_data_offset ] ),
+	 *value_64bit );
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 formatted string value of a specific property
+ * This function supports the value type: 0x001f (UTF-16 little-endian string)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_utf8_string_size(
+     libfwsi_item_t *item,
+     int property_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_utf8_string_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( property->value_type != 0x0000001fUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%08" PRIx32 " for string value.",
+		 function,
+		 property->value_type );
+
+		return( -1 );
+	}
+	if( property->value_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     &( property_store->data[ property->value_data_offset ] ),
+	     (size_t) property->value_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted string value of a specific property
+ * This function supports the value type: 0x001f (UTF-16 little-endian string)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_utf8_string(
+     libfwsi_item_t *item,
+     int property_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_utf8_string";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( property->value_type != 0x0000001fUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%08" PRIx32 " for string value.",
+		 function,
+		 property->value_type );
+
+		return( -1 );
+	}
+	if( property->value_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     &( property_store->data[ property->value_data_offset ] ),
+	     (size_t) property->value_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 formatted string value of a specific property
+ * This function supports the value type: 0x001f (UTF-16 little-endian string)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_utf16_string_size(
+     libfwsi_item_t *item,
+     int property_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_utf16_string_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( property->value_type != 0x0000001fUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%08" PRIx32 " for string value.",
+		 function,
+		 property->value_type );
+
+		return( -1 );
+	}
+	if( property->value_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     &( property_store->data[ property->value_data_offset ] ),
+	     (size_t) property->value_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 formatted string value of a specific property
+ * This function supports the value type: 0x001f (UTF-16 little-endian string)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_utf16_string(
+     libfwsi_item_t *item,
+     int property_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_utf16_string";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( property->value_type != 0x0000001fUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%08" PRIx32 " for string value.",
+		 function,
+		 property->value_type );
+
+		return( -1 );
+	}
+	if( property->value_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     &( property_store->data[ property->value_data_offset ] ),
+	     (size_t) property->value_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the GUID value of a specific property
+ * This function supports the value type: 0x0048 (GUID)
+ * The GUID is stored as a little-endian GUID
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_properties_get_value_guid(
+     libfwsi_item_t *item,
+     int property_index,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item       = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	static char *function                        = "libfwsi_mtp_properties_get_value_guid";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_mtp_properties_get_property_store(
+	     internal_item,
+	     &property_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_mtp_property_store_get_property_by_index(
+	     property_store,
+	     property_index,
+	     &property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property: %d.",
+		 function,
+		 property_index );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid GUID data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( property->value_type != 0x00000048UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%08" PRIx32 " for GUID value.",
+		 function,
+		 property->value_type );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     &( property_store->data[ property->value_data_offset ] ),
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,159 @@
+/*
+ * MTP property functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_MTP_PROPERTIES_H )
+#define _LIBFWSI_MTP_PROPERTIES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_mtp_property_store.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfwsi_mtp_properties_get_property_store(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_mtp_property_store_t **property_store,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_number_of_properties(
+     libfwsi_item_t *item,
+     int *number_of_properties,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_property_index_by_identifier(
+     libfwsi_item_t *item,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint32_t identifier,
+     int *property_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_set_identifier(
+     libfwsi_item_t *item,
+     int property_index,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_identifier(
+     libfwsi_item_t *item,
+     int property_index,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_type(
+     libfwsi_item_t *item,
+     int property_index,
+     uint32_t *value_type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_data_size(
+     libfwsi_item_t *item,
+     int property_index,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_data(
+     libfwsi_item_t *item,
+     int property_index,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_16bit(
+     libfwsi_item_t *item,
+     int property_index,
+     uint16_t *value_16bit,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_32bit(
+     libfwsi_item_t *item,
+     int property_index,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_64bit(
+     libfwsi_item_t *item,
+     int property_index,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_utf8_string_size(
+     libfwsi_item_t *item,
+     int property_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_utf8_string(
+     libfwsi_item_t *item,
+     int property_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_utf16_string_size(
+     libfwsi_item_t *item,
+     int property_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_utf16_string(
+     libfwsi_item_t *item,
+     int property_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_mtp_properties_get_value_guid(
+     libfwsi_item_t *item,
+     int property_index,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_MTP_PROPERTIES_H ) */
+
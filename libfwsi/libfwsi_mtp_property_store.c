@@ -0,0 +1,836 @@
+/*
+ * MTP property store functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_debug.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libcnotify.h"
+#include "libfwsi_libfguid.h"
+#include "libfwsi_libfole.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_mtp_property_store.h"
+
+/* Creates a property store
+ * Make sure the value property_store is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_property_store_initialize(
+     libfwsi_mtp_property_store_t **property_store,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_mtp_property_store_initialize";
+
+	if( property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *property_store != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property store value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*property_store = memory_allocate_structure(
+	                   libfwsi_mtp_property_store_t );
+
+	if( *property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create property store.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *property_store,
+	     0,
+	     sizeof( libfwsi_mtp_property_store_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear property store.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *property_store != NULL )
+	{
+		memory_free(
+		 *property_store );
+
+		*property_store = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a property store
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_property_store_free(
+     libfwsi_mtp_property_store_t **property_store,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_mtp_property_store_free";
+
+	if( property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *property_store != NULL )
+	{
+		if( ( *property_store )->properties != NULL )
+		{
+			memory_free(
+			 ( *property_store )->properties );
+		}
+		if( ( *property_store )->data != NULL )
+		{
+			memory_free(
+			 ( *property_store )->data );
+		}
+		memory_free(
+		 *property_store );
+
+		*property_store = NULL;
+	}
+	return( 1 );
+}
+
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) || !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
+/* Reads the property store
+ * The data starts with the 32-bit value that precedes the class identifier
+ * Only the properties that are fully contained in the data are stored,
+ * the property value data is stored as a span relative to a copy of the data
+ * The parse options can be NULL in which case no limits are applied
+ * Limit exceeded of the parse options is set if the number of properties exceeds the maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_property_store_read_data(
+     libfwsi_mtp_property_store_t *property_store,
+     const uint8_t *data,
+     size_t data_size,
+     libfwsi_internal_parse_options_t *parse_options,
+     libcerror_error_t **error )
+{
+	libfwsi_mtp_property_t *property    = NULL;
+	static char *function               = "libfwsi_mtp_property_store_read_data";
+	size_t data_offset                  = 0;
+	size_t maximum_number_of_entries    = 0;
+	uint32_t number_of_properties       = 0;
+	uint32_t property_index             = 0;
+	uint32_t value_data_size            = 0;
+	uint8_t is_supported                = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit                = 0;
+	uint16_t value_16bit                = 0;
+#endif
+
+	if( property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( property_store->data != NULL )
+	 || ( property_store->properties != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid property store - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: data size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size - data_offset ) >= 4 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: unknown10\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
+		}
+#endif
+		data_offset += 4;
+	}
+	if( ( data_size - data_offset ) >= 16 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( libfwsi_debug_print_guid_value(
+			     function,
+			     "class identifier\t\t\t",
+			     &( data[ data_offset ] ),
+			     16,
+			     LIBFGUID_ENDIAN_LITTLE,
+			     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print GUID value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		data_offset += 16;
+	}
+	if( ( data_size - data_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 number_of_properties );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: number of properties\t\t\t: %" PRIu32 "\n",
+			 function,
+			 number_of_properties );
+		}
+#endif
+		data_offset += 4;
+
+		if( ( parse_options != NULL )
+		 && ( parse_options->maximum_number_of_properties != 0 )
+		 && ( number_of_properties > parse_options->maximum_number_of_properties ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: number of properties value exceeds maximum.",
+			 function );
+
+			parse_options->limit_exceeded = 1;
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	/* Every property consists of at least 24 bytes, which bounds
+	 * the number of entries regardless of the number of properties
+	 */
+	maximum_number_of_entries = ( data_size - data_offset ) / 24;
+
+	if( (size_t) number_of_properties < maximum_number_of_entries )
+	{
+		maximum_number_of_entries = (size_t) number_of_properties;
+	}
+	if( maximum_number_of_entries > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of entries value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( maximum_number_of_entries > 0 )
+	{
+		property_store->properties = (libfwsi_mtp_property_t *) memory_allocate(
+		                                                         sizeof( libfwsi_mtp_property_t ) * maximum_number_of_entries );
+
+		if( property_store->properties == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create properties.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( property_index = 0;
+	     (size_t) property_index < maximum_number_of_entries;
+	     property_index++ )
+	{
+		if( ( data_size - data_offset ) < 24 )
+		{
+			break;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: property value: %" PRIu32 "\n",
+			 function,
+			 property_index );
+		}
+#endif
+		property = &( property_store->properties[ property_store->number_of_properties ] );
+
+		property->set_identifier_offset = (uint32_t) data_offset;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 property->identifier );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 20 ] ),
+		 property->value_type );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( libfwsi_debug_print_guid_value(
+			     function,
+			     "property set identifier\t\t\t",
+			     &( data[ data_offset ] ),
+			     16,
+			     LIBFGUID_ENDIAN_LITTLE,
+			     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print GUID value.",
+				 function );
+
+				goto on_error;
+			}
+			libcnotify_printf(
+			 "%s: property value identifier\t\t: %" PRIu32 "\n",
+			 function,
+			 property->identifier );
+
+			libcnotify_printf(
+			 "%s: property value type\t\t\t: 0x%08" PRIx32 " (%s : %s)\n",
+			 function,
+			 property->value_type,
+			 libfole_value_type_get_identifier(
+			  property->value_type ),
+			 libfole_value_type_get_description(
+			  property->value_type ) );
+		}
+#endif
+		data_offset += 24;
+
+		is_supported = 1;
+
+/* TODO merge with FOLE */
+		switch( property->value_type )
+		{
+			case 0x00000005UL:
+			case 0x00000007UL:
+			case 0x00000015UL:
+				value_data_size = 8;
+				break;
+
+			case 0x0000000bUL:
+			case 0x00000012UL:
+				value_data_size = 2;
+				break;
+
+			case 0x0000000aUL:
+			case 0x00000013UL:
+				value_data_size = 4;
+				break;
+
+			case 0x0000001fUL:
+				if( ( data_size - data_offset ) < 4 )
+				{
+					is_supported = 0;
+
+					break;
+				}
+				byte_stream_copy_to_uint32_little_endian(
+				 &( data[ data_offset ] ),
+				 value_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: string size\t\t\t\t: %" PRIu32 "\n",
+					 function,
+					 value_data_size );
+				}
+#endif
+				data_offset += 4;
+
+				break;
+
+			case 0x00000048UL:
+				value_data_size = 16;
+				break;
+
+			/* The size of the value data of other value types is not known
+			 * hence the properties that follow cannot be located
+			 */
+			default:
+				is_supported = 0;
+				break;
+		}
+		if( ( is_supported == 0 )
+		 || ( (size_t) value_data_size > ( data_size - data_offset ) ) )
+		{
+			break;
+		}
+		property->value_data_offset = (uint32_t) data_offset;
+		property->value_data_size   = value_data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			switch( property->value_type )
+			{
+				case 0x0000000bUL:
+				case 0x00000012UL:
+					byte_stream_copy_to_uint16_little_endian(
+					 &( data[ data_offset ] ),
+					 value_16bit );
+					libcnotify_printf(
+					 "%s: value\t\t\t\t\t: 0x%04" PRIx16 "\n",
+					 function,
+					 value_16bit );
+					break;
+
+				case 0x0000000aUL:
+				case 0x00000013UL:
+					byte_stream_copy_to_uint32_little_endian(
+					 &( data[ data_offset ] ),
+					 value_32bit );
+					libcnotify_printf(
+					 "%s: value\t\t\t\t\t: 0x%08" PRIx32 "\n",
+					 function,
+					 value_32bit );
+					break;
+
+				case 0x0000001fUL:
+					if( value_data_size > 0 )
+					{
+						if( libfwsi_debug_print_utf16_string_value(
+						     function,
+						     "string\t\t\t\t\t",
+						     &( data[ data_offset ] ),
+						     value_data_size,
+						     LIBUNA_ENDIAN_LITTLE,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+							 "%s: unable to print UTF-16 string value.",
+							 function );
+
+							goto on_error;
+						}
+					}
+					break;
+
+				case 0x00000048UL:
+					if( libfwsi_debug_print_guid_value(
+					     function,
+					     "GUID\t\t\t\t\t",
+					     &( data[ data_offset ] ),
+					     16,
+					     LIBFGUID_ENDIAN_LITTLE,
+					     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+						 "%s: unable to print GUID value.",
+						 function );
+
+						goto on_error;
+					}
+					break;
+
+				default:
+					libcnotify_printf(
+					 "%s: value data:\n",
+					 function );
+					libcnotify_print_data(
+					 &( data[ data_offset ] ),
+					 value_data_size,
+					 0 );
+					break;
+			}
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		data_offset += value_data_size;
+
+		property_store->number_of_properties += 1;
+	}
+	/* Only the data up to the end of the last stored property is retained
+	 */
+	if( data_offset > 0 )
+	{
+		property_store->data = (uint8_t *) memory_allocate(
+		                                    sizeof( uint8_t ) * data_offset );
+
+		if( property_store->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     property_store->data,
+		     data,
+		     data_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			goto on_error;
+		}
+		property_store->data_size = data_offset;
+	}
+	return( 1 );
+
+on_error:
+	if( property_store->data != NULL )
+	{
+		memory_free(
+		 property_store->data );
+
+		property_store->data = NULL;
+	}
+	property_store->data_size = 0;
+
+	if( property_store->properties != NULL )
+	{
+		memory_free(
+		 property_store->properties );
+
+		property_store->properties = NULL;
+	}
+	property_store->number_of_properties = 0;
+
+	return( -1 );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) || !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
+/* Retrieves the number of properties
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_property_store_get_number_of_properties(
+     libfwsi_mtp_property_store_t *property_store,
+     int *number_of_properties,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_mtp_property_store_get_number_of_properties";
+
+	if( property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_properties == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of properties.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_properties = property_store->number_of_properties;
+
+	return( 1 );
+}
+
+/* Retrieves a specific property
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_property_store_get_property_by_index(
+     libfwsi_mtp_property_store_t *property_store,
+     int property_index,
+     libfwsi_mtp_property_t **property,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_mtp_property_store_get_property_by_index";
+
+	if( property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( property_index < 0 )
+	 || ( property_index >= property_store->number_of_properties ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid property index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( property == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property.",
+		 function );
+
+		return( -1 );
+	}
+	*property = &( property_store->properties[ property_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the index of the property with a specific property set identifier and identifier
+ * The property set identifier is a little-endian GUID
+ * Returns 1 if successful, 0 if no such property or -1 on error
+ */
+int libfwsi_mtp_property_store_get_index_by_identifier(
+     libfwsi_mtp_property_store_t *property_store,
+     const uint8_t *set_identifier,
+     size_t set_identifier_size,
+     uint32_t identifier,
+     int *property_index,
+     libcerror_error_t **error )
+{
+	libfwsi_mtp_property_t *property = NULL;
+	static char *function            = "libfwsi_mtp_property_store_get_index_by_identifier";
+	int safe_property_index          = 0;
+
+	if( property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( set_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property set identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( set_identifier_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid property set identifier value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( property_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property index.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_property_index = 0;
+	     safe_property_index < property_store->number_of_properties;
+	     safe_property_index++ )
+	{
+		property = &( property_store->properties[ safe_property_index ] );
+
+		if( property->identifier != identifier )
+		{
+			continue;
+		}
+		if( memory_compare(
+		     &( property_store->data[ property->set_identifier_offset ] ),
+		     set_identifier,
+		     16 ) == 0 )
+		{
+			*property_index = safe_property_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the memory usage of the property store
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_mtp_property_store_get_memory_usage(
+     libfwsi_mtp_property_store_t *property_store,
+     size_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_mtp_property_store_get_memory_usage";
+
+	if( property_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property store.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_usage = sizeof( libfwsi_mtp_property_store_t )
+	              + property_store->data_size;
+
+	if( property_store->properties != NULL )
+	{
+		*memory_usage += sizeof( libfwsi_mtp_property_t ) * (size_t) property_store->number_of_properties;
+	}
+	return( 1 );
+}
+
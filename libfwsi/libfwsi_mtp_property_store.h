@@ -0,0 +1,129 @@
+/*
+ * MTP property store functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_MTP_PROPERTY_STORE_H )
+#define _LIBFWSI_MTP_PROPERTY_STORE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+#include "libfwsi_parse_options.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_mtp_property libfwsi_mtp_property_t;
+
+struct libfwsi_mtp_property
+{
+	/* The offset of the property set identifier relative to the start of the property store data
+	 */
+	uint32_t set_identifier_offset;
+
+	/* The (property value) identifier
+	 */
+	uint32_t identifier;
+
+	/* The value type
+	 */
+	uint32_t value_type;
+
+	/* The offset of the value data relative to the start of the property store data
+	 */
+	uint32_t value_data_offset;
+
+	/* The value data size
+	 */
+	uint32_t value_data_size;
+};
+
+typedef struct libfwsi_mtp_property_store libfwsi_mtp_property_store_t;
+
+struct libfwsi_mtp_property_store
+{
+	/* The property store data
+	 */
+	uint8_t *data;
+
+	/* The property store data size
+	 */
+	size_t data_size;
+
+	/* The properties
+	 */
+	libfwsi_mtp_property_t *properties;
+
+	/* The number of properties
+	 */
+	int number_of_properties;
+};
+
+int libfwsi_mtp_property_store_initialize(
+     libfwsi_mtp_property_store_t **property_store,
+     libcerror_error_t **error );
+
+int libfwsi_mtp_property_store_free(
+     libfwsi_mtp_property_store_t **property_store,
+     libcerror_error_t **error );
+
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) || !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
+int libfwsi_mtp_property_store_read_data(
+     libfwsi_mtp_property_store_t *property_store,
+     const uint8_t *data,
+     size_t data_size,
+     libfwsi_internal_parse_options_t *parse_options,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) || !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
+int libfwsi_mtp_property_store_get_number_of_properties(
+     libfwsi_mtp_property_store_t *property_store,
+     int *number_of_properties,
+     libcerror_error_t **error );
+
+int libfwsi_mtp_property_store_get_property_by_index(
+     libfwsi_mtp_property_store_t *property_store,
+     int property_index,
+     libfwsi_mtp_property_t **property,
+     libcerror_error_t **error );
+
+int libfwsi_mtp_property_store_get_index_by_identifier(
+     libfwsi_mtp_property_store_t *property_store,
+     const uint8_t *set_identifier,
+     size_t set_identifier_size,
+     uint32_t identifier,
+     int *property_index,
+     libcerror_error_t **error );
+
+int libfwsi_mtp_property_store_get_memory_usage(
+     libfwsi_mtp_property_store_t *property_store,
+     size_t *memory_usage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_MTP_PROPERTY_STORE_H ) */
+
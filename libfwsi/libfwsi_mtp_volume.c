@@ -0,0 +1,920 @@
+/*
+ * MTP storage device volume (shell item) functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_definitions.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_mtp_volume.h"
+#include "libfwsi_mtp_volume_values.h"
+
+/* Retrieves the size of the UTF-8 formatted storage name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf8_storage_name_size(
+     libfwsi_item_t *item,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf8_storage_name_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->storage_name == NULL )
+	 || ( mtp_volume_values->storage_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     mtp_volume_values->storage_name,
+	     mtp_volume_values->storage_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted storage name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf8_storage_name(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf8_storage_name";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->storage_name == NULL )
+	 || ( mtp_volume_values->storage_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     mtp_volume_values->storage_name,
+	     mtp_volume_values->storage_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 formatted storage name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf16_storage_name_size(
+     libfwsi_item_t *item,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf16_storage_name_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->storage_name == NULL )
+	 || ( mtp_volume_values->storage_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     mtp_volume_values->storage_name,
+	     mtp_volume_values->storage_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 formatted storage name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf16_storage_name(
+     libfwsi_item_t *item,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf16_storage_name";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->storage_name == NULL )
+	 || ( mtp_volume_values->storage_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     mtp_volume_values->storage_name,
+	     mtp_volume_values->storage_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 formatted volume identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf8_volume_identifier_size(
+     libfwsi_item_t *item,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf8_volume_identifier_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->volume_identifier == NULL )
+	 || ( mtp_volume_values->volume_identifier_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     mtp_volume_values->volume_identifier,
+	     mtp_volume_values->volume_identifier_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted volume identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf8_volume_identifier(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf8_volume_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->volume_identifier == NULL )
+	 || ( mtp_volume_values->volume_identifier_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     mtp_volume_values->volume_identifier,
+	     mtp_volume_values->volume_identifier_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 formatted volume identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf16_volume_identifier_size(
+     libfwsi_item_t *item,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf16_volume_identifier_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->volume_identifier == NULL )
+	 || ( mtp_volume_values->volume_identifier_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     mtp_volume_values->volume_identifier,
+	     mtp_volume_values->volume_identifier_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 formatted volume identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf16_volume_identifier(
+     libfwsi_item_t *item,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf16_volume_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->volume_identifier == NULL )
+	 || ( mtp_volume_values->volume_identifier_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     mtp_volume_values->volume_identifier,
+	     mtp_volume_values->volume_identifier_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 formatted file system name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf8_file_system_name_size(
+     libfwsi_item_t *item,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf8_file_system_name_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->file_system_name == NULL )
+	 || ( mtp_volume_values->file_system_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     mtp_volume_values->file_system_name,
+	     mtp_volume_values->file_system_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted file system name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf8_file_system_name(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf8_file_system_name";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->file_system_name == NULL )
+	 || ( mtp_volume_values->file_system_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     mtp_volume_values->file_system_name,
+	     mtp_volume_values->file_system_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 formatted file system name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf16_file_system_name_size(
+     libfwsi_item_t *item,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf16_file_system_name_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->file_system_name == NULL )
+	 || ( mtp_volume_values->file_system_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     mtp_volume_values->file_system_name,
+	     mtp_volume_values->file_system_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 formatted file system name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_mtp_volume_get_utf16_file_system_name(
+     libfwsi_item_t *item,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item         = NULL;
+	libfwsi_mtp_volume_values_t *mtp_volume_values = NULL;
+	static char *function                          = "libfwsi_mtp_volume_get_utf16_file_system_name";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_MTP_VOLUME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	mtp_volume_values = (libfwsi_mtp_volume_values_t *) internal_item->value;
+
+	if( ( mtp_volume_values->file_system_name == NULL )
+	 || ( mtp_volume_values->file_system_name_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     mtp_volume_values->file_system_name,
+	     mtp_volume_values->file_system_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -24,12 +24,14 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libfguid.h"
 #include "libfwsi_libfole.h"
 #include "libfwsi_libuna.h"
+#include "libfwsi_mtp_property_store.h"
 #include "libfwsi_mtp_volume_values.h"
 
 /* Creates MTP volume values
@@ -113,6 +115,7 @@ int libfwsi_mtp_volume_values_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfwsi_mtp_volume_values_free";
+	int result            = 1;
 
 	if( mtp_volume_values == NULL )
 	{
@@ -127,21 +130,56 @@ int libfwsi_mtp_volume_values_free(
 	}
 	if( *mtp_volume_values != NULL )
 	{
+		if( ( *mtp_volume_values )->storage_name != NULL )
+		{
+			memory_free(
+			 ( *mtp_volume_values )->storage_name );
+		}
+		if( ( *mtp_volume_values )->volume_identifier != NULL )
+		{
+			memory_free(
+			 ( *mtp_volume_values )->volume_identifier );
+		}
+		if( ( *mtp_volume_values )->file_system_name != NULL )
+		{
+			memory_free(
+			 ( *mtp_volume_values )->file_system_name );
+		}
+		if( ( *mtp_volume_values )->property_store != NULL )
+		{
+			if( libfwsi_mtp_property_store_free(
+			     &( ( *mtp_volume_values )->property_store ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free property store.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *mtp_volume_values );
 
 		*mtp_volume_values = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
+#if !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
 /* Reads the MTP volume values
+ * The parse options can be NULL in which case no limits are applied
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
 int libfwsi_mtp_volume_values_read_data(
      libfwsi_mtp_volume_values_t *mtp_volume_values,
      const uint8_t *data,
      size_t data_size,
+     libfwsi_internal_parse_options_t *parse_options,
      libcerror_error_t **error )
 {
 	static char *function            = "libfwsi_mtp_volume_values_read_data";
@@ -151,11 +189,7 @@ int libfwsi_mtp_volume_values_read_data(
 	uint32_t identifier_string_size  = 0;
 	uint32_t name_string_size        = 0;
 	uint32_t number_of_guid_strings  = 0;
-	uint32_t number_of_properties    = 0;
-	uint32_t property_index          = 0;
-	uint32_t property_value_type     = 0;
         uint32_t signature               = 0;
-	uint32_t string_size             = 0;
 	uint16_t item_data_size          = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -256,6 +290,17 @@ int libfwsi_mtp_volume_values_read_data(
 
 		return( -1 );
 	}
+	if( data_size < 54 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	byte_stream_copy_to_uint32_little_endian(
 	 &( data[ 38 ] ),
 	 name_string_size );
@@ -364,9 +409,19 @@ int libfwsi_mtp_volume_values_read_data(
 
 	if( name_string_size > 0 )
 	{
+		if( (size_t) name_string_size > ( ( data_size - data_offset ) / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
 		name_string_size *= 2;
 
-/* TODO check bounds */
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -385,17 +440,57 @@ int libfwsi_mtp_volume_values_read_data(
 				 "%s: unable to print UTF-16 string value.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 #endif
+		mtp_volume_values->storage_name = (uint8_t *) memory_allocate(
+		                                               sizeof( uint8_t ) * name_string_size );
+
+		if( mtp_volume_values->storage_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create storage name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     mtp_volume_values->storage_name,
+		     &( data[ data_offset ] ),
+		     (size_t) name_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy storage name.",
+			 function );
+
+			goto on_error;
+		}
+		mtp_volume_values->storage_name_size = (size_t) name_string_size;
+
 		data_offset += name_string_size;
 	}
 	if( identifier_string_size > 0 )
 	{
+		if( (size_t) identifier_string_size > ( ( data_size - data_offset ) / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid identifier string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
 		identifier_string_size *= 2;
 
-/* TODO check bounds */
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -414,17 +509,57 @@ int libfwsi_mtp_volume_values_read_data(
 				 "%s: unable to print UTF-16 string value.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 #endif
+		mtp_volume_values->volume_identifier = (uint8_t *) memory_allocate(
+		                                                    sizeof( uint8_t ) * identifier_string_size );
+
+		if( mtp_volume_values->volume_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create volume identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     mtp_volume_values->volume_identifier,
+		     &( data[ data_offset ] ),
+		     (size_t) identifier_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy volume identifier.",
+			 function );
+
+			goto on_error;
+		}
+		mtp_volume_values->volume_identifier_size = (size_t) identifier_string_size;
+
 		data_offset += identifier_string_size;
 	}
 	if( file_system_string_size > 0 )
 	{
+		if( (size_t) file_system_string_size > ( ( data_size - data_offset ) / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file system string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
 		file_system_string_size *= 2;
 
-/* TODO check bounds */
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -443,17 +578,57 @@ int libfwsi_mtp_volume_values_read_data(
 				 "%s: unable to print UTF-16 string value.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 #endif
+		mtp_volume_values->file_system_name = (uint8_t *) memory_allocate(
+		                                                   sizeof( uint8_t ) * file_system_string_size );
+
+		if( mtp_volume_values->file_system_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file system name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     mtp_volume_values->file_system_name,
+		     &( data[ data_offset ] ),
+		     (size_t) file_system_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file system name.",
+			 function );
+
+			goto on_error;
+		}
+		mtp_volume_values->file_system_name_size = (size_t) file_system_string_size;
+
 		data_offset += file_system_string_size;
 	}
+	if( (size_t) number_of_guid_strings > ( ( data_size - data_offset ) / 78 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of GUID strings value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
 	for( guid_string_index = 0;
 	     guid_string_index < number_of_guid_strings;
 	     guid_string_index++ )
 	{
-/* TODO check bounds */
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -472,72 +647,40 @@ int libfwsi_mtp_volume_values_read_data(
 				 "%s: unable to print UTF-16 string value.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 #endif
 		data_offset += 78;
 	}
-/* TODO move to common MTP property values function */
-	if( data_offset < ( data_size - 4 ) )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset ] ),
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: unknown10\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
-		}
-#endif
-		data_offset += 4;
-	}
-	if( data_offset < ( data_size - 16 ) )
+	if( libfwsi_mtp_property_store_initialize(
+	     &( mtp_volume_values->property_store ),
+	     error ) != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libfwsi_debug_print_guid_value(
-			     function,
-			     "class identifier\t\t\t",
-			     &( data[ data_offset ] ),
-			     16,
-			     LIBFGUID_ENDIAN_LITTLE,
-			     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print GUID value.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property store.",
+		 function );
 
-				return( -1 );
-			}
-		}
-#endif
-		data_offset += 16;
+		goto on_error;
 	}
-	if( data_offset < ( data_size - 4 ) )
+	if( libfwsi_mtp_property_store_read_data(
+	     mtp_volume_values->property_store,
+	     &( data[ data_offset ] ),
+	     data_size - data_offset,
+	     parse_options,
+	     error ) != 1 )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( data[ data_offset ] ),
-		 number_of_properties );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read property store.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: number of properties\t\t\t: %" PRIu32 "\n",
-			 function,
-			 number_of_properties );
-		}
-#endif
-		data_offset += 4;
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -546,243 +689,44 @@ int libfwsi_mtp_volume_values_read_data(
 		 "\n" );
 	}
 #endif
-	for( property_index = 0;
-	     property_index < number_of_properties;
-	     property_index++ )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: property value: %" PRIu32 "\n",
-			 function,
-			 property_index );
-		}
-#endif
-/* TODO at least 24 bytes in size ? */
-		if( data_offset < ( data_size - 16 ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( libfwsi_debug_print_guid_value(
-				     function,
-				     "property set identifier\t\t\t",
-				     &( data[ data_offset ] ),
-				     16,
-				     LIBFGUID_ENDIAN_LITTLE,
-				     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to print GUID value.",
-					 function );
-
-					return( -1 );
-				}
-			}
-#endif
-			data_offset += 16;
-		}
-		if( data_offset < ( data_size - 4 ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				byte_stream_copy_to_uint32_little_endian(
-				 &( data[ data_offset ] ),
-				 value_32bit );
-				libcnotify_printf(
-				 "%s: property value identifier\t\t: %" PRIu32 "\n",
-				 function,
-				 value_32bit );
-			}
-#endif
-			data_offset += 4;
-		}
-		if( data_offset < ( data_size - 4 ) )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ data_offset ] ),
-			 property_value_type );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: property value type\t\t\t: 0x%08" PRIx32 " (%s : %s)\n",
-				 function,
-				 property_value_type,
-				 libfole_value_type_get_identifier(
-				  property_value_type ),
-				 libfole_value_type_get_description(
-				  property_value_type ) );
-			}
-#endif
-			data_offset += 4;
-		}
-/* TODO merge with FOLE */
-		switch( property_value_type )
-		{
-			case 0x00000005UL:
-			case 0x00000007UL:
-			case 0x00000015UL:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: value data:\n",
-					 function );
-					libcnotify_print_data(
-					 &( data[ data_offset ] ),
-					 8,
-					 0 );
-				}
-#endif
-				data_offset += 8;
-
-				break;
+	return( 1 );
 
-			case 0x0000000bUL:
-			case 0x00000012UL:
-				if( data_offset < ( data_size - 2 ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						byte_stream_copy_to_uint16_little_endian(
-						 &( data[ data_offset ] ),
-						 value_16bit );
-						libcnotify_printf(
-						 "%s: value\t\t\t\t\t: 0x%04" PRIx16 "\n",
-						 function,
-						 value_16bit );
-
-						libcnotify_printf(
-						 "\n" );
-					}
-#endif
-					data_offset += 2;
-				}
-				break;
-
-			case 0x0000000aUL:
-			case 0x00000013UL:
-				if( data_offset < ( data_size - 4 ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						byte_stream_copy_to_uint32_little_endian(
-						 &( data[ data_offset ] ),
-						 value_32bit );
-						libcnotify_printf(
-						 "%s: value\t\t\t\t\t: 0x%08" PRIx32 "\n",
-						 function,
-						 value_32bit );
-
-						libcnotify_printf(
-						 "\n" );
-					}
-#endif
-					data_offset += 4;
-				}
-				break;
+on_error:
+	if( mtp_volume_values->property_store != NULL )
+	{
+		libfwsi_mtp_property_store_free(
+		 &( mtp_volume_values->property_store ),
+		 NULL );
+	}
+	if( mtp_volume_values->file_system_name != NULL )
+	{
+		memory_free(
+		 mtp_volume_values->file_system_name );
 
-			case 0x0000001fUL:
-				if( data_offset < ( data_size - 4 ) )
-				{
-					byte_stream_copy_to_uint32_little_endian(
-					 &( data[ data_offset ] ),
-					 string_size );
+		mtp_volume_values->file_system_name = NULL;
+	}
+	mtp_volume_values->file_system_name_size = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: string size\t\t\t\t: %" PRIu32 "\n",
-						 function,
-						 string_size );
-					}
-#endif
-					data_offset += 4;
+	if( mtp_volume_values->volume_identifier != NULL )
+	{
+		memory_free(
+		 mtp_volume_values->volume_identifier );
 
-					if( string_size > 0 )
-					{
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							if( libfwsi_debug_print_utf16_string_value(
-							     function,
-							     "string\t\t\t\t\t",
-							     &( data[ data_offset ] ),
-							     string_size,
-							     LIBUNA_ENDIAN_LITTLE,
-							     error ) != 1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-								 "%s: unable to print UTF-16 string value.",
-								 function );
-
-								return( -1 );
-							}
-							libcnotify_printf(
-							 "\n" );
-						}
-#endif
-						data_offset += string_size;
-					}
-				}
-				break;
-
-			case 0x00000048UL:
-				if( data_offset < ( data_size - 16 ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						if( libfwsi_debug_print_guid_value(
-						     function,
-						     "GUID\t\t\t\t\t",
-						     &( data[ data_offset ] ),
-						     16,
-						     LIBFGUID_ENDIAN_LITTLE,
-						     LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-							 "%s: unable to print GUID value.",
-							 function );
-
-							return( -1 );
-						}
-						libcnotify_printf(
-						 "\n" );
-					}
-#endif
-					data_offset += 16;
-				}
-				break;
-		}
+		mtp_volume_values->volume_identifier = NULL;
 	}
-/* TODO */
+	mtp_volume_values->volume_identifier_size = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( mtp_volume_values->storage_name != NULL )
 	{
-		libcnotify_printf(
-		 "\n" );
+		memory_free(
+		 mtp_volume_values->storage_name );
+
+		mtp_volume_values->storage_name = NULL;
 	}
-#endif
-	return( 1 );
+	mtp_volume_values->storage_name_size = 0;
+
+	return( -1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
@@ -26,6 +26,8 @@
 #include <types.h>
 
 #include "libfwsi_libcerror.h"
+#include "libfwsi_mtp_property_store.h"
+#include "libfwsi_parse_options.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -35,9 +37,33 @@ typedef struct libfwsi_mtp_volume_values libfwsi_mtp_volume_values_t;
 
 struct libfwsi_mtp_volume_values
 {
-	/* Dummy
+	/* The storage name
 	 */
-	int dummy;
+	uint8_t *storage_name;
+
+	/* The storage name size
+	 */
+	size_t storage_name_size;
+
+	/* The volume identifier
+	 */
+	uint8_t *volume_identifier;
+
+	/* The volume identifier size
+	 */
+	size_t volume_identifier_size;
+
+	/* The file system name
+	 */
+	uint8_t *file_system_name;
+
+	/* The file system name size
+	 */
+	size_t file_system_name_size;
+
+	/* The property store
+	 */
+	libfwsi_mtp_property_store_t *property_store;
 };
 
 int libfwsi_mtp_volume_values_initialize(
@@ -48,12 +74,17 @@ int libfwsi_mtp_volume_values_free(
      libfwsi_mtp_volume_values_t **mtp_volume_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
 int libfwsi_mtp_volume_values_read_data(
      libfwsi_mtp_volume_values_t *mtp_volume_values,
      const uint8_t *data,
      size_t data_size,
+     libfwsi_internal_parse_options_t *parse_options,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,757 @@
+/*
+ * Name pattern functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBFWSI_NAME_PATTERN_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_codepage_tables.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_name_pattern.h"
+#include "libfwsi_string.h"
+
+/* Creates a name pattern
+ * Make sure the value name_pattern is referencing, is set to NULL
+ * The pattern is an UTF-8 string, where a glob pattern supports
+ * the wildcards '*' (any number of characters) and '?' (a single character)
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_name_pattern_initialize(
+     libfwsi_name_pattern_t **name_pattern,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int pattern_type,
+     libcerror_error_t **error )
+{
+	libfwsi_name_pattern_t *safe_name_pattern = NULL;
+	static char *function                     = "libfwsi_name_pattern_initialize";
+	size_t character_index                    = 0;
+	size_t utf16_string_size                  = 0;
+
+	if( name_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_pattern != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name pattern value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_type != LIBFWSI_NAME_PATTERN_TYPE_LITERAL )
+	 && ( pattern_type != LIBFWSI_NAME_PATTERN_TYPE_PREFIX )
+	 && ( pattern_type != LIBFWSI_NAME_PATTERN_TYPE_GLOB ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern type.",
+		 function );
+
+		return( -1 );
+	}
+	safe_name_pattern = memory_allocate_structure(
+	                     libfwsi_name_pattern_t );
+
+	if( safe_name_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_name_pattern,
+	     0,
+	     sizeof( libfwsi_name_pattern_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name pattern.",
+		 function );
+
+		memory_free(
+		 safe_name_pattern );
+
+		return( -1 );
+	}
+	safe_name_pattern->pattern_type = pattern_type;
+
+	if( utf8_string_length > 0 )
+	{
+		if( libuna_utf16_string_size_from_utf8(
+		     (libuna_utf8_character_t *) utf8_string,
+		     utf8_string_length,
+		     &utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of UTF-16 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf16_string_size == 0 )
+		 || ( utf16_string_size > ( (size_t) SSIZE_MAX / sizeof( uint16_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		safe_name_pattern->characters = (uint16_t *) memory_allocate(
+		                                              sizeof( uint16_t ) * utf16_string_size );
+
+		if( safe_name_pattern->characters == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create characters.",
+			 function );
+
+			goto on_error;
+		}
+		if( libuna_utf16_string_copy_from_utf8(
+		     (libuna_utf16_character_t *) safe_name_pattern->characters,
+		     utf16_string_size,
+		     (libuna_utf8_character_t *) utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string.",
+			 function );
+
+			goto on_error;
+		}
+		/* The pattern ends at the first end-of-string character
+		 */
+		while( character_index < utf16_string_size )
+		{
+			if( safe_name_pattern->characters[ character_index ] == 0 )
+			{
+				break;
+			}
+			safe_name_pattern->characters[ character_index ] = libfwsi_name_pattern_fold_character(
+			                                                    safe_name_pattern->characters[ character_index ] );
+
+			character_index++;
+		}
+		safe_name_pattern->number_of_characters = character_index;
+
+		/* The quick prefix ends at the first non-ASCII character or wildcard
+		 */
+		for( character_index = 0;
+		     character_index < safe_name_pattern->number_of_characters;
+		     character_index++ )
+		{
+			if( character_index >= 16 )
+			{
+				break;
+			}
+			if( safe_name_pattern->characters[ character_index ] >= 0x0080 )
+			{
+				break;
+			}
+			if( ( pattern_type == LIBFWSI_NAME_PATTERN_TYPE_GLOB )
+			 && ( ( safe_name_pattern->characters[ character_index ] == (uint16_t) '*' )
+			  || ( safe_name_pattern->characters[ character_index ] == (uint16_t) '?' ) ) )
+			{
+				break;
+			}
+			safe_name_pattern->quick_prefix[ character_index ] = (uint8_t) safe_name_pattern->characters[ character_index ];
+		}
+		safe_name_pattern->quick_prefix_length = character_index;
+	}
+	*name_pattern = safe_name_pattern;
+
+	return( 1 );
+
+on_error:
+	if( safe_name_pattern != NULL )
+	{
+		libfwsi_name_pattern_free(
+		 &safe_name_pattern,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a name pattern
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_name_pattern_free(
+     libfwsi_name_pattern_t **name_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_name_pattern_free";
+
+	if( name_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_pattern != NULL )
+	{
+		if( ( *name_pattern )->characters != NULL )
+		{
+			memory_free(
+			 ( *name_pattern )->characters );
+		}
+		memory_free(
+		 *name_pattern );
+
+		*name_pattern = NULL;
+	}
+	return( 1 );
+}
+
+/* Folds the case of an UTF-16 character
+ * Only the upper case letters of the Basic Latin (U+0041 - U+005A), Latin-1 Supplement (U+00C0 - U+00DE),
+ * Latin Extended-A (U+0100 - U+017E), Greek (U+0391 - U+03A9) and Cyrillic (U+0400 - U+042F) blocks are folded
+ * U+0130 (capital I with dot above) is not folded since its lower case form is not a single character
+ * Returns the case folded character
+ */
+uint16_t libfwsi_name_pattern_fold_character(
+          uint16_t character )
+{
+	if( character < 0x0041 )
+	{
+		return( character );
+	}
+	if( character <= 0x005a )
+	{
+		return( character + 0x0020 );
+	}
+	if( character < 0x00c0 )
+	{
+		return( character );
+	}
+	if( ( character <= 0x00de )
+	 && ( character != 0x00d7 ) )
+	{
+		return( character + 0x0020 );
+	}
+	if( character < 0x0100 )
+	{
+		return( character );
+	}
+	if( character <= 0x017f )
+	{
+		/* In Latin Extended-A an upper case letter directly precedes its lower case letter.
+		 * The upper case letters are at even code points, except for U+0139 - U+0148 and
+		 * U+0179 - U+017E where they are at odd code points
+		 */
+		if( character == 0x0178 )
+		{
+			return( 0x00ff );
+		}
+		if( ( ( character >= 0x0139 )
+		  &&  ( character <= 0x0148 ) )
+		 || ( ( character >= 0x0179 )
+		  &&  ( character <= 0x017e ) ) )
+		{
+			if( ( character & 0x0001 ) != 0 )
+			{
+				return( character + 1 );
+			}
+		}
+		else if( ( character != 0x0130 )
+		      && ( character != 0x0138 ) )
+		{
+			if( ( character & 0x0001 ) == 0 )
+			{
+				return( character + 1 );
+			}
+		}
+		return( character );
+	}
+	if( ( character >= 0x0391 )
+	 && ( character <= 0x03a9 )
+	 && ( character != 0x03a2 ) )
+	{
+		return( character + 0x0020 );
+	}
+	if( ( character >= 0x0400 )
+	 && ( character <= 0x040f ) )
+	{
+		return( character + 0x0050 );
+	}
+	if( ( character >= 0x0410 )
+	 && ( character <= 0x042f ) )
+	{
+		return( character + 0x0020 );
+	}
+	return( character );
+}
+
+/* Retrieves the next character of a name
+ * UTF-16 names are read as little-endian code units, codepage names are decoded using the built-in codepage tables
+ * Returns the UTF-16 character or 0 at the end of the name
+ */
+static uint16_t libfwsi_name_pattern_get_next_character(
+                 const uint8_t *name,
+                 size_t name_size,
+                 uint8_t is_unicode,
+                 const libfwsi_single_byte_codepage_t *single_byte_codepage,
+                 const libfwsi_double_byte_codepage_t *double_byte_codepage,
+                 size_t *name_index )
+{
+	size_t safe_name_index = *name_index;
+	uint16_t character     = 0;
+	uint8_t byte_value     = 0;
+
+	if( is_unicode != 0 )
+	{
+		if( ( name_size - safe_name_index ) < 2 )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( name[ safe_name_index ] ),
+		 character );
+
+		*name_index = safe_name_index + 2;
+
+		return( character );
+	}
+	if( safe_name_index >= name_size )
+	{
+		return( 0 );
+	}
+	byte_value = name[ safe_name_index ];
+
+	if( byte_value < 0x80 )
+	{
+		character = (uint16_t) byte_value;
+	}
+	else if( single_byte_codepage != NULL )
+	{
+		character = single_byte_codepage->utf16_table[ byte_value ];
+	}
+	else if( double_byte_codepage != NULL )
+	{
+		return( libfwsi_string_get_double_byte_character(
+		         double_byte_codepage,
+		         name,
+		         name_size,
+		         name_index ) );
+	}
+	else
+	{
+		character = 0xfffd;
+	}
+	*name_index = safe_name_index + 1;
+
+	return( character );
+}
+
+/* Determines if a name cannot match the name pattern by comparing the start of the name with the quick prefix
+ * Only upper case ASCII letters are folded, which suffices since the quick prefix only contains ASCII characters
+ * and libfwsi_name_pattern_fold_character never maps a non-ASCII character onto an ASCII character,
+ * which is why U+0130 is not folded
+ * In a codepage name a byte of 0x80 or greater never decodes into an ASCII character and is therefore
+ * always a mismatch
+ * The comparison is done 16 bytes at a time using SSE2 when available
+ * Returns 1 if the name cannot match or 0 if the name needs to be matched
+ */
+int libfwsi_name_pattern_quick_reject(
+     const libfwsi_name_pattern_t *name_pattern,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t is_unicode )
+{
+#if defined( LIBFWSI_NAME_PATTERN_HAVE_SSE2 )
+	uint8_t name_block[ 16 ];
+
+	__m128i folded_values   = _mm_setzero_si128();
+	__m128i name_values     = _mm_setzero_si128();
+	__m128i prefix_values   = _mm_setzero_si128();
+	__m128i upper_values    = _mm_setzero_si128();
+	unsigned int match_bits = 0;
+#else
+	size_t character_index  = 0;
+	uint16_t character      = 0;
+#endif
+	size_t compare_length   = 0;
+
+	if( ( name_pattern == NULL )
+	 || ( name == NULL ) )
+	{
+		return( 0 );
+	}
+	compare_length = name_pattern->quick_prefix_length;
+
+	if( compare_length == 0 )
+	{
+		return( 0 );
+	}
+#if defined( LIBFWSI_NAME_PATTERN_HAVE_SSE2 )
+	/* A name that is smaller than the block is padded with end-of-string characters,
+	 * which never match a quick prefix character
+	 */
+	if( name_size >= 16 )
+	{
+		name_values = _mm_loadu_si128(
+		               (const __m128i *) name );
+	}
+	else
+	{
+		if( memory_set(
+		     name_block,
+		     0,
+		     16 ) == NULL )
+		{
+			return( 0 );
+		}
+		if( memory_copy(
+		     name_block,
+		     name,
+		     name_size ) == NULL )
+		{
+			return( 0 );
+		}
+		name_values = _mm_loadu_si128(
+		               (const __m128i *) name_block );
+	}
+	prefix_values = _mm_loadu_si128(
+	                 (const __m128i *) name_pattern->quick_prefix );
+
+	if( is_unicode != 0 )
+	{
+		/* Compare the first 8 UTF-16 little-endian code units
+		 */
+		if( compare_length > 8 )
+		{
+			compare_length = 8;
+		}
+		upper_values = _mm_and_si128(
+		                _mm_cmpgt_epi16(
+		                 name_values,
+		                 _mm_set1_epi16( (short) ( 'A' - 1 ) ) ),
+		                _mm_cmplt_epi16(
+		                 name_values,
+		                 _mm_set1_epi16( (short) ( 'Z' + 1 ) ) ) );
+
+		folded_values = _mm_or_si128(
+		                 name_values,
+		                 _mm_and_si128(
+		                  upper_values,
+		                  _mm_set1_epi16( 0x0020 ) ) );
+
+		prefix_values = _mm_unpacklo_epi8(
+		                 prefix_values,
+		                 _mm_setzero_si128() );
+
+		compare_length *= 2;
+	}
+	else
+	{
+		/* The bytes 'A' to 'Z' are the bytes for which ( byte - 'A' ) does not exceed 25
+		 */
+		upper_values = _mm_sub_epi8(
+		                name_values,
+		                _mm_set1_epi8( 'A' ) );
+
+		upper_values = _mm_cmpeq_epi8(
+		                _mm_min_epu8(
+		                 upper_values,
+		                 _mm_set1_epi8( 25 ) ),
+		                upper_values );
+
+		folded_values = _mm_or_si128(
+		                 name_values,
+		                 _mm_and_si128(
+		                  upper_values,
+		                  _mm_set1_epi8( 0x20 ) ) );
+	}
+	match_bits = (unsigned int) _mm_movemask_epi8(
+	                             _mm_cmpeq_epi8(
+	                              folded_values,
+	                              prefix_values ) );
+
+	if( compare_length < 16 )
+	{
+		match_bits |= ~( ( 1U << compare_length ) - 1 ) & 0x0000ffffUL;
+	}
+	return( match_bits != 0x0000ffffUL );
+
+#else
+	for( character_index = 0;
+	     character_index < compare_length;
+	     character_index++ )
+	{
+		if( is_unicode != 0 )
+		{
+			if( ( name_size / 2 ) <= character_index )
+			{
+				return( 1 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( name[ character_index * 2 ] ),
+			 character );
+		}
+		else
+		{
+			if( name_size <= character_index )
+			{
+				return( 1 );
+			}
+			character = (uint16_t) name[ character_index ];
+		}
+		if( ( character >= (uint16_t) 'A' )
+		 && ( character <= (uint16_t) 'Z' ) )
+		{
+			character += 0x0020;
+		}
+		if( character != (uint16_t) name_pattern->quick_prefix[ character_index ] )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+
+#endif /* defined( LIBFWSI_NAME_PATTERN_HAVE_SSE2 ) */
+}
+
+/* Determines if a name matches the name pattern
+ * The name is matched case-insensitive, as folded by libfwsi_name_pattern_fold_character,
+ * in its native encoding, either UTF-16 little-endian
+ * or the ASCII codepage, and ends at the end-of-string character or the end of the data
+ * Returns 1 if the name matches or 0 if not
+ */
+int libfwsi_name_pattern_match(
+     const libfwsi_name_pattern_t *name_pattern,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t is_unicode,
+     int ascii_codepage )
+{
+	const libfwsi_double_byte_codepage_t *double_byte_codepage = NULL;
+	const libfwsi_single_byte_codepage_t *single_byte_codepage = NULL;
+	size_t backtrack_name_index                                = 0;
+	size_t backtrack_pattern_index                             = 0;
+	size_t name_index                                          = 0;
+	size_t pattern_index                                       = 0;
+	size_t previous_name_index                                 = 0;
+	uint16_t character                                         = 0;
+	uint16_t pattern_character                                 = 0;
+	uint8_t has_backtrack                                      = 0;
+
+	if( ( name_pattern == NULL )
+	 || ( name == NULL ) )
+	{
+		return( 0 );
+	}
+	/* Reject most non-matching names before they are decoded
+	 */
+	if( libfwsi_name_pattern_quick_reject(
+	     name_pattern,
+	     name,
+	     name_size,
+	     is_unicode ) != 0 )
+	{
+		return( 0 );
+	}
+	if( is_unicode == 0 )
+	{
+		single_byte_codepage = libfwsi_codepage_tables_get_single_byte_codepage(
+		                        ascii_codepage );
+
+		if( single_byte_codepage == NULL )
+		{
+			double_byte_codepage = libfwsi_codepage_tables_get_double_byte_codepage(
+			                        ascii_codepage );
+		}
+	}
+	if( name_pattern->pattern_type != LIBFWSI_NAME_PATTERN_TYPE_GLOB )
+	{
+		while( pattern_index < name_pattern->number_of_characters )
+		{
+			character = libfwsi_name_pattern_get_next_character(
+			             name,
+			             name_size,
+			             is_unicode,
+			             single_byte_codepage,
+			             double_byte_codepage,
+			             &name_index );
+
+			if( ( character == 0 )
+			 || ( libfwsi_name_pattern_fold_character(
+			       character ) != name_pattern->characters[ pattern_index ] ) )
+			{
+				return( 0 );
+			}
+			pattern_index++;
+		}
+		if( name_pattern->pattern_type == LIBFWSI_NAME_PATTERN_TYPE_PREFIX )
+		{
+			return( 1 );
+		}
+		character = libfwsi_name_pattern_get_next_character(
+		             name,
+		             name_size,
+		             is_unicode,
+		             single_byte_codepage,
+		             double_byte_codepage,
+		             &name_index );
+
+		return( character == 0 );
+	}
+	/* Match the glob pattern, where on a mismatch the characters
+	 * matched by the last '*' are extended by one character
+	 */
+	for( ;; )
+	{
+		previous_name_index = name_index;
+
+		character = libfwsi_name_pattern_get_next_character(
+		             name,
+		             name_size,
+		             is_unicode,
+		             single_byte_codepage,
+		             double_byte_codepage,
+		             &name_index );
+
+		if( character == 0 )
+		{
+			break;
+		}
+		character = libfwsi_name_pattern_fold_character(
+		             character );
+
+		if( pattern_index < name_pattern->number_of_characters )
+		{
+			pattern_character = name_pattern->characters[ pattern_index ];
+
+			if( pattern_character == (uint16_t) '*' )
+			{
+				pattern_index++;
+
+				backtrack_pattern_index = pattern_index;
+				backtrack_name_index    = previous_name_index;
+				has_backtrack           = 1;
+
+				name_index = previous_name_index;
+
+				continue;
+			}
+			if( ( pattern_character == (uint16_t) '?' )
+			 || ( pattern_character == character ) )
+			{
+				pattern_index++;
+
+				continue;
+			}
+		}
+		if( has_backtrack == 0 )
+		{
+			return( 0 );
+		}
+		pattern_index = backtrack_pattern_index;
+		name_index    = backtrack_name_index;
+
+		libfwsi_name_pattern_get_next_character(
+		 name,
+		 name_size,
+		 is_unicode,
+		 single_byte_codepage,
+		 double_byte_codepage,
+		 &name_index );
+
+		backtrack_name_index = name_index;
+	}
+	while( ( pattern_index < name_pattern->number_of_characters )
+	    && ( name_pattern->characters[ pattern_index ] == (uint16_t) '*' ) )
+	{
+		pattern_index++;
+	}
+	return( pattern_index == name_pattern->number_of_characters );
+}
+
@@ -0,0 +1,92 @@
+/*
+ * Name pattern functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_NAME_PATTERN_H )
+#define _LIBFWSI_NAME_PATTERN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_name_pattern libfwsi_name_pattern_t;
+
+struct libfwsi_name_pattern
+{
+	/* The pattern type
+	 */
+	int pattern_type;
+
+	/* The case folded UTF-16 characters of the pattern
+	 */
+	uint16_t *characters;
+
+	/* The number of characters
+	 */
+	size_t number_of_characters;
+
+	/* The quick prefix, which contains the leading ASCII characters
+	 * of the pattern that must be matched literally
+	 */
+	uint8_t quick_prefix[ 16 ];
+
+	/* The quick prefix length
+	 */
+	size_t quick_prefix_length;
+};
+
+int libfwsi_name_pattern_initialize(
+     libfwsi_name_pattern_t **name_pattern,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int pattern_type,
+     libcerror_error_t **error );
+
+int libfwsi_name_pattern_free(
+     libfwsi_name_pattern_t **name_pattern,
+     libcerror_error_t **error );
+
+uint16_t libfwsi_name_pattern_fold_character(
+          uint16_t character );
+
+int libfwsi_name_pattern_quick_reject(
+     const libfwsi_name_pattern_t *name_pattern,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t is_unicode );
+
+int libfwsi_name_pattern_match(
+     const libfwsi_name_pattern_t *name_pattern,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t is_unicode,
+     int ascii_codepage );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_NAME_PATTERN_H ) */
+
@@ -0,0 +1,503 @@
+/*
+ * Name search functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_extension_block.h"
+#include "libfwsi_file_entry_extension_values.h"
+#include "libfwsi_file_entry_values.h"
+#include "libfwsi_item.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_name_pattern.h"
+#include "libfwsi_name_search.h"
+#include "libfwsi_types.h"
+#include "libfwsi_values_type.h"
+
+/* Creates a name search
+ * Make sure the value name_search is referencing, is set to NULL
+ * The pattern is an UTF-8 string, where a glob pattern supports
+ * the wildcards '*' (any number of characters) and '?' (a single character)
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_name_search_initialize(
+     libfwsi_name_search_t **name_search,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int pattern_type,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                = "libfwsi_name_search_initialize";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_search != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name search value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = memory_allocate_structure(
+	                        libfwsi_internal_name_search_t );
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name search.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_name_search,
+	     0,
+	     sizeof( libfwsi_internal_name_search_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name search.",
+		 function );
+
+		memory_free(
+		 internal_name_search );
+
+		return( -1 );
+	}
+	if( libfwsi_name_pattern_initialize(
+	     &( internal_name_search->name_pattern ),
+	     utf8_string,
+	     utf8_string_length,
+	     pattern_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name pattern.",
+		 function );
+
+		goto on_error;
+	}
+	*name_search = (libfwsi_name_search_t *) internal_name_search;
+
+	return( 1 );
+
+on_error:
+	if( internal_name_search != NULL )
+	{
+		memory_free(
+		 internal_name_search );
+	}
+	return( -1 );
+}
+
+/* Frees a name search
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_name_search_free(
+     libfwsi_name_search_t **name_search,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                = "libfwsi_name_search_free";
+	int result                                           = 1;
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_search != NULL )
+	{
+		internal_name_search = (libfwsi_internal_name_search_t *) *name_search;
+		*name_search         = NULL;
+
+		if( libfwsi_name_pattern_free(
+		     &( internal_name_search->name_pattern ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free name pattern.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_name_search->hits != NULL )
+		{
+			memory_free(
+			 internal_name_search->hits );
+		}
+		memory_free(
+		 internal_name_search );
+	}
+	return( result );
+}
+
+/* Appends a hit
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_name_search_append_hit(
+     libfwsi_internal_name_search_t *internal_name_search,
+     int list_identifier,
+     int item_index,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfwsi_name_search_hit_t *hit  = NULL;
+	libfwsi_name_search_hit_t *hits = NULL;
+	static char *function           = "libfwsi_internal_name_search_append_hit";
+	size_t hits_size                = 0;
+	int number_of_allocated_hits    = 0;
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_name_search->number_of_hits >= internal_name_search->number_of_allocated_hits )
+	{
+		if( internal_name_search->number_of_allocated_hits == 0 )
+		{
+			number_of_allocated_hits = 16;
+		}
+		else if( internal_name_search->number_of_allocated_hits < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_hits = internal_name_search->number_of_allocated_hits * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of hits value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		hits_size = sizeof( libfwsi_name_search_hit_t ) * (size_t) number_of_allocated_hits;
+
+		hits = (libfwsi_name_search_hit_t *) memory_reallocate(
+		                                      internal_name_search->hits,
+		                                      hits_size );
+
+		if( hits == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize hits.",
+			 function );
+
+			return( -1 );
+		}
+		internal_name_search->hits                     = hits;
+		internal_name_search->number_of_allocated_hits = number_of_allocated_hits;
+	}
+	hit = &( internal_name_search->hits[ internal_name_search->number_of_hits ] );
+
+	hit->list_identifier = list_identifier;
+	hit->item_index      = item_index;
+	hit->flags           = flags;
+
+	internal_name_search->number_of_hits += 1;
+
+	return( 1 );
+}
+
+/* Appends the items of an item list that match the name pattern
+ * The name of a file entry item and the long names of its file entry extension blocks (0xbeef0004)
+ * are matched in their native encoding, hence names that do not match are never converted
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_name_search_append_item_list(
+     libfwsi_name_search_t *name_search,
+     libfwsi_item_list_t *item_list,
+     int list_identifier,
+     libcerror_error_t **error )
+{
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	libfwsi_file_entry_values_t *file_entry_values                     = NULL;
+	libfwsi_internal_item_t *internal_item                             = NULL;
+	libfwsi_internal_item_list_t *internal_item_list                   = NULL;
+	libfwsi_internal_name_search_t *internal_name_search               = NULL;
+	static char *function                                              = "libfwsi_name_search_append_item_list";
+	int item_index                                                     = 0;
+	uint8_t hit_flags                                                  = 0;
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libfwsi_internal_name_search_t *) name_search;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	for( item_index = 0;
+	     item_index < internal_item_list->number_of_items;
+	     item_index++ )
+	{
+		internal_item = internal_item_list->items[ item_index ];
+
+		if( internal_item == NULL )
+		{
+			continue;
+		}
+		hit_flags = 0;
+
+		if( ( internal_item->type == LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+		 && ( internal_item->values_type == LIBFWSI_VALUES_TYPE_FILE_ENTRY )
+		 && ( internal_item->value != NULL ) )
+		{
+			file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+			if( libfwsi_name_pattern_match(
+			     internal_name_search->name_pattern,
+			     file_entry_values->name,
+			     file_entry_values->name_size,
+			     file_entry_values->is_unicode,
+			     internal_item->ascii_codepage ) != 0 )
+			{
+				hit_flags |= LIBFWSI_NAME_SEARCH_HIT_FLAG_NAME;
+			}
+		}
+		file_entry_extension_values = libfwsi_internal_item_get_file_entry_extension_values(
+		                               internal_item );
+
+		/* The long name is stored as an UTF-16 little-endian string
+		 */
+		if( ( file_entry_extension_values != NULL )
+		 && ( libfwsi_name_pattern_match(
+		       internal_name_search->name_pattern,
+		       file_entry_extension_values->long_name,
+		       file_entry_extension_values->long_name_size,
+		       1,
+		       internal_item->ascii_codepage ) != 0 ) )
+		{
+			hit_flags |= LIBFWSI_NAME_SEARCH_HIT_FLAG_LONG_NAME;
+		}
+		if( hit_flags == 0 )
+		{
+			continue;
+		}
+		if( libfwsi_internal_name_search_append_hit(
+		     internal_name_search,
+		     list_identifier,
+		     item_index,
+		     hit_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append hit of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of hits
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_name_search_get_number_of_hits(
+     libfwsi_name_search_t *name_search,
+     int *number_of_hits,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                = "libfwsi_name_search_get_number_of_hits";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libfwsi_internal_name_search_t *) name_search;
+
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits = internal_name_search->number_of_hits;
+
+	return( 1 );
+}
+
+/* Retrieves a specific hit
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_name_search_get_hit_by_index(
+     libfwsi_name_search_t *name_search,
+     int hit_index,
+     int *list_identifier,
+     int *item_index,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_name_search_t *internal_name_search = NULL;
+	libfwsi_name_search_hit_t *hit                       = NULL;
+	static char *function                                = "libfwsi_name_search_get_hit_by_index";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libfwsi_internal_name_search_t *) name_search;
+
+	if( ( hit_index < 0 )
+	 || ( hit_index >= internal_name_search->number_of_hits ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hit index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( list_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid list identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item index.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	hit = &( internal_name_search->hits[ hit_index ] );
+
+	*list_identifier = hit->list_identifier;
+	*item_index      = hit->item_index;
+	*flags           = hit->flags;
+
+	return( 1 );
+}
+
@@ -0,0 +1,122 @@
+/*
+ * Name search functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_NAME_SEARCH_H )
+#define _LIBFWSI_NAME_SEARCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_name_pattern.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_name_search_hit libfwsi_name_search_hit_t;
+
+struct libfwsi_name_search_hit
+{
+	/* The list identifier
+	 */
+	int list_identifier;
+
+	/* The index of the item in the list
+	 */
+	int item_index;
+
+	/* The hit flags, which indicate which names matched
+	 */
+	uint8_t flags;
+};
+
+typedef struct libfwsi_internal_name_search libfwsi_internal_name_search_t;
+
+struct libfwsi_internal_name_search
+{
+	/* The name pattern
+	 */
+	libfwsi_name_pattern_t *name_pattern;
+
+	/* The hits, stored in order of the lists and items
+	 */
+	libfwsi_name_search_hit_t *hits;
+
+	/* The number of hits
+	 */
+	int number_of_hits;
+
+	/* The number of allocated hits
+	 */
+	int number_of_allocated_hits;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_name_search_initialize(
+     libfwsi_name_search_t **name_search,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int pattern_type,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_name_search_free(
+     libfwsi_name_search_t **name_search,
+     libcerror_error_t **error );
+
+int libfwsi_internal_name_search_append_hit(
+     libfwsi_internal_name_search_t *internal_name_search,
+     int list_identifier,
+     int item_index,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_name_search_append_item_list(
+     libfwsi_name_search_t *name_search,
+     libfwsi_item_list_t *item_list,
+     int list_identifier,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_name_search_get_number_of_hits(
+     libfwsi_name_search_t *name_search,
+     int *number_of_hits,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_name_search_get_hit_by_index(
+     libfwsi_name_search_t *name_search,
+     int hit_index,
+     int *list_identifier,
+     int *item_index,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_NAME_SEARCH_H ) */
+
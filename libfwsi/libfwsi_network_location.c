@@ -26,9 +26,9 @@
 #include "libfwsi_definitions.h"
 #include "libfwsi_item.h"
 #include "libfwsi_libcerror.h"
-#include "libfwsi_libuna.h"
 #include "libfwsi_network_location.h"
 #include "libfwsi_network_location_values.h"
+#include "libfwsi_string.h"
 
 /* Retrieves the size of the UTF-8 formatted location
  * Returns 1 if successful or -1 on error
@@ -79,7 +79,7 @@ int libfwsi_network_location_get_utf8_location_size(
 	}
 	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_string_utf8_size_from_byte_stream(
 	     network_location_values->location,
 	     network_location_values->location_size,
 	     network_location_values->ascii_codepage,
@@ -148,7 +148,7 @@ int libfwsi_network_location_get_utf8_location(
 	}
 	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_string_utf8_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->location,
@@ -217,7 +217,7 @@ int libfwsi_network_location_get_utf16_location_size(
 	}
 	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
 
-	if( libuna_utf16_string_size_from_byte_stream(
+	if( libfwsi_string_utf16_size_from_byte_stream(
 	     network_location_values->location,
 	     network_location_values->location_size,
 	     network_location_values->ascii_codepage,
@@ -286,7 +286,7 @@ int libfwsi_network_location_get_utf16_location(
 	}
 	network_location_values = (libfwsi_network_location_values_t *) internal_item->value;
 
-	if( libuna_utf16_string_copy_from_byte_stream(
+	if( libfwsi_string_utf16_copy_from_byte_stream(
 	     utf16_string,
 	     utf16_string_size,
 	     network_location_values->location,
@@ -360,7 +360,7 @@ int libfwsi_network_location_get_utf8_description_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_string_utf8_size_from_byte_stream(
 	     network_location_values->description,
 	     network_location_values->description_size,
 	     network_location_values->ascii_codepage,
@@ -434,7 +434,7 @@ int libfwsi_network_location_get_utf8_description(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_string_utf8_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->description,
@@ -508,7 +508,7 @@ int libfwsi_network_location_get_utf16_description_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf16_string_size_from_byte_stream(
+	if( libfwsi_string_utf16_size_from_byte_stream(
 	     network_location_values->description,
 	     network_location_values->description_size,
 	     network_location_values->ascii_codepage,
@@ -582,7 +582,7 @@ int libfwsi_network_location_get_utf16_description(
 	{
 		return( 0 );
 	}
-	if( libuna_utf16_string_copy_from_byte_stream(
+	if( libfwsi_string_utf16_copy_from_byte_stream(
 	     utf16_string,
 	     utf16_string_size,
 	     network_location_values->description,
@@ -656,7 +656,7 @@ int libfwsi_network_location_get_utf8_comments_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_string_utf8_size_from_byte_stream(
 	     network_location_values->comments,
 	     network_location_values->comments_size,
 	     network_location_values->ascii_codepage,
@@ -730,7 +730,7 @@ int libfwsi_network_location_get_utf8_comments(
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_string_utf8_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     network_location_values->comments,
@@ -804,7 +804,7 @@ int libfwsi_network_location_get_utf16_comments_size(
 	{
 		return( 0 );
 	}
-	if( libuna_utf16_string_size_from_byte_stream(
+	if( libfwsi_string_utf16_size_from_byte_stream(
 	     network_location_values->comments,
 	     network_location_values->comments_size,
 	     network_location_values->ascii_codepage,
@@ -878,7 +878,7 @@ int libfwsi_network_location_get_utf16_comments(
 	{
 		return( 0 );
 	}
-	if( libuna_utf16_string_copy_from_byte_stream(
+	if( libfwsi_string_utf16_copy_from_byte_stream(
 	     utf16_string,
 	     utf16_string_size,
 	     network_location_values->comments,
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_libcerror.h"
@@ -149,6 +150,8 @@ int libfwsi_network_location_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER )
+
 /* Reads the network location values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -508,3 +511,5 @@ on_error:
 	return( -1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER ) */
+
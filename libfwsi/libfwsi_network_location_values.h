@@ -72,6 +72,8 @@ int libfwsi_network_location_values_free(
      libfwsi_network_location_values_t **network_location_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER )
+
 int libfwsi_network_location_values_read_data(
      libfwsi_network_location_values_t *network_location_values,
      const uint8_t *data,
@@ -79,6 +81,8 @@ int libfwsi_network_location_values_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,289 @@
+/*
+ * Parse options functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_parse_options.h"
+#include "libfwsi_types.h"
+
+/* Creates parse options
+ * Make sure the value parse_options is referencing, is set to NULL
+ * By default no limits are applied
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_parse_options_initialize(
+     libfwsi_parse_options_t **parse_options,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_parse_options_t *internal_parse_options = NULL;
+	static char *function                                    = "libfwsi_parse_options_initialize";
+
+	if( parse_options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse options.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_options != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parse options value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_options = memory_allocate_structure(
+	                          libfwsi_internal_parse_options_t );
+
+	if( internal_parse_options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parse options.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_parse_options,
+	     0,
+	     sizeof( libfwsi_internal_parse_options_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parse options.",
+		 function );
+
+		goto on_error;
+	}
+	*parse_options = (libfwsi_parse_options_t *) internal_parse_options;
+
+	return( 1 );
+
+on_error:
+	if( internal_parse_options != NULL )
+	{
+		memory_free(
+		 internal_parse_options );
+	}
+	return( -1 );
+}
+
+/* Frees parse options
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_parse_options_free(
+     libfwsi_parse_options_t **parse_options,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_parse_options_free";
+
+	if( parse_options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse options.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_options != NULL )
+	{
+		memory_free(
+		 *parse_options );
+
+		*parse_options = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of items of an item list
+ * 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_parse_options_set_maximum_number_of_items(
+     libfwsi_parse_options_t *parse_options,
+     int maximum_number_of_items,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_parse_options_t *internal_parse_options = NULL;
+	static char *function                                    = "libfwsi_parse_options_set_maximum_number_of_items";
+
+	if( parse_options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse options.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_options = (libfwsi_internal_parse_options_t *) parse_options;
+
+	if( ( maximum_number_of_items < 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_options->maximum_number_of_items = maximum_number_of_items;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of extension blocks of an item
+ * 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_parse_options_set_maximum_number_of_extension_blocks(
+     libfwsi_parse_options_t *parse_options,
+     int maximum_number_of_extension_blocks,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_parse_options_t *internal_parse_options = NULL;
+	static char *function                                    = "libfwsi_parse_options_set_maximum_number_of_extension_blocks";
+
+	if( parse_options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse options.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_options = (libfwsi_internal_parse_options_t *) parse_options;
+
+	if( ( maximum_number_of_extension_blocks < 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of extension blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_options->maximum_number_of_extension_blocks = maximum_number_of_extension_blocks;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of properties of a property store
+ * 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_parse_options_set_maximum_number_of_properties(
+     libfwsi_parse_options_t *parse_options,
+     uint32_t maximum_number_of_properties,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_parse_options_t *internal_parse_options = NULL;
+	static char *function                                    = "libfwsi_parse_options_set_maximum_number_of_properties";
+
+	if( parse_options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse options.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_options = (libfwsi_internal_parse_options_t *) parse_options;
+	internal_parse_options->maximum_number_of_properties = maximum_number_of_properties;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of bytes allocated for an item list
+ * The limit is checked before each shell item is allocated and after its values are read,
+ * hence it is a soft limit that can be exceeded by the allocations of a single shell item
+ * 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_parse_options_set_maximum_allocation_size(
+     libfwsi_parse_options_t *parse_options,
+     size_t maximum_allocation_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_parse_options_t *internal_parse_options = NULL;
+	static char *function                                    = "libfwsi_parse_options_set_maximum_allocation_size";
+
+	if( parse_options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse options.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_options = (libfwsi_internal_parse_options_t *) parse_options;
+
+	if( ( maximum_allocation_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum allocation size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_options->maximum_allocation_size = maximum_allocation_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,101 @@
+/*
+ * Parse options functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_PARSE_OPTIONS_H )
+#define _LIBFWSI_PARSE_OPTIONS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_internal_parse_options libfwsi_internal_parse_options_t;
+
+struct libfwsi_internal_parse_options
+{
+	/* The maximum number of items of an item list, where 0 represents no limit
+	 */
+	int maximum_number_of_items;
+
+	/* The maximum number of extension blocks of an item, where 0 represents no limit
+	 */
+	int maximum_number_of_extension_blocks;
+
+	/* The maximum number of properties of a property store, where 0 represents no limit
+	 */
+	uint32_t maximum_number_of_properties;
+
+	/* The maximum number of bytes allocated for an item list, where 0 represents no limit
+	 */
+	size_t maximum_allocation_size;
+
+	/* Value to indicate a limit was exceeded while reading
+	 * This value is only set on the copy of the parse options used by a read
+	 */
+	uint8_t limit_exceeded;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_parse_options_initialize(
+     libfwsi_parse_options_t **parse_options,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_parse_options_free(
+     libfwsi_parse_options_t **parse_options,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_parse_options_set_maximum_number_of_items(
+     libfwsi_parse_options_t *parse_options,
+     int maximum_number_of_items,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_parse_options_set_maximum_number_of_extension_blocks(
+     libfwsi_parse_options_t *parse_options,
+     int maximum_number_of_extension_blocks,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_parse_options_set_maximum_number_of_properties(
+     libfwsi_parse_options_t *parse_options,
+     uint32_t maximum_number_of_properties,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_parse_options_set_maximum_allocation_size(
+     libfwsi_parse_options_t *parse_options,
+     size_t maximum_allocation_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_PARSE_OPTIONS_H ) */
+
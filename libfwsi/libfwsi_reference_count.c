@@ -0,0 +1,224 @@
+/*
+ * Reference count functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_reference_count.h"
+
+/* Initializes a reference count to a single reference
+ */
+void libfwsi_reference_count_initialize(
+      libfwsi_reference_count_t *reference_count )
+{
+#if defined( LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED )
+	InterlockedExchange(
+	 reference_count,
+	 1 );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_ATOMIC_BUILTINS )
+	__atomic_store_n(
+	 reference_count,
+	 1,
+	 __ATOMIC_RELAXED );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_SYNC_BUILTINS )
+	*reference_count = 1;
+
+	__sync_synchronize();
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC )
+	atomic_store_explicit(
+	 reference_count,
+	 1,
+	 memory_order_relaxed );
+
+#endif
+}
+
+/* Adds a reference
+ * A reference is only added by a holder of another reference, hence no ordering is needed
+ * Returns the new number of references
+ */
+int32_t libfwsi_reference_count_increment(
+         libfwsi_reference_count_t *reference_count )
+{
+#if defined( LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED )
+	return( (int32_t) InterlockedIncrement(
+	                   reference_count ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_ATOMIC_BUILTINS )
+	return( __atomic_add_fetch(
+	         reference_count,
+	         1,
+	         __ATOMIC_RELAXED ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_SYNC_BUILTINS )
+	return( __sync_add_and_fetch(
+	         reference_count,
+	         1 ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC )
+	return( atomic_fetch_add_explicit(
+	         reference_count,
+	         1,
+	         memory_order_relaxed ) + 1 );
+
+#endif
+}
+
+/* Removes a reference
+ * The removal orders the preceding changes of all threads before the last reference
+ * is removed, so that the holder of the last reference can free the object
+ * Returns the new number of references
+ */
+int32_t libfwsi_reference_count_decrement(
+         libfwsi_reference_count_t *reference_count )
+{
+#if defined( LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED )
+	return( (int32_t) InterlockedDecrement(
+	                   reference_count ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_ATOMIC_BUILTINS )
+	return( __atomic_sub_fetch(
+	         reference_count,
+	         1,
+	         __ATOMIC_ACQ_REL ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_SYNC_BUILTINS )
+	return( __sync_sub_and_fetch(
+	         reference_count,
+	         1 ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC )
+	return( atomic_fetch_sub_explicit(
+	         reference_count,
+	         1,
+	         memory_order_acq_rel ) - 1 );
+
+#endif
+}
+
+/* Retrieves the number of references
+ * The value can be outdated by the time it is used if other threads hold references
+ * Returns the number of references
+ */
+int32_t libfwsi_reference_count_get(
+         libfwsi_reference_count_t *reference_count )
+{
+#if defined( LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED )
+	return( (int32_t) InterlockedCompareExchange(
+	                   reference_count,
+	                   0,
+	                   0 ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_ATOMIC_BUILTINS )
+	return( __atomic_load_n(
+	         reference_count,
+	         __ATOMIC_RELAXED ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_SYNC_BUILTINS )
+	return( __sync_add_and_fetch(
+	         reference_count,
+	         0 ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC )
+	return( atomic_load_explicit(
+	         reference_count,
+	         memory_order_relaxed ) );
+
+#endif
+}
+
+/* Retrieves a pointer that is set once
+ * The retrieval orders the changes made before the pointer was set before the use of the pointer
+ * Returns the pointer or NULL if not set
+ */
+void *libfwsi_reference_count_get_pointer(
+       libfwsi_reference_count_pointer_t *pointer )
+{
+#if defined( LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED )
+	return( InterlockedCompareExchangePointer(
+	         pointer,
+	         NULL,
+	         NULL ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_ATOMIC_BUILTINS )
+	return( __atomic_load_n(
+	         pointer,
+	         __ATOMIC_ACQUIRE ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_SYNC_BUILTINS )
+	return( __sync_val_compare_and_swap(
+	         pointer,
+	         NULL,
+	         NULL ) );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC )
+	return( atomic_load_explicit(
+	         pointer,
+	         memory_order_acquire ) );
+
+#endif
+}
+
+/* Sets a pointer that is set once
+ * The pointer is only set if it is not set yet, where the changes made before
+ * the pointer is set are ordered before the use of the pointer by other threads
+ * Returns 1 if the pointer was set or 0 if the pointer was already set
+ */
+int libfwsi_reference_count_set_pointer_if_null(
+     libfwsi_reference_count_pointer_t *pointer,
+     void *value )
+{
+	void *expected_value = NULL;
+
+#if defined( LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED )
+	return( InterlockedCompareExchangePointer(
+	         pointer,
+	         value,
+	         NULL ) == NULL );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_ATOMIC_BUILTINS )
+	return( __atomic_compare_exchange_n(
+	         pointer,
+	         &expected_value,
+	         value,
+	         0,
+	         __ATOMIC_ACQ_REL,
+	         __ATOMIC_ACQUIRE ) != 0 );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_SYNC_BUILTINS )
+	return( __sync_val_compare_and_swap(
+	         pointer,
+	         expected_value,
+	         value ) == NULL );
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC )
+	return( atomic_compare_exchange_strong_explicit(
+	         pointer,
+	         &expected_value,
+	         value,
+	         memory_order_acq_rel,
+	         memory_order_acquire ) != 0 );
+
+#endif
+}
@@ -0,0 +1,105 @@
+/*
+ * Reference count functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_REFERENCE_COUNT_H )
+#define _LIBFWSI_REFERENCE_COUNT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The reference count is updated with the Interlocked functions on Windows,
+ * with the atomic built-in functions of GCC and compatible compilers or
+ * with the C11 atomic operations
+ */
+#if defined( WINAPI )
+#define LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED
+
+#elif defined( __GNUC__ ) && defined( __ATOMIC_RELAXED )
+#define LIBFWSI_REFERENCE_COUNT_HAVE_ATOMIC_BUILTINS
+
+#elif defined( __GNUC__ )
+#define LIBFWSI_REFERENCE_COUNT_HAVE_SYNC_BUILTINS
+
+#elif defined( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 201112L ) && !defined( __STDC_NO_ATOMICS__ )
+#define LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC
+
+#include <stdatomic.h>
+
+#else
+#error Missing atomic operations for the reference count
+
+#endif
+
+/* The reference count, which is updated atomically
+ */
+#if defined( LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED )
+typedef LONG libfwsi_reference_count_t;
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC )
+typedef _Atomic int32_t libfwsi_reference_count_t;
+
+#else
+typedef int32_t libfwsi_reference_count_t;
+
+#endif
+
+/* A pointer that is set once, which is updated atomically
+ */
+#if defined( LIBFWSI_REFERENCE_COUNT_HAVE_INTERLOCKED )
+typedef PVOID volatile libfwsi_reference_count_pointer_t;
+
+#elif defined( LIBFWSI_REFERENCE_COUNT_HAVE_STDATOMIC )
+typedef void * _Atomic libfwsi_reference_count_pointer_t;
+
+#else
+typedef void *libfwsi_reference_count_pointer_t;
+
+#endif
+
+void libfwsi_reference_count_initialize(
+      libfwsi_reference_count_t *reference_count );
+
+int32_t libfwsi_reference_count_increment(
+         libfwsi_reference_count_t *reference_count );
+
+int32_t libfwsi_reference_count_decrement(
+         libfwsi_reference_count_t *reference_count );
+
+int32_t libfwsi_reference_count_get(
+         libfwsi_reference_count_t *reference_count );
+
+void *libfwsi_reference_count_get_pointer(
+       libfwsi_reference_count_pointer_t *pointer );
+
+int libfwsi_reference_count_set_pointer_if_null(
+     libfwsi_reference_count_pointer_t *pointer,
+     void *value );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_REFERENCE_COUNT_H ) */
+
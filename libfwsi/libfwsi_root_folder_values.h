@@ -48,12 +48,16 @@ int libfwsi_root_folder_values_free(
      libfwsi_root_folder_values_t **root_folder_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER )
+
 int libfwsi_root_folder_values_read_data(
      libfwsi_root_folder_values_t *root_folder_values,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,821 @@
+/*
+ * String functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_codepage_tables.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
+
+/* Determines the number of ASCII characters at the start of a byte stream
+ * The run ends at the first byte with the most significant bit set or the end-of-string character
+ * Returns the number of bytes in the run
+ */
+size_t libfwsi_string_get_ascii_run_size(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size )
+{
+	size_t byte_stream_index = 0;
+	uint64_t value_64bit     = 0;
+	uint8_t byte_value       = 0;
+
+	/* Check 8 bytes at a time, the run ends if a byte is 0 or >= 0x80
+	 */
+	while( ( byte_stream_size - byte_stream_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( byte_stream[ byte_stream_index ] ),
+		 value_64bit );
+
+		if( ( ( value_64bit | ( ( value_64bit - (uint64_t) 0x0101010101010101ULL ) & ~value_64bit ) )
+		   & (uint64_t) 0x8080808080808080ULL ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 8;
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		byte_value = byte_stream[ byte_stream_index ];
+
+		if( ( byte_value == 0 )
+		 || ( byte_value >= 0x80 ) )
+		{
+			break;
+		}
+		byte_stream_index++;
+	}
+	return( byte_stream_index );
+}
+
+/* Retrieves an UTF-16 character from a double byte codepage byte stream
+ * Invalid or undefined byte sequences are returned as U+FFFD
+ * Returns the UTF-16 character
+ */
+uint16_t libfwsi_string_get_double_byte_character(
+          const libfwsi_double_byte_codepage_t *double_byte_codepage,
+          const uint8_t *byte_stream,
+          size_t byte_stream_size,
+          size_t *byte_stream_index )
+{
+	size_t safe_byte_stream_index = *byte_stream_index;
+	uint8_t byte_value            = 0;
+	uint8_t row_number            = 0;
+
+	byte_value = byte_stream[ safe_byte_stream_index++ ];
+	row_number = double_byte_codepage->lead_byte_table[ byte_value ];
+
+	*byte_stream_index = safe_byte_stream_index;
+
+	if( row_number == 0 )
+	{
+		return( double_byte_codepage->utf16_table[ byte_value ] );
+	}
+	if( safe_byte_stream_index >= byte_stream_size )
+	{
+		return( 0xfffd );
+	}
+	byte_value = byte_stream[ safe_byte_stream_index ];
+
+	/* Do not consume a byte that cannot be a trail byte
+	 */
+	if( ( byte_value < 0x40 )
+	 || ( byte_value > 0xfe ) )
+	{
+		return( 0xfffd );
+	}
+	*byte_stream_index = safe_byte_stream_index + 1;
+
+	if( row_number == LIBFWSI_CODEPAGE_TABLES_LEAD_BYTE_WITHOUT_ROW )
+	{
+		return( 0xfffd );
+	}
+	return( double_byte_codepage->rows[ row_number - 1 ][ byte_value - 0x40 ] );
+}
+
+/* Determines the size of an UTF-8 string from a byte stream
+ * The size includes the end-of-string character
+ * Codepages without built-in tables are converted using libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_utf8_size_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	const libfwsi_double_byte_codepage_t *double_byte_codepage = NULL;
+	const libfwsi_single_byte_codepage_t *single_byte_codepage = NULL;
+	static char *function                                      = "libfwsi_string_utf8_size_from_byte_stream";
+	size_t ascii_run_size                                      = 0;
+	size_t byte_stream_index                                   = 0;
+	size_t safe_utf8_string_size                               = 0;
+	uint16_t utf16_character                                   = 0;
+	uint8_t byte_value                                         = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	single_byte_codepage = libfwsi_codepage_tables_get_single_byte_codepage(
+	                        codepage );
+
+	if( single_byte_codepage != NULL )
+	{
+		while( byte_stream_index < byte_stream_size )
+		{
+			byte_value = byte_stream[ byte_stream_index++ ];
+
+			if( byte_value == 0 )
+			{
+				break;
+			}
+			safe_utf8_string_size += single_byte_codepage->utf8_table[ byte_value ][ 3 ];
+		}
+	}
+	else
+	{
+		double_byte_codepage = libfwsi_codepage_tables_get_double_byte_codepage(
+		                        codepage );
+
+		if( double_byte_codepage == NULL )
+		{
+			if( libuna_utf8_string_size_from_byte_stream(
+			     byte_stream,
+			     byte_stream_size,
+			     codepage,
+			     utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine size of UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		while( byte_stream_index < byte_stream_size )
+		{
+			ascii_run_size = libfwsi_string_get_ascii_run_size(
+			                  &( byte_stream[ byte_stream_index ] ),
+			                  byte_stream_size - byte_stream_index );
+
+			byte_stream_index     += ascii_run_size;
+			safe_utf8_string_size += ascii_run_size;
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+			utf16_character = libfwsi_string_get_double_byte_character(
+			                   double_byte_codepage,
+			                   byte_stream,
+			                   byte_stream_size,
+			                   &byte_stream_index );
+
+			if( utf16_character == 0 )
+			{
+				break;
+			}
+			else if( utf16_character < 0x0080 )
+			{
+				safe_utf8_string_size += 1;
+			}
+			else if( utf16_character < 0x0800 )
+			{
+				safe_utf8_string_size += 2;
+			}
+			else
+			{
+				safe_utf8_string_size += 3;
+			}
+		}
+	}
+	/* Add the size of the end-of-string character
+	 */
+	if( byte_stream_size > 0 )
+	{
+		safe_utf8_string_size += 1;
+	}
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from a byte stream
+ * The size should include the end-of-string character
+ * Codepages without built-in tables are converted using libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_utf8_copy_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	const libfwsi_double_byte_codepage_t *double_byte_codepage = NULL;
+	const libfwsi_single_byte_codepage_t *single_byte_codepage = NULL;
+	const uint8_t *utf8_table_entry                            = NULL;
+	static char *function                                      = "libfwsi_string_utf8_copy_from_byte_stream";
+	size_t ascii_run_size                                      = 0;
+	size_t byte_stream_index                                   = 0;
+	size_t utf8_string_index                                   = 0;
+	uint16_t utf16_character                                   = 0;
+	uint8_t byte_value                                         = 0;
+	uint8_t number_of_utf8_bytes                               = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	single_byte_codepage = libfwsi_codepage_tables_get_single_byte_codepage(
+	                        codepage );
+
+	if( single_byte_codepage != NULL )
+	{
+		while( byte_stream_index < byte_stream_size )
+		{
+			byte_value = byte_stream[ byte_stream_index++ ];
+
+			if( byte_value == 0 )
+			{
+				break;
+			}
+			utf8_table_entry     = single_byte_codepage->utf8_table[ byte_value ];
+			number_of_utf8_bytes = utf8_table_entry[ 3 ];
+
+			if( (size_t) number_of_utf8_bytes > ( utf8_string_size - utf8_string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ utf8_string_index++ ] = utf8_table_entry[ 0 ];
+
+			if( number_of_utf8_bytes > 1 )
+			{
+				utf8_string[ utf8_string_index++ ] = utf8_table_entry[ 1 ];
+
+				if( number_of_utf8_bytes > 2 )
+				{
+					utf8_string[ utf8_string_index++ ] = utf8_table_entry[ 2 ];
+				}
+			}
+		}
+	}
+	else
+	{
+		double_byte_codepage = libfwsi_codepage_tables_get_double_byte_codepage(
+		                        codepage );
+
+		if( double_byte_codepage == NULL )
+		{
+			if( libuna_utf8_string_copy_from_byte_stream(
+			     utf8_string,
+			     utf8_string_size,
+			     byte_stream,
+			     byte_stream_size,
+			     codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string from byte stream.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		while( byte_stream_index < byte_stream_size )
+		{
+			ascii_run_size = libfwsi_string_get_ascii_run_size(
+			                  &( byte_stream[ byte_stream_index ] ),
+			                  byte_stream_size - byte_stream_index );
+
+			if( ascii_run_size > 0 )
+			{
+				if( ascii_run_size > ( utf8_string_size - utf8_string_index ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-8 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( memory_copy(
+				     &( utf8_string[ utf8_string_index ] ),
+				     &( byte_stream[ byte_stream_index ] ),
+				     ascii_run_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy ASCII characters.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_index += ascii_run_size;
+				utf8_string_index += ascii_run_size;
+			}
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+			utf16_character = libfwsi_string_get_double_byte_character(
+			                   double_byte_codepage,
+			                   byte_stream,
+			                   byte_stream_size,
+			                   &byte_stream_index );
+
+			if( utf16_character == 0 )
+			{
+				break;
+			}
+			else if( utf16_character < 0x0080 )
+			{
+				number_of_utf8_bytes = 1;
+			}
+			else if( utf16_character < 0x0800 )
+			{
+				number_of_utf8_bytes = 2;
+			}
+			else
+			{
+				number_of_utf8_bytes = 3;
+			}
+			if( (size_t) number_of_utf8_bytes > ( utf8_string_size - utf8_string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( number_of_utf8_bytes == 1 )
+			{
+				utf8_string[ utf8_string_index++ ] = (uint8_t) utf16_character;
+			}
+			else if( number_of_utf8_bytes == 2 )
+			{
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( utf16_character >> 6 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( utf16_character & 0x3f ) );
+			}
+			else
+			{
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( utf16_character >> 12 ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( utf16_character >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( utf16_character & 0x3f ) );
+			}
+		}
+	}
+	if( utf8_string_index >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ utf8_string_index ] = 0;
+
+	return( 1 );
+}
+
+/* Determines the size of an UTF-16 string from a byte stream
+ * The size includes the end-of-string character
+ * Codepages without built-in tables are converted using libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_utf16_size_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	const libfwsi_double_byte_codepage_t *double_byte_codepage = NULL;
+	const libfwsi_single_byte_codepage_t *single_byte_codepage = NULL;
+	static char *function                                      = "libfwsi_string_utf16_size_from_byte_stream";
+	size_t ascii_run_size                                      = 0;
+	size_t byte_stream_index                                   = 0;
+	size_t safe_utf16_string_size                              = 0;
+	uint16_t utf16_character                                   = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	single_byte_codepage = libfwsi_codepage_tables_get_single_byte_codepage(
+	                        codepage );
+
+	if( single_byte_codepage != NULL )
+	{
+		/* Every byte maps onto a single UTF-16 code unit
+		 */
+		while( byte_stream_index < byte_stream_size )
+		{
+			if( byte_stream[ byte_stream_index ] == 0 )
+			{
+				break;
+			}
+			byte_stream_index++;
+		}
+		safe_utf16_string_size = byte_stream_index;
+	}
+	else
+	{
+		double_byte_codepage = libfwsi_codepage_tables_get_double_byte_codepage(
+		                        codepage );
+
+		if( double_byte_codepage == NULL )
+		{
+			if( libuna_utf16_string_size_from_byte_stream(
+			     byte_stream,
+			     byte_stream_size,
+			     codepage,
+			     utf16_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine size of UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		/* Every character maps onto a single UTF-16 code unit
+		 */
+		while( byte_stream_index < byte_stream_size )
+		{
+			ascii_run_size = libfwsi_string_get_ascii_run_size(
+			                  &( byte_stream[ byte_stream_index ] ),
+			                  byte_stream_size - byte_stream_index );
+
+			byte_stream_index      += ascii_run_size;
+			safe_utf16_string_size += ascii_run_size;
+
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+			utf16_character = libfwsi_string_get_double_byte_character(
+			                   double_byte_codepage,
+			                   byte_stream,
+			                   byte_stream_size,
+			                   &byte_stream_index );
+
+			if( utf16_character == 0 )
+			{
+				break;
+			}
+			safe_utf16_string_size++;
+		}
+	}
+	/* Add the size of the end-of-string character
+	 */
+	if( byte_stream_size > 0 )
+	{
+		safe_utf16_string_size += 1;
+	}
+	*utf16_string_size = safe_utf16_string_size;
+
+	return( 1 );
+}
+
+/* Copies an UTF-16 string from a byte stream
+ * The size should include the end-of-string character
+ * Codepages without built-in tables are converted using libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_string_utf16_copy_from_byte_stream(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	const libfwsi_double_byte_codepage_t *double_byte_codepage = NULL;
+	const libfwsi_single_byte_codepage_t *single_byte_codepage = NULL;
+	const uint16_t *utf16_table                                = NULL;
+	static char *function                                      = "libfwsi_string_utf16_copy_from_byte_stream";
+	size_t ascii_run_end_index                                 = 0;
+	size_t byte_stream_index                                   = 0;
+	size_t utf16_string_index                                  = 0;
+	uint16_t utf16_character                                   = 0;
+	uint8_t byte_value                                         = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	single_byte_codepage = libfwsi_codepage_tables_get_single_byte_codepage(
+	                        codepage );
+
+	if( single_byte_codepage != NULL )
+	{
+		utf16_table = single_byte_codepage->utf16_table;
+
+		while( byte_stream_index < byte_stream_size )
+		{
+			byte_value = byte_stream[ byte_stream_index++ ];
+
+			if( byte_value == 0 )
+			{
+				break;
+			}
+			if( utf16_string_index >= utf16_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-16 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf16_string[ utf16_string_index++ ] = utf16_table[ byte_value ];
+		}
+	}
+	else
+	{
+		double_byte_codepage = libfwsi_codepage_tables_get_double_byte_codepage(
+		                        codepage );
+
+		if( double_byte_codepage == NULL )
+		{
+			if( libuna_utf16_string_copy_from_byte_stream(
+			     utf16_string,
+			     utf16_string_size,
+			     byte_stream,
+			     byte_stream_size,
+			     codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string from byte stream.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		while( byte_stream_index < byte_stream_size )
+		{
+			ascii_run_end_index = byte_stream_index + libfwsi_string_get_ascii_run_size(
+			                                           &( byte_stream[ byte_stream_index ] ),
+			                                           byte_stream_size - byte_stream_index );
+
+			if( ( ascii_run_end_index - byte_stream_index ) > ( utf16_string_size - utf16_string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-16 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			while( byte_stream_index < ascii_run_end_index )
+			{
+				utf16_string[ utf16_string_index++ ] = (uint16_t) byte_stream[ byte_stream_index++ ];
+			}
+			if( byte_stream_index >= byte_stream_size )
+			{
+				break;
+			}
+			utf16_character = libfwsi_string_get_double_byte_character(
+			                   double_byte_codepage,
+			                   byte_stream,
+			                   byte_stream_size,
+			                   &byte_stream_index );
+
+			if( utf16_character == 0 )
+			{
+				break;
+			}
+			if( utf16_string_index >= utf16_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-16 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf16_string[ utf16_string_index++ ] = utf16_character;
+		}
+	}
+	if( utf16_string_index >= utf16_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-16 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf16_string[ utf16_string_index ] = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,80 @@
+/*
+ * String functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_STRING_H )
+#define _LIBFWSI_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_codepage_tables.h"
+#include "libfwsi_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+size_t libfwsi_string_get_ascii_run_size(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size );
+
+uint16_t libfwsi_string_get_double_byte_character(
+          const libfwsi_double_byte_codepage_t *double_byte_codepage,
+          const uint8_t *byte_stream,
+          size_t byte_stream_size,
+          size_t *byte_stream_index );
+
+int libfwsi_string_utf8_size_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_string_utf8_copy_from_byte_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error );
+
+int libfwsi_string_utf16_size_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libfwsi_string_utf16_copy_from_byte_stream(
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_STRING_H ) */
+
@@ -0,0 +1,692 @@
+/*
+ * Timeline functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_definitions.h"
+#include "libfwsi_extension_block.h"
+#include "libfwsi_fat_date_time.h"
+#include "libfwsi_file_entry_extension_values.h"
+#include "libfwsi_file_entry_values.h"
+#include "libfwsi_item.h"
+#include "libfwsi_item_list.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_timeline.h"
+#include "libfwsi_types.h"
+#include "libfwsi_values_type.h"
+
+/* Creates a timeline
+ * Make sure the value timeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_timeline_initialize(
+     libfwsi_timeline_t **timeline,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_timeline_t *internal_timeline = NULL;
+	static char *function                          = "libfwsi_timeline_initialize";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = memory_allocate_structure(
+	                     libfwsi_internal_timeline_t );
+
+	if( internal_timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_timeline,
+	     0,
+	     sizeof( libfwsi_internal_timeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline.",
+		 function );
+
+		goto on_error;
+	}
+	/* An empty timeline is sorted
+	 */
+	internal_timeline->is_sorted = 1;
+
+	*timeline = (libfwsi_timeline_t *) internal_timeline;
+
+	return( 1 );
+
+on_error:
+	if( internal_timeline != NULL )
+	{
+		memory_free(
+		 internal_timeline );
+	}
+	return( -1 );
+}
+
+/* Frees a timeline
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_timeline_free(
+     libfwsi_timeline_t **timeline,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_timeline_t *internal_timeline = NULL;
+	static char *function                          = "libfwsi_timeline_free";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline != NULL )
+	{
+		internal_timeline = (libfwsi_internal_timeline_t *) *timeline;
+		*timeline         = NULL;
+
+		if( internal_timeline->events != NULL )
+		{
+			memory_free(
+			 internal_timeline->events );
+		}
+		memory_free(
+		 internal_timeline );
+	}
+	return( 1 );
+}
+
+/* Appends an event
+ * Events of FAT date and time values that are not set or invalid are not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_internal_timeline_append_event(
+     libfwsi_internal_timeline_t *internal_timeline,
+     uint32_t fat_date_time,
+     uint8_t kind,
+     int list_identifier,
+     int item_index,
+     libcerror_error_t **error )
+{
+	libfwsi_timeline_event_t *event  = NULL;
+	libfwsi_timeline_event_t *events = NULL;
+	static char *function            = "libfwsi_internal_timeline_append_event";
+	size_t events_size               = 0;
+	uint64_t timestamp               = 0;
+	int number_of_allocated_events   = 0;
+	int result                       = 0;
+
+	if( internal_timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fat_date_time,
+	          &timestamp,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy FAT date and time to FILETIME.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_timeline->number_of_events >= internal_timeline->number_of_allocated_events )
+	{
+		if( internal_timeline->number_of_allocated_events == 0 )
+		{
+			number_of_allocated_events = 64;
+		}
+		else if( internal_timeline->number_of_allocated_events < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_events = internal_timeline->number_of_allocated_events * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of events value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		events_size = sizeof( libfwsi_timeline_event_t ) * (size_t) number_of_allocated_events;
+
+		events = (libfwsi_timeline_event_t *) memory_reallocate(
+		                                       internal_timeline->events,
+		                                       events_size );
+
+		if( events == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize events.",
+			 function );
+
+			return( -1 );
+		}
+		internal_timeline->events                     = events;
+		internal_timeline->number_of_allocated_events = number_of_allocated_events;
+	}
+	event = &( internal_timeline->events[ internal_timeline->number_of_events ] );
+
+	event->timestamp       = timestamp;
+	event->list_identifier = list_identifier;
+	event->item_index      = item_index;
+	event->kind            = kind;
+
+	internal_timeline->number_of_events += 1;
+	internal_timeline->is_sorted         = 0;
+
+	return( 1 );
+}
+
+/* Appends the events of the items of an item list
+ * The modification time is read from the file entry item and the creation and access times
+ * from its first file entry extension block (0xbeef0004)
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_timeline_append_item_list(
+     libfwsi_timeline_t *timeline,
+     libfwsi_item_list_t *item_list,
+     int list_identifier,
+     libcerror_error_t **error )
+{
+	libfwsi_file_entry_extension_values_t *file_entry_extension_values = NULL;
+	libfwsi_file_entry_values_t *file_entry_values                     = NULL;
+	libfwsi_internal_item_t *internal_item                             = NULL;
+	libfwsi_internal_item_list_t *internal_item_list                   = NULL;
+	libfwsi_internal_timeline_t *internal_timeline                     = NULL;
+	static char *function                                              = "libfwsi_timeline_append_item_list";
+	int item_index                                                     = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libfwsi_internal_timeline_t *) timeline;
+
+	if( item_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_list = (libfwsi_internal_item_list_t *) item_list;
+
+	for( item_index = 0;
+	     item_index < internal_item_list->number_of_items;
+	     item_index++ )
+	{
+		internal_item = internal_item_list->items[ item_index ];
+
+		if( ( internal_item == NULL )
+		 || ( internal_item->type != LIBFWSI_ITEM_TYPE_FILE_ENTRY )
+		 || ( internal_item->values_type != LIBFWSI_VALUES_TYPE_FILE_ENTRY )
+		 || ( internal_item->value == NULL ) )
+		{
+			continue;
+		}
+		file_entry_values = (libfwsi_file_entry_values_t *) internal_item->value;
+
+		if( libfwsi_internal_timeline_append_event(
+		     internal_timeline,
+		     file_entry_values->modification_time,
+		     LIBFWSI_TIMELINE_EVENT_KIND_MODIFICATION_TIME,
+		     list_identifier,
+		     item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append modification time event of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		file_entry_extension_values = libfwsi_internal_item_get_file_entry_extension_values(
+		                               internal_item );
+
+		if( file_entry_extension_values == NULL )
+		{
+			continue;
+		}
+		if( libfwsi_internal_timeline_append_event(
+		     internal_timeline,
+		     file_entry_extension_values->creation_time,
+		     LIBFWSI_TIMELINE_EVENT_KIND_CREATION_TIME,
+		     list_identifier,
+		     item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append creation time event of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( libfwsi_internal_timeline_append_event(
+		     internal_timeline,
+		     file_entry_extension_values->access_time,
+		     LIBFWSI_TIMELINE_EVENT_KIND_ACCESS_TIME,
+		     list_identifier,
+		     item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append access time event of item: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sorts events by timestamp using a least significant digit radix sort
+ * The timestamp is sorted 8 bits at a time, where the counts of all 8 digits are determined
+ * in a single pass and a digit that is the same for all events is skipped
+ * The sort is stable, hence events with the same timestamp retain their order
+ * The events and scratch events are swapped when the sorted events end up in the scratch events
+ */
+void libfwsi_timeline_radix_sort_events(
+      libfwsi_timeline_event_t **events,
+      libfwsi_timeline_event_t **scratch_events,
+      int number_of_events )
+{
+	int counts[ 8 ][ 256 ];
+
+	libfwsi_timeline_event_t *destination_events = NULL;
+	libfwsi_timeline_event_t *source_events      = NULL;
+	libfwsi_timeline_event_t *swap_events        = NULL;
+	uint64_t timestamp                           = 0;
+	int count                                    = 0;
+	int digit_index                              = 0;
+	int event_index                              = 0;
+	int offset                                   = 0;
+	int value_index                              = 0;
+	uint8_t bit_shift                            = 0;
+
+	if( ( events == NULL )
+	 || ( scratch_events == NULL )
+	 || ( number_of_events < 2 ) )
+	{
+		return;
+	}
+	source_events      = *events;
+	destination_events = *scratch_events;
+
+	if( memory_set(
+	     counts,
+	     0,
+	     sizeof( int ) * 8 * 256 ) == NULL )
+	{
+		return;
+	}
+	for( event_index = 0;
+	     event_index < number_of_events;
+	     event_index++ )
+	{
+		timestamp = source_events[ event_index ].timestamp;
+
+		for( digit_index = 0;
+		     digit_index < 8;
+		     digit_index++ )
+		{
+			counts[ digit_index ][ timestamp & 0xff ] += 1;
+
+			timestamp >>= 8;
+		}
+	}
+	for( digit_index = 0;
+	     digit_index < 8;
+	     digit_index++ )
+	{
+		bit_shift = (uint8_t) ( digit_index * 8 );
+
+		/* Skip the digit if it is the same for all events
+		 */
+		timestamp = ( source_events[ 0 ].timestamp >> bit_shift ) & 0xff;
+
+		if( counts[ digit_index ][ timestamp ] == number_of_events )
+		{
+			continue;
+		}
+		/* Convert the counts into offsets
+		 */
+		offset = 0;
+
+		for( value_index = 0;
+		     value_index < 256;
+		     value_index++ )
+		{
+			count = counts[ digit_index ][ value_index ];
+
+			counts[ digit_index ][ value_index ] = offset;
+
+			offset += count;
+		}
+		for( event_index = 0;
+		     event_index < number_of_events;
+		     event_index++ )
+		{
+			value_index = (int) ( ( source_events[ event_index ].timestamp >> bit_shift ) & 0xff );
+
+			destination_events[ counts[ digit_index ][ value_index ] ] = source_events[ event_index ];
+
+			counts[ digit_index ][ value_index ] += 1;
+		}
+		/* The destination events contain the events sorted on the digit
+		 */
+		swap_events        = source_events;
+		source_events      = destination_events;
+		destination_events = swap_events;
+	}
+	if( source_events != *events )
+	{
+		*scratch_events = *events;
+		*events         = source_events;
+	}
+}
+
+/* Sorts the events by timestamp
+ * Events with the same timestamp retain the order in which they were appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_timeline_sort(
+     libfwsi_timeline_t *timeline,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_timeline_t *internal_timeline = NULL;
+	libfwsi_timeline_event_t *events               = NULL;
+	libfwsi_timeline_event_t *scratch_events       = NULL;
+	static char *function                          = "libfwsi_timeline_sort";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libfwsi_internal_timeline_t *) timeline;
+
+	if( internal_timeline->is_sorted != 0 )
+	{
+		return( 1 );
+	}
+	if( internal_timeline->number_of_events > 1 )
+	{
+		scratch_events = (libfwsi_timeline_event_t *) memory_allocate(
+		                                               sizeof( libfwsi_timeline_event_t ) * (size_t) internal_timeline->number_of_events );
+
+		if( scratch_events == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scratch events.",
+			 function );
+
+			return( -1 );
+		}
+		events = internal_timeline->events;
+
+		libfwsi_timeline_radix_sort_events(
+		 &( internal_timeline->events ),
+		 &scratch_events,
+		 internal_timeline->number_of_events );
+
+		/* The scratch events only have space for the current number of events
+		 */
+		if( internal_timeline->events != events )
+		{
+			internal_timeline->number_of_allocated_events = internal_timeline->number_of_events;
+		}
+		memory_free(
+		 scratch_events );
+	}
+	internal_timeline->is_sorted = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of events
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_timeline_get_number_of_events(
+     libfwsi_timeline_t *timeline,
+     int *number_of_events,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_timeline_t *internal_timeline = NULL;
+	static char *function                          = "libfwsi_timeline_get_number_of_events";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libfwsi_internal_timeline_t *) timeline;
+
+	if( number_of_events == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of events.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_events = internal_timeline->number_of_events;
+
+	return( 1 );
+}
+
+/* Retrieves a specific event
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_timeline_get_event_by_index(
+     libfwsi_timeline_t *timeline,
+     int event_index,
+     uint64_t *timestamp,
+     uint8_t *kind,
+     int *list_identifier,
+     int *item_index,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_timeline_t *internal_timeline = NULL;
+	libfwsi_timeline_event_t *event                = NULL;
+	static char *function                          = "libfwsi_timeline_get_event_by_index";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libfwsi_internal_timeline_t *) timeline;
+
+	if( ( event_index < 0 )
+	 || ( event_index >= internal_timeline->number_of_events ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid event index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( kind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid kind.",
+		 function );
+
+		return( -1 );
+	}
+	if( list_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid list identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item index.",
+		 function );
+
+		return( -1 );
+	}
+	event = &( internal_timeline->events[ event_index ] );
+
+	*timestamp       = event->timestamp;
+	*kind            = event->kind;
+	*list_identifier = event->list_identifier;
+	*item_index      = event->item_index;
+
+	return( 1 );
+}
+
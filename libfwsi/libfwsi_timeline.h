@@ -0,0 +1,135 @@
+/*
+ * Timeline functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFWSI_TIMELINE_H )
+#define _LIBFWSI_TIMELINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_timeline_event libfwsi_timeline_event_t;
+
+struct libfwsi_timeline_event
+{
+	/* The timestamp, as a FILETIME
+	 */
+	uint64_t timestamp;
+
+	/* The list identifier
+	 */
+	int list_identifier;
+
+	/* The index of the item in the list
+	 */
+	int item_index;
+
+	/* The event kind
+	 */
+	uint8_t kind;
+};
+
+typedef struct libfwsi_internal_timeline libfwsi_internal_timeline_t;
+
+struct libfwsi_internal_timeline
+{
+	/* The events
+	 */
+	libfwsi_timeline_event_t *events;
+
+	/* The number of events
+	 */
+	int number_of_events;
+
+	/* The number of allocated events
+	 */
+	int number_of_allocated_events;
+
+	/* Value to indicate the events are sorted
+	 */
+	uint8_t is_sorted;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_initialize(
+     libfwsi_timeline_t **timeline,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_free(
+     libfwsi_timeline_t **timeline,
+     libcerror_error_t **error );
+
+int libfwsi_internal_timeline_append_event(
+     libfwsi_internal_timeline_t *internal_timeline,
+     uint32_t fat_date_time,
+     uint8_t kind,
+     int list_identifier,
+     int item_index,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_append_item_list(
+     libfwsi_timeline_t *timeline,
+     libfwsi_item_list_t *item_list,
+     int list_identifier,
+     libcerror_error_t **error );
+
+void libfwsi_timeline_radix_sort_events(
+      libfwsi_timeline_event_t **events,
+      libfwsi_timeline_event_t **scratch_events,
+      int number_of_events );
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_sort(
+     libfwsi_timeline_t *timeline,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_get_number_of_events(
+     libfwsi_timeline_t *timeline,
+     int *number_of_events,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_get_event_by_index(
+     libfwsi_timeline_t *timeline,
+     int event_index,
+     uint64_t *timestamp,
+     uint8_t *kind,
+     int *list_identifier,
+     int *item_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_TIMELINE_H ) */
+
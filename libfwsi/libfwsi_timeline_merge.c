@@ -0,0 +1,519 @@
+/*
+ * Timeline merge functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_allocator.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_timeline.h"
+#include "libfwsi_timeline_merge.h"
+#include "libfwsi_types.h"
+
+/* Creates a timeline merge
+ * Make sure the value timeline_merge is referencing, is set to NULL
+ * The timelines must be sorted and must not be changed or freed while they are merged
+ * The number of events of each timeline is retained to detect a timeline that was changed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_timeline_merge_initialize(
+     libfwsi_timeline_merge_t **timeline_merge,
+     libfwsi_timeline_t **timelines,
+     int number_of_timelines,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_timeline_t *internal_timeline             = NULL;
+	libfwsi_internal_timeline_merge_t *internal_timeline_merge = NULL;
+	static char *function                                      = "libfwsi_timeline_merge_initialize";
+	int heap_index                                             = 0;
+	int timeline_index                                         = 0;
+
+	if( timeline_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_merge != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline merge value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( timelines == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timelines.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_timelines <= 0 )
+	 || ( (size_t) number_of_timelines > ( (size_t) SSIZE_MAX / sizeof( libfwsi_internal_timeline_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of timelines value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( timeline_index = 0;
+	     timeline_index < number_of_timelines;
+	     timeline_index++ )
+	{
+		internal_timeline = (libfwsi_internal_timeline_t *) timelines[ timeline_index ];
+
+		if( internal_timeline == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid timeline: %d.",
+			 function,
+			 timeline_index );
+
+			return( -1 );
+		}
+		if( internal_timeline->is_sorted == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timeline: %d - events are not sorted.",
+			 function,
+			 timeline_index );
+
+			return( -1 );
+		}
+	}
+	internal_timeline_merge = memory_allocate_structure(
+	                           libfwsi_internal_timeline_merge_t );
+
+	if( internal_timeline_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline merge.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_timeline_merge,
+	     0,
+	     sizeof( libfwsi_internal_timeline_merge_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline merge.",
+		 function );
+
+		memory_free(
+		 internal_timeline_merge );
+
+		return( -1 );
+	}
+	internal_timeline_merge->timelines = (libfwsi_internal_timeline_t **) memory_allocate(
+	                                                                        sizeof( libfwsi_internal_timeline_t * ) * (size_t) number_of_timelines );
+
+	if( internal_timeline_merge->timelines == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timelines.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_merge->numbers_of_events = (int *) memory_allocate(
+	                                                      sizeof( int ) * (size_t) number_of_timelines );
+
+	if( internal_timeline_merge->numbers_of_events == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create numbers of events.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_merge->event_indexes = (int *) memory_allocate(
+	                                                  sizeof( int ) * (size_t) number_of_timelines );
+
+	if( internal_timeline_merge->event_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create event indexes.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_merge->heap = (int *) memory_allocate(
+	                                         sizeof( int ) * (size_t) number_of_timelines );
+
+	if( internal_timeline_merge->heap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create heap.",
+		 function );
+
+		goto on_error;
+	}
+	internal_timeline_merge->number_of_timelines = number_of_timelines;
+
+	for( timeline_index = 0;
+	     timeline_index < number_of_timelines;
+	     timeline_index++ )
+	{
+		internal_timeline = (libfwsi_internal_timeline_t *) timelines[ timeline_index ];
+
+		internal_timeline_merge->timelines[ timeline_index ]         = internal_timeline;
+		internal_timeline_merge->numbers_of_events[ timeline_index ] = internal_timeline->number_of_events;
+		internal_timeline_merge->event_indexes[ timeline_index ]     = 0;
+
+		if( internal_timeline->number_of_events > 0 )
+		{
+			internal_timeline_merge->heap[ internal_timeline_merge->heap_size ] = timeline_index;
+
+			internal_timeline_merge->heap_size += 1;
+		}
+	}
+	for( heap_index = ( internal_timeline_merge->heap_size / 2 ) - 1;
+	     heap_index >= 0;
+	     heap_index-- )
+	{
+		libfwsi_internal_timeline_merge_sift_down(
+		 internal_timeline_merge,
+		 heap_index );
+	}
+	*timeline_merge = (libfwsi_timeline_merge_t *) internal_timeline_merge;
+
+	return( 1 );
+
+on_error:
+	if( internal_timeline_merge != NULL )
+	{
+		if( internal_timeline_merge->event_indexes != NULL )
+		{
+			memory_free(
+			 internal_timeline_merge->event_indexes );
+		}
+		if( internal_timeline_merge->numbers_of_events != NULL )
+		{
+			memory_free(
+			 internal_timeline_merge->numbers_of_events );
+		}
+		if( internal_timeline_merge->timelines != NULL )
+		{
+			memory_free(
+			 internal_timeline_merge->timelines );
+		}
+		memory_free(
+		 internal_timeline_merge );
+	}
+	return( -1 );
+}
+
+/* Frees a timeline merge
+ * The timelines are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_timeline_merge_free(
+     libfwsi_timeline_merge_t **timeline_merge,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_timeline_merge_t *internal_timeline_merge = NULL;
+	static char *function                                      = "libfwsi_timeline_merge_free";
+
+	if( timeline_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline_merge != NULL )
+	{
+		internal_timeline_merge = (libfwsi_internal_timeline_merge_t *) *timeline_merge;
+		*timeline_merge         = NULL;
+
+		if( internal_timeline_merge->heap != NULL )
+		{
+			memory_free(
+			 internal_timeline_merge->heap );
+		}
+		if( internal_timeline_merge->event_indexes != NULL )
+		{
+			memory_free(
+			 internal_timeline_merge->event_indexes );
+		}
+		if( internal_timeline_merge->numbers_of_events != NULL )
+		{
+			memory_free(
+			 internal_timeline_merge->numbers_of_events );
+		}
+		if( internal_timeline_merge->timelines != NULL )
+		{
+			memory_free(
+			 internal_timeline_merge->timelines );
+		}
+		memory_free(
+		 internal_timeline_merge );
+	}
+	return( 1 );
+}
+
+/* Compares the next events of two timelines
+ * Events with the same timestamp are ordered by the index of their timeline
+ * Returns 1 if the next event of the first timeline comes before that of the second timeline or 0 if not
+ */
+int libfwsi_internal_timeline_merge_compare(
+     libfwsi_internal_timeline_merge_t *internal_timeline_merge,
+     int first_timeline_index,
+     int second_timeline_index )
+{
+	uint64_t first_timestamp  = 0;
+	uint64_t second_timestamp = 0;
+
+	first_timestamp = internal_timeline_merge->timelines[ first_timeline_index ]->events[ internal_timeline_merge->event_indexes[ first_timeline_index ] ].timestamp;
+
+	second_timestamp = internal_timeline_merge->timelines[ second_timeline_index ]->events[ internal_timeline_merge->event_indexes[ second_timeline_index ] ].timestamp;
+
+	if( first_timestamp != second_timestamp )
+	{
+		return( first_timestamp < second_timestamp );
+	}
+	return( first_timeline_index < second_timeline_index );
+}
+
+/* Moves a timeline in the heap down until the heap is ordered
+ */
+void libfwsi_internal_timeline_merge_sift_down(
+      libfwsi_internal_timeline_merge_t *internal_timeline_merge,
+      int heap_index )
+{
+	int child_heap_index = 0;
+	int timeline_index   = 0;
+
+	timeline_index = internal_timeline_merge->heap[ heap_index ];
+
+	for( ;; )
+	{
+		child_heap_index = ( heap_index * 2 ) + 1;
+
+		if( child_heap_index >= internal_timeline_merge->heap_size )
+		{
+			break;
+		}
+		if( ( ( child_heap_index + 1 ) < internal_timeline_merge->heap_size )
+		 && ( libfwsi_internal_timeline_merge_compare(
+		       internal_timeline_merge,
+		       internal_timeline_merge->heap[ child_heap_index + 1 ],
+		       internal_timeline_merge->heap[ child_heap_index ] ) != 0 ) )
+		{
+			child_heap_index++;
+		}
+		if( libfwsi_internal_timeline_merge_compare(
+		     internal_timeline_merge,
+		     internal_timeline_merge->heap[ child_heap_index ],
+		     timeline_index ) == 0 )
+		{
+			break;
+		}
+		internal_timeline_merge->heap[ heap_index ] = internal_timeline_merge->heap[ child_heap_index ];
+
+		heap_index = child_heap_index;
+	}
+	internal_timeline_merge->heap[ heap_index ] = timeline_index;
+}
+
+/* Retrieves the next event in order of timestamp
+ * Events with the same timestamp are returned in order of the timelines
+ * A timeline with remaining events that is no longer sorted or of which the number
+ * of events changed since the merge was created is considered an error
+ * Returns 1 if successful, 0 if no more events or -1 on error
+ */
+int libfwsi_timeline_merge_get_next_event(
+     libfwsi_timeline_merge_t *timeline_merge,
+     uint64_t *timestamp,
+     uint8_t *kind,
+     int *list_identifier,
+     int *item_index,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_timeline_t *internal_timeline             = NULL;
+	libfwsi_internal_timeline_merge_t *internal_timeline_merge = NULL;
+	libfwsi_timeline_event_t *event                            = NULL;
+	static char *function                                      = "libfwsi_timeline_merge_get_next_event";
+	int heap_index                                             = 0;
+	int timeline_index                                         = 0;
+
+	if( timeline_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline merge.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline_merge = (libfwsi_internal_timeline_merge_t *) timeline_merge;
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( kind == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid kind.",
+		 function );
+
+		return( -1 );
+	}
+	if( list_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid list identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline_merge->heap_size == 0 )
+	{
+		return( 0 );
+	}
+	/* The events of the timelines in the heap are read when the heap is reordered
+	 */
+	for( heap_index = 0;
+	     heap_index < internal_timeline_merge->heap_size;
+	     heap_index++ )
+	{
+		timeline_index    = internal_timeline_merge->heap[ heap_index ];
+		internal_timeline = internal_timeline_merge->timelines[ timeline_index ];
+
+		if( ( internal_timeline->is_sorted == 0 )
+		 || ( internal_timeline->number_of_events != internal_timeline_merge->numbers_of_events[ timeline_index ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported timeline: %d - events were changed while merged.",
+			 function,
+			 timeline_index );
+
+			return( -1 );
+		}
+	}
+	timeline_index    = internal_timeline_merge->heap[ 0 ];
+	internal_timeline = internal_timeline_merge->timelines[ timeline_index ];
+
+	event = &( internal_timeline->events[ internal_timeline_merge->event_indexes[ timeline_index ] ] );
+
+	*timestamp       = event->timestamp;
+	*kind            = event->kind;
+	*list_identifier = event->list_identifier;
+	*item_index      = event->item_index;
+
+	internal_timeline_merge->event_indexes[ timeline_index ] += 1;
+
+	/* Remove the timeline from the heap when all its events have been returned
+	 */
+	if( internal_timeline_merge->event_indexes[ timeline_index ] >= internal_timeline_merge->numbers_of_events[ timeline_index ] )
+	{
+		internal_timeline_merge->heap_size -= 1;
+
+		internal_timeline_merge->heap[ 0 ] = internal_timeline_merge->heap[ internal_timeline_merge->heap_size ];
+	}
+	if( internal_timeline_merge->heap_size > 1 )
+	{
+		libfwsi_internal_timeline_merge_sift_down(
+		 internal_timeline_merge,
+		 0 );
+	}
+	return( 1 );
+}
+
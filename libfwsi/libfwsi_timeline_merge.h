@@ -0,0 +1,103 @@
+/*
+ * Timeline merge functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFWSI_TIMELINE_MERGE_H )
+#define _LIBFWSI_TIMELINE_MERGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_timeline.h"
+#include "libfwsi_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwsi_internal_timeline_merge libfwsi_internal_timeline_merge_t;
+
+struct libfwsi_internal_timeline_merge
+{
+	/* The timelines (runs)
+	 */
+	libfwsi_internal_timeline_t **timelines;
+
+	/* The number of timelines
+	 */
+	int number_of_timelines;
+
+	/* The number of events of each timeline when the merge was created
+	 */
+	int *numbers_of_events;
+
+	/* The index of the next event of each timeline
+	 */
+	int *event_indexes;
+
+	/* The binary min-heap of the indexes of the timelines with remaining events,
+	 * ordered by the timestamp of their next event and the timeline index
+	 */
+	int *heap;
+
+	/* The number of timelines in the heap
+	 */
+	int heap_size;
+};
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_merge_initialize(
+     libfwsi_timeline_merge_t **timeline_merge,
+     libfwsi_timeline_t **timelines,
+     int number_of_timelines,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_merge_free(
+     libfwsi_timeline_merge_t **timeline_merge,
+     libcerror_error_t **error );
+
+int libfwsi_internal_timeline_merge_compare(
+     libfwsi_internal_timeline_merge_t *internal_timeline_merge,
+     int first_timeline_index,
+     int second_timeline_index );
+
+void libfwsi_internal_timeline_merge_sift_down(
+      libfwsi_internal_timeline_merge_t *internal_timeline_merge,
+      int heap_index );
+
+LIBFWSI_EXTERN \
+int libfwsi_timeline_merge_get_next_event(
+     libfwsi_timeline_merge_t *timeline_merge,
+     uint64_t *timestamp,
+     uint8_t *kind,
+     int *list_identifier,
+     int *item_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_TIMELINE_MERGE_H ) */
+
@@ -34,14 +34,32 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfwsi_carver {}		libfwsi_carver_t;
 typedef struct libfwsi_extension_block {}	libfwsi_extension_block_t;
+typedef struct libfwsi_file_reference_index {}	libfwsi_file_reference_index_t;
+typedef struct libfwsi_filter {}			libfwsi_filter_t;
 typedef struct libfwsi_item {}			libfwsi_item_t;
 typedef struct libfwsi_item_list {}		libfwsi_item_list_t;
+typedef struct libfwsi_item_list_parser {}	libfwsi_item_list_parser_t;
+typedef struct libfwsi_item_list_view {}	libfwsi_item_list_view_t;
+typedef struct libfwsi_name_search {}		libfwsi_name_search_t;
+typedef struct libfwsi_parse_options {}		libfwsi_parse_options_t;
+typedef struct libfwsi_timeline {}		libfwsi_timeline_t;
+typedef struct libfwsi_timeline_merge {}	libfwsi_timeline_merge_t;
 
 #else
+typedef intptr_t libfwsi_carver_t;
 typedef intptr_t libfwsi_extension_block_t;
+typedef intptr_t libfwsi_file_reference_index_t;
+typedef intptr_t libfwsi_filter_t;
 typedef intptr_t libfwsi_item_t;
 typedef intptr_t libfwsi_item_list_t;
+typedef intptr_t libfwsi_item_list_parser_t;
+typedef intptr_t libfwsi_item_list_view_t;
+typedef intptr_t libfwsi_name_search_t;
+typedef intptr_t libfwsi_parse_options_t;
+typedef intptr_t libfwsi_timeline_t;
+typedef intptr_t libfwsi_timeline_merge_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_file_attributes.h"
 #include "libfwsi_libcerror.h"
@@ -136,6 +137,8 @@ int libfwsi_unknown_0x74_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER )
+
 /* Reads the unknown 0x74 values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -463,3 +466,5 @@ int libfwsi_unknown_0x74_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER ) */
+
@@ -48,6 +48,8 @@ int libfwsi_unknown_0x74_values_free(
      libfwsi_unknown_0x74_values_t **unknown_0x74_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER )
+
 int libfwsi_unknown_0x74_values_read_data(
      libfwsi_unknown_0x74_values_t *unknown_0x74_values,
      const uint8_t *data,
@@ -55,6 +57,8 @@ int libfwsi_unknown_0x74_values_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,781 @@
+/*
+ * URI (shell item) functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_definitions.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
+#include "libfwsi_uri.h"
+#include "libfwsi_uri_values.h"
+#include "libfwsi_values_type.h"
+
+/* Retrieves the URI values of an URI item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_uri_get_values(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_uri_values_t **uri_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_uri_get_values";
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( uri_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URI values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The values type is checked as well since URI sub items
+	 * share the URI item type
+	 */
+	if( ( internal_item->type != LIBFWSI_ITEM_TYPE_URI )
+	 || ( internal_item->values_type != LIBFWSI_VALUES_TYPE_URI ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	*uri_values = (libfwsi_uri_values_t *) internal_item->value;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 formatted URI
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_uri_get_utf8_uri_size(
+     libfwsi_item_t *item,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_uri_values_t *uri_values       = NULL;
+	static char *function                  = "libfwsi_uri_get_utf8_uri_size";
+	int result                             = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_uri_get_values(
+	     internal_item,
+	     &uri_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve URI values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uri_values->string_data == NULL )
+	 || ( uri_values->uri_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( uri_values->flags & 0x80 ) != 0 )
+	{
+		result = libuna_utf8_string_size_from_utf16_stream(
+		          &( uri_values->string_data[ uri_values->uri_offset ] ),
+		          uri_values->uri_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_string_utf8_size_from_byte_stream(
+		          &( uri_values->string_data[ uri_values->uri_offset ] ),
+		          uri_values->uri_size,
+		          internal_item->ascii_codepage,
+		          utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted URI
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_uri_get_utf8_uri(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_uri_values_t *uri_values       = NULL;
+	static char *function                  = "libfwsi_uri_get_utf8_uri";
+	int result                             = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_uri_get_values(
+	     internal_item,
+	     &uri_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve URI values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uri_values->string_data == NULL )
+	 || ( uri_values->uri_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( uri_values->flags & 0x80 ) != 0 )
+	{
+		result = libuna_utf8_string_copy_from_utf16_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          &( uri_values->string_data[ uri_values->uri_offset ] ),
+		          uri_values->uri_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_string_utf8_copy_from_byte_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          &( uri_values->string_data[ uri_values->uri_offset ] ),
+		          uri_values->uri_size,
+		          internal_item->ascii_codepage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 formatted URI
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_uri_get_utf16_uri_size(
+     libfwsi_item_t *item,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_uri_values_t *uri_values       = NULL;
+	static char *function                  = "libfwsi_uri_get_utf16_uri_size";
+	int result                             = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_uri_get_values(
+	     internal_item,
+	     &uri_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve URI values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uri_values->string_data == NULL )
+	 || ( uri_values->uri_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( uri_values->flags & 0x80 ) != 0 )
+	{
+		result = libuna_utf16_string_size_from_utf16_stream(
+		          &( uri_values->string_data[ uri_values->uri_offset ] ),
+		          uri_values->uri_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_string_utf16_size_from_byte_stream(
+		          &( uri_values->string_data[ uri_values->uri_offset ] ),
+		          uri_values->uri_size,
+		          internal_item->ascii_codepage,
+		          utf16_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 formatted URI
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_uri_get_utf16_uri(
+     libfwsi_item_t *item,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_uri_values_t *uri_values       = NULL;
+	static char *function                  = "libfwsi_uri_get_utf16_uri";
+	int result                             = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_uri_get_values(
+	     internal_item,
+	     &uri_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve URI values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uri_values->string_data == NULL )
+	 || ( uri_values->uri_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( uri_values->flags & 0x80 ) != 0 )
+	{
+		result = libuna_utf16_string_copy_from_utf16_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          &( uri_values->string_data[ uri_values->uri_offset ] ),
+		          uri_values->uri_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_string_utf16_copy_from_byte_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          &( uri_values->string_data[ uri_values->uri_offset ] ),
+		          uri_values->uri_size,
+		          internal_item->ascii_codepage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 formatted string
+ * The strings are the length-prefixed strings that precede the URI, such as the FTP user name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_uri_get_utf8_string_size(
+     libfwsi_item_t *item,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_uri_values_t *uri_values       = NULL;
+	static char *function                  = "libfwsi_uri_get_utf8_string_size";
+	int result                             = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_uri_get_values(
+	     internal_item,
+	     &uri_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve URI values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= LIBFWSI_URI_VALUES_NUMBER_OF_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uri_values->string_data == NULL )
+	 || ( uri_values->string_size[ string_index ] == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( uri_values->flags & 0x80 ) != 0 )
+	{
+		result = libuna_utf8_string_size_from_utf16_stream(
+		          &( uri_values->string_data[ uri_values->string_offset[ string_index ] ] ),
+		          uri_values->string_size[ string_index ],
+		          LIBUNA_ENDIAN_LITTLE,
+		          utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_string_utf8_size_from_byte_stream(
+		          &( uri_values->string_data[ uri_values->string_offset[ string_index ] ] ),
+		          uri_values->string_size[ string_index ],
+		          internal_item->ascii_codepage,
+		          utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 formatted string
+ * The strings are the length-prefixed strings that precede the URI, such as the FTP user name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_uri_get_utf8_string(
+     libfwsi_item_t *item,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_uri_values_t *uri_values       = NULL;
+	static char *function                  = "libfwsi_uri_get_utf8_string";
+	int result                             = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_uri_get_values(
+	     internal_item,
+	     &uri_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve URI values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= LIBFWSI_URI_VALUES_NUMBER_OF_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uri_values->string_data == NULL )
+	 || ( uri_values->string_size[ string_index ] == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( uri_values->flags & 0x80 ) != 0 )
+	{
+		result = libuna_utf8_string_copy_from_utf16_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          &( uri_values->string_data[ uri_values->string_offset[ string_index ] ] ),
+		          uri_values->string_size[ string_index ],
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_string_utf8_copy_from_byte_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          &( uri_values->string_data[ uri_values->string_offset[ string_index ] ] ),
+		          uri_values->string_size[ string_index ],
+		          internal_item->ascii_codepage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 formatted string
+ * The strings are the length-prefixed strings that precede the URI, such as the FTP user name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_uri_get_utf16_string_size(
+     libfwsi_item_t *item,
+     int string_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_uri_values_t *uri_values       = NULL;
+	static char *function                  = "libfwsi_uri_get_utf16_string_size";
+	int result                             = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_uri_get_values(
+	     internal_item,
+	     &uri_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve URI values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= LIBFWSI_URI_VALUES_NUMBER_OF_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uri_values->string_data == NULL )
+	 || ( uri_values->string_size[ string_index ] == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( uri_values->flags & 0x80 ) != 0 )
+	{
+		result = libuna_utf16_string_size_from_utf16_stream(
+		          &( uri_values->string_data[ uri_values->string_offset[ string_index ] ] ),
+		          uri_values->string_size[ string_index ],
+		          LIBUNA_ENDIAN_LITTLE,
+		          utf16_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_string_utf16_size_from_byte_stream(
+		          &( uri_values->string_data[ uri_values->string_offset[ string_index ] ] ),
+		          uri_values->string_size[ string_index ],
+		          internal_item->ascii_codepage,
+		          utf16_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 formatted string
+ * The strings are the length-prefixed strings that precede the URI, such as the FTP user name
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_uri_get_utf16_string(
+     libfwsi_item_t *item,
+     int string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwsi_internal_item_t *internal_item = NULL;
+	libfwsi_uri_values_t *uri_values       = NULL;
+	static char *function                  = "libfwsi_uri_get_utf16_string";
+	int result                             = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libfwsi_internal_item_t *) item;
+
+	if( libfwsi_uri_get_values(
+	     internal_item,
+	     &uri_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve URI values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= LIBFWSI_URI_VALUES_NUMBER_OF_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uri_values->string_data == NULL )
+	 || ( uri_values->string_size[ string_index ] == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( uri_values->flags & 0x80 ) != 0 )
+	{
+		result = libuna_utf16_string_copy_from_utf16_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          &( uri_values->string_data[ uri_values->string_offset[ string_index ] ] ),
+		          uri_values->string_size[ string_index ],
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
+	}
+	else
+	{
+		result = libfwsi_string_utf16_copy_from_byte_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          &( uri_values->string_data[ uri_values->string_offset[ string_index ] ] ),
+		          uri_values->string_size[ string_index ],
+		          internal_item->ascii_codepage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,104 @@
+/*
+ * URI (shell item) functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_URI_H )
+#define _LIBFWSI_URI_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+#include "libfwsi_uri_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfwsi_uri_get_values(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_uri_values_t **uri_values,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_uri_get_utf8_uri_size(
+     libfwsi_item_t *item,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_uri_get_utf8_uri(
+     libfwsi_item_t *item,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_uri_get_utf16_uri_size(
+     libfwsi_item_t *item,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_uri_get_utf16_uri(
+     libfwsi_item_t *item,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_uri_get_utf8_string_size(
+     libfwsi_item_t *item,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_uri_get_utf8_string(
+     libfwsi_item_t *item,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_uri_get_utf16_string_size(
+     libfwsi_item_t *item,
+     int string_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_uri_get_utf16_string(
+     libfwsi_item_t *item,
+     int string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_URI_H ) */
+
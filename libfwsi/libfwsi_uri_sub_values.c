@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
@@ -133,6 +134,8 @@ int libfwsi_uri_sub_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
 /* Reads the URI sub values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -297,3 +300,5 @@ int libfwsi_uri_sub_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
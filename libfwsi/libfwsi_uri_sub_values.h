@@ -48,6 +48,8 @@ int libfwsi_uri_sub_values_free(
      libfwsi_uri_sub_values_t **uri_sub_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
 int libfwsi_uri_sub_values_read_data(
      libfwsi_uri_sub_values_t *uri_sub_values,
      const uint8_t *data,
@@ -55,6 +57,8 @@ int libfwsi_uri_sub_values_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
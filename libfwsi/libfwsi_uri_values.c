@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
@@ -126,6 +127,11 @@ int libfwsi_uri_values_free(
 	}
 	if( *uri_values != NULL )
 	{
+		if( ( *uri_values )->string_data != NULL )
+		{
+			memory_free(
+			 ( *uri_values )->string_data );
+		}
 		memory_free(
 		 *uri_values );
 
@@ -134,6 +140,8 @@ int libfwsi_uri_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
 /* Reads the URI values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -146,10 +154,12 @@ int libfwsi_uri_values_read_data(
 {
 	static char *function     = "libfwsi_uri_values_read_data";
 	size_t data_offset        = 0;
+	size_t string_data_offset = 0;
 	size_t string_size        = 0;
 	uint32_t string_data_size = 0;
 	uint16_t item_data_size   = 0;
 	uint8_t flags             = 0;
+	int string_index          = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t value_32bit      = 0;
@@ -167,6 +177,17 @@ int libfwsi_uri_values_read_data(
 
 		return( -1 );
 	}
+	if( uri_values->string_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid URI values - string data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -225,7 +246,7 @@ int libfwsi_uri_values_read_data(
 
 	if( item_data_size > 0 )
 	{
-		if( item_data_size > ( data_size - 4 ) )
+		if( item_data_size > ( data_size - 6 ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -256,6 +277,15 @@ int libfwsi_uri_values_read_data(
 		 "\n" );
 	}
 #endif
+	/* Without item data the URI is preceded by 2 bytes that contain 0-byte values
+	 */
+	if( ( item_data_size == 0 )
+	 && ( ( data_size - data_offset ) >= 4 )
+	 && ( data[ data_offset ] == 0 )
+	 && ( data[ data_offset + 1 ] == 0 ) )
+	{
+		data_offset += 2;
+	}
 	if( item_data_size >= 40 )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -323,6 +353,8 @@ int libfwsi_uri_values_read_data(
 		data_offset    += 36;
 		item_data_size -= 36;
 
+		string_data_offset = data_offset + 4;
+
 		byte_stream_copy_to_uint32_little_endian(
 		 &( data[ data_offset ] ),
 		 string_data_size );
@@ -341,6 +373,9 @@ int libfwsi_uri_values_read_data(
 
 			return( -1 );
 		}
+		uri_values->string_offset[ 0 ] = data_offset;
+		uri_values->string_size[ 0 ]   = (size_t) string_data_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -361,6 +396,17 @@ int libfwsi_uri_values_read_data(
 		data_offset    += string_data_size;
 		item_data_size -= string_data_size;
 
+		if( item_data_size < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string2 data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 		byte_stream_copy_to_uint32_little_endian(
 		 &( data[ data_offset ] ),
 		 string_data_size );
@@ -379,6 +425,9 @@ int libfwsi_uri_values_read_data(
 
 			return( -1 );
 		}
+		uri_values->string_offset[ 1 ] = data_offset;
+		uri_values->string_size[ 1 ]   = (size_t) string_data_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -399,6 +448,17 @@ int libfwsi_uri_values_read_data(
 		data_offset    += string_data_size;
 		item_data_size -= string_data_size;
 
+		if( item_data_size < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string3 data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 		byte_stream_copy_to_uint32_little_endian(
 		 &( data[ data_offset ] ),
 		 string_data_size );
@@ -417,6 +477,9 @@ int libfwsi_uri_values_read_data(
 
 			return( -1 );
 		}
+		uri_values->string_offset[ 2 ] = data_offset;
+		uri_values->string_size[ 2 ]   = (size_t) string_data_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -457,6 +520,12 @@ int libfwsi_uri_values_read_data(
 #endif
 		data_offset += item_data_size;
 	}
+	if( string_data_offset == 0 )
+	{
+		string_data_offset = data_offset;
+	}
+	uri_values->flags = flags;
+
 	/* Determine the URI size
 	 */
 	if( ( flags & 0x80 ) != 0 )
@@ -535,8 +604,62 @@ int libfwsi_uri_values_read_data(
 		}
 	}
 #endif
+	uri_values->uri_offset = data_offset;
+	uri_values->uri_size   = string_size;
+
 	data_offset += string_size;
 
+	/* Retain a single copy of the data containing the strings,
+	 * the strings are converted from their spans on demand
+	 */
+	if( data_offset > string_data_offset )
+	{
+		uri_values->string_data_size = data_offset - string_data_offset;
+
+		uri_values->string_data = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * uri_values->string_data_size );
+
+		if( uri_values->string_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     uri_values->string_data,
+		     &( data[ string_data_offset ] ),
+		     uri_values->string_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string data.",
+			 function );
+
+			goto on_error;
+		}
+		for( string_index = 0;
+		     string_index < LIBFWSI_URI_VALUES_NUMBER_OF_STRINGS;
+		     string_index++ )
+		{
+			if( uri_values->string_size[ string_index ] > 0 )
+			{
+				uri_values->string_offset[ string_index ] -= string_data_offset;
+			}
+		}
+		uri_values->uri_offset -= string_data_offset;
+	}
+	else
+	{
+		uri_values->uri_offset = 0;
+		uri_values->uri_size   = 0;
+	}
 /* TODO value likely controlled by flags */
 	if( data_offset < data_size )
 	{
@@ -563,5 +686,19 @@ int libfwsi_uri_values_read_data(
 	}
 #endif
 	return( 1 );
+
+on_error:
+	if( uri_values->string_data != NULL )
+	{
+		memory_free(
+		 uri_values->string_data );
+
+		uri_values->string_data = NULL;
+	}
+	uri_values->string_data_size = 0;
+
+	return( -1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
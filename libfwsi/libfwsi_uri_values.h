@@ -31,13 +31,41 @@
 extern "C" {
 #endif
 
+/* The number of length-prefixed strings in the URI data
+ */
+#define LIBFWSI_URI_VALUES_NUMBER_OF_STRINGS	3
+
 typedef struct libfwsi_uri_values libfwsi_uri_values_t;
 
 struct libfwsi_uri_values
 {
-	/* Dummy
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The string data, which contains the length-prefixed strings and the URI
+	 */
+	uint8_t *string_data;
+
+	/* The string data size
+	 */
+	size_t string_data_size;
+
+	/* The offsets of the length-prefixed strings relative to the start of the string data
 	 */
-	int dummy;
+	size_t string_offset[ LIBFWSI_URI_VALUES_NUMBER_OF_STRINGS ];
+
+	/* The sizes of the length-prefixed strings
+	 */
+	size_t string_size[ LIBFWSI_URI_VALUES_NUMBER_OF_STRINGS ];
+
+	/* The offset of the URI relative to the start of the string data
+	 */
+	size_t uri_offset;
+
+	/* The URI size
+	 */
+	size_t uri_size;
 };
 
 int libfwsi_uri_values_initialize(
@@ -48,6 +76,8 @@ int libfwsi_uri_values_free(
      libfwsi_uri_values_t **uri_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
 int libfwsi_uri_values_read_data(
      libfwsi_uri_values_t *uri_values,
      const uint8_t *data,
@@ -55,6 +85,8 @@ int libfwsi_uri_values_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
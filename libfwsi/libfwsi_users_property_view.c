@@ -0,0 +1,377 @@
+/*
+ * Users property view (shell item) functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwsi_definitions.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_libfwps.h"
+#include "libfwsi_users_property_view.h"
+#include "libfwsi_users_property_view_values.h"
+
+/* Retrieves the users property view values of an users property view item
+ * Returns 1 if successful or -1 on error
+ */
+int libfwsi_users_property_view_get_values(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_users_property_view_values_t **users_property_view_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwsi_users_property_view_get_values";
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( users_property_view_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid users property view values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->type != LIBFWSI_ITEM_TYPE_USERS_PROPERTY_VIEW )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item - missing value.",
+		 function );
+
+		return( -1 );
+	}
+	*users_property_view_values = (libfwsi_users_property_view_values_t *) internal_item->value;
+
+	return( 1 );
+}
+
+/* Retrieves the known folder identifier
+ * The identifier is a GUID and is 16 bytes of size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_users_property_view_get_known_folder_identifier(
+     libfwsi_item_t *item,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_users_property_view_values_t *users_property_view_values = NULL;
+	static char *function                                            = "libfwsi_users_property_view_get_known_folder_identifier";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_users_property_view_get_values(
+	     (libfwsi_internal_item_t *) item,
+	     &users_property_view_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve users property view values.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: GUID data size too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( users_property_view_values->has_known_folder_identifier == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     users_property_view_values->known_folder_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy known folder identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the property store data size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_users_property_view_get_property_store_data_size(
+     libfwsi_item_t *item,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_users_property_view_values_t *users_property_view_values = NULL;
+	static char *function                                            = "libfwsi_users_property_view_get_property_store_data_size";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_users_property_view_get_values(
+	     (libfwsi_internal_item_t *) item,
+	     &users_property_view_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve users property view values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( users_property_view_values->property_store_data == NULL )
+	{
+		return( 0 );
+	}
+	*data_size = users_property_view_values->property_store_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the property store data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_users_property_view_get_property_store_data(
+     libfwsi_item_t *item,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwsi_users_property_view_values_t *users_property_view_values = NULL;
+	static char *function                                            = "libfwsi_users_property_view_get_property_store_data";
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_users_property_view_get_values(
+	     (libfwsi_internal_item_t *) item,
+	     &users_property_view_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve users property view values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( users_property_view_values->property_store_data == NULL )
+	{
+		return( 0 );
+	}
+	if( data_size < users_property_view_values->property_store_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     users_property_view_values->property_store_data,
+	     users_property_view_values->property_store_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy property store data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the property storage
+ * The property storage is a libfwps storage that is created on the first call
+ * and is managed by the users property view item, hence it must not be freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_users_property_view_get_property_storage(
+     libfwsi_item_t *item,
+     intptr_t **property_storage,
+     libcerror_error_t **error )
+{
+	libfwsi_users_property_view_values_t *users_property_view_values = NULL;
+	static char *function                                            = "libfwsi_users_property_view_get_property_storage";
+	int result                                                       = 0;
+
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwsi_users_property_view_get_values(
+	     (libfwsi_internal_item_t *) item,
+	     &users_property_view_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve users property view values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwsi_users_property_view_values_get_property_storage(
+	          users_property_view_values,
+	          (libfwps_storage_t **) property_storage,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve property storage.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,74 @@
+/*
+ * Users property view (shell item) functions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_USERS_PROPERTY_VIEW_H )
+#define _LIBFWSI_USERS_PROPERTY_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwsi_extern.h"
+#include "libfwsi_item.h"
+#include "libfwsi_libcerror.h"
+#include "libfwsi_types.h"
+#include "libfwsi_users_property_view_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfwsi_users_property_view_get_values(
+     libfwsi_internal_item_t *internal_item,
+     libfwsi_users_property_view_values_t **users_property_view_values,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_users_property_view_get_known_folder_identifier(
+     libfwsi_item_t *item,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_users_property_view_get_property_store_data_size(
+     libfwsi_item_t *item,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_users_property_view_get_property_store_data(
+     libfwsi_item_t *item,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFWSI_EXTERN \
+int libfwsi_users_property_view_get_property_storage(
+     libfwsi_item_t *item,
+     intptr_t **property_storage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWSI_USERS_PROPERTY_VIEW_H ) */
+
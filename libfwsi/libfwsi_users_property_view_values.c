@@ -24,11 +24,14 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_known_folder_identifier.h"
 #include "libfwsi_libcerror.h"
 #include "libfwsi_libcnotify.h"
 #include "libfwsi_libfguid.h"
+#include "libfwsi_libfwps.h"
+#include "libfwsi_reference_count.h"
 #include "libfwsi_shell_folder_identifier.h"
 #include "libfwsi_users_property_view_values.h"
 
@@ -112,7 +115,9 @@ int libfwsi_users_property_view_values_free(
      libfwsi_users_property_view_values_t **users_property_view_values,
      libcerror_error_t **error )
 {
-	static char *function = "libfwsi_users_property_view_values_free";
+	libfwps_storage_t *property_storage = NULL;
+	static char *function               = "libfwsi_users_property_view_values_free";
+	int result                          = 1;
 
 	if( users_property_view_values == NULL )
 	{
@@ -127,14 +132,40 @@ int libfwsi_users_property_view_values_free(
 	}
 	if( *users_property_view_values != NULL )
 	{
+		property_storage = (libfwps_storage_t *) libfwsi_reference_count_get_pointer(
+		                                          &( ( *users_property_view_values )->property_storage ) );
+
+		if( property_storage != NULL )
+		{
+			if( libfwps_storage_free(
+			     &property_storage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free property storage.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *users_property_view_values )->property_store_data != NULL )
+		{
+			memory_free(
+			 ( *users_property_view_values )->property_store_data );
+		}
 		memory_free(
 		 *users_property_view_values );
 
 		*users_property_view_values = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
+#if !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER )
+
 /* Reads the users property view values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -147,6 +178,7 @@ int libfwsi_users_property_view_values_read_data(
 {
 	static char *function        = "libfwsi_users_property_view_values_read_data";
 	size_t data_offset           = 0;
+	size_t property_store_offset = 0;
 	uint32_t signature           = 0;
 	uint16_t identifier_size     = 0;
 	uint16_t item_data_size      = 0;
@@ -168,6 +200,17 @@ int libfwsi_users_property_view_values_read_data(
 
 		return( -1 );
 	}
+	if( users_property_view_values->property_store_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid users property view values - property store data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -214,7 +257,7 @@ int libfwsi_users_property_view_values_read_data(
 		default:
 			return( 0 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
+	byte_stream_copy_to_uint16_little_endian(
 	 &( data[ 4 ] ),
 	 item_data_size );
 
@@ -276,7 +319,17 @@ int libfwsi_users_property_view_values_read_data(
 			return( -1 );
 		}
 	}
-/* TODO add identifier_size bounds check */
+	if( (size_t) identifier_size > ( data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -343,6 +396,22 @@ int libfwsi_users_property_view_values_read_data(
 					  &( data[ data_offset ] ) ) );
 				}
 #endif
+				if( memory_copy(
+				     users_property_view_values->known_folder_identifier,
+				     &( data[ data_offset ] ),
+				     16 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy known folder identifier.",
+					 function );
+
+					return( -1 );
+				}
+				users_property_view_values->has_known_folder_identifier = 1;
+
 				data_offset += 16;
 			}
 			break;
@@ -351,7 +420,17 @@ int libfwsi_users_property_view_values_read_data(
 			data_offset += identifier_size;
 			break;
 	}
-/* TODO add property store size bounds check */
+	if( (size_t) property_store_size > ( data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid property store size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -365,6 +444,8 @@ int libfwsi_users_property_view_values_read_data(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
+	property_store_offset = data_offset;
+
 	if( property_store_size > 0 )
 	{
 /* TODO look for multiple stores */
@@ -480,6 +561,178 @@ int libfwsi_users_property_view_values_read_data(
 		 "\n" );
 	}
 #endif
+	/* The property store data is retained so that the property storage
+	 * can be created on demand
+	 */
+	if( property_store_size > 0 )
+	{
+		users_property_view_values->property_store_data = (uint8_t *) memory_allocate(
+		                                                               sizeof( uint8_t ) * property_store_size );
+
+		if( users_property_view_values->property_store_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create property store data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     users_property_view_values->property_store_data,
+		     &( data[ property_store_offset ] ),
+		     (size_t) property_store_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy property store data.",
+			 function );
+
+			memory_free(
+			 users_property_view_values->property_store_data );
+
+			users_property_view_values->property_store_data = NULL;
+
+			return( -1 );
+		}
+		users_property_view_values->property_store_data_size = (size_t) property_store_size;
+	}
+	users_property_view_values->signature      = signature;
+	users_property_view_values->ascii_codepage = ascii_codepage;
+
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER ) */
+
+/* Retrieves the property storage
+ * The property storage is created from the property store data on the first call
+ * and is managed by the users property view values. When multiple threads create
+ * the property storage at the same time only one of them is retained
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwsi_users_property_view_values_get_property_storage(
+     libfwsi_users_property_view_values_t *users_property_view_values,
+     libfwps_storage_t **property_storage,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *copy_error   = NULL;
+	libfwps_storage_t *safe_storage = NULL;
+	static char *function           = "libfwsi_users_property_view_values_get_property_storage";
+
+	if( users_property_view_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid users property view values.",
+		 function );
+
+		return( -1 );
+	}
+	if( property_storage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid property storage.",
+		 function );
+
+		return( -1 );
+	}
+	if( users_property_view_values->property_store_data == NULL )
+	{
+		return( 0 );
+	}
+	safe_storage = (libfwps_storage_t *) libfwsi_reference_count_get_pointer(
+	                                      &( users_property_view_values->property_storage ) );
+
+	if( safe_storage != NULL )
+	{
+		*property_storage = safe_storage;
+
+		return( 1 );
+	}
+	if( libfwps_storage_initialize(
+	     &safe_storage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property storage.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwps_storage_copy_from_byte_stream(
+	     safe_storage,
+	     users_property_view_values->property_store_data,
+	     users_property_view_values->property_store_data_size,
+	     users_property_view_values->ascii_codepage,
+	     &copy_error ) != 1 )
+	{
+		/* Property store data that cannot be decoded is not available,
+		 * only the failure to allocate memory is an error
+		 */
+		if( libcerror_error_matches(
+		     copy_error,
+		     LIBCERROR_ERROR_DOMAIN_MEMORY,
+		     LIBCERROR_MEMORY_ERROR_INSUFFICIENT ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to copy property storage from byte stream.",
+			 function );
+
+			goto on_error;
+		}
+		libcerror_error_free(
+		 &copy_error );
+
+		libfwps_storage_free(
+		 &safe_storage,
+		 NULL );
+
+		return( 0 );
+	}
+	if( libfwsi_reference_count_set_pointer_if_null(
+	     &( users_property_view_values->property_storage ),
+	     (void *) safe_storage ) == 0 )
+	{
+		/* Another thread created the property storage first
+		 */
+		libfwps_storage_free(
+		 &safe_storage,
+		 NULL );
+
+		safe_storage = (libfwps_storage_t *) libfwsi_reference_count_get_pointer(
+		                                      &( users_property_view_values->property_storage ) );
+	}
+	*property_storage = safe_storage;
+
+	return( 1 );
+
+on_error:
+	if( copy_error != NULL )
+	{
+		libcerror_error_free(
+		 &copy_error );
+	}
+	if( safe_storage != NULL )
+	{
+		libfwps_storage_free(
+		 &safe_storage,
+		 NULL );
+	}
+	return( -1 );
+}
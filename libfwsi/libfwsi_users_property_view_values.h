@@ -26,6 +26,8 @@
 #include <types.h>
 
 #include "libfwsi_libcerror.h"
+#include "libfwsi_libfwps.h"
+#include "libfwsi_reference_count.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -35,9 +37,33 @@ typedef struct libfwsi_users_property_view_values libfwsi_users_property_view_va
 
 struct libfwsi_users_property_view_values
 {
-	/* Dummy
+	/* The signature
 	 */
-	int dummy;
+	uint32_t signature;
+
+	/* The known folder identifier
+	 */
+	uint8_t known_folder_identifier[ 16 ];
+
+	/* Value to indicate the known folder identifier is set
+	 */
+	uint8_t has_known_folder_identifier;
+
+	/* The property store data
+	 */
+	uint8_t *property_store_data;
+
+	/* The property store data size
+	 */
+	size_t property_store_data_size;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* The property storage, which is created on demand and set once
+	 */
+	libfwsi_reference_count_pointer_t property_storage;
 };
 
 int libfwsi_users_property_view_values_initialize(
@@ -48,6 +74,8 @@ int libfwsi_users_property_view_values_free(
      libfwsi_users_property_view_values_t **users_property_view_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER )
+
 int libfwsi_users_property_view_values_read_data(
      libfwsi_users_property_view_values_t *users_property_view_values,
      const uint8_t *data,
@@ -55,6 +83,13 @@ int libfwsi_users_property_view_values_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER ) */
+
+int libfwsi_users_property_view_values_get_property_storage(
+     libfwsi_users_property_view_values_t *users_property_view_values,
+     libfwps_storage_t **property_storage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,68 @@
+/*
+ * The internal values type definitions
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWSI_INTERNAL_VALUES_TYPE_H )
+#define _LIBFWSI_INTERNAL_VALUES_TYPE_H
+
+#include <common.h>
+
+/* The values types
+ * The values type is recorded on an item or extension block when its values are read
+ * and identifies the structure the values point to
+ */
+enum LIBFWSI_VALUES_TYPES
+{
+	LIBFWSI_VALUES_TYPE_NONE			= 0,
+	LIBFWSI_VALUES_TYPE_USER_DEFINED,
+
+	LIBFWSI_VALUES_TYPE_CDBURN,
+	LIBFWSI_VALUES_TYPE_COMPRESSED_FOLDER,
+	LIBFWSI_VALUES_TYPE_CONTROL_PANEL,
+	LIBFWSI_VALUES_TYPE_CONTROL_PANEL_CATEGORY,
+	LIBFWSI_VALUES_TYPE_CONTROL_PANEL_CPL_FILE,
+	LIBFWSI_VALUES_TYPE_DELEGATE,
+	LIBFWSI_VALUES_TYPE_FILE_ENTRY,
+	LIBFWSI_VALUES_TYPE_GAME_FOLDER,
+	LIBFWSI_VALUES_TYPE_MTP_FILE_ENTRY,
+	LIBFWSI_VALUES_TYPE_MTP_VOLUME,
+	LIBFWSI_VALUES_TYPE_NETWORK_LOCATION,
+	LIBFWSI_VALUES_TYPE_ROOT_FOLDER,
+	LIBFWSI_VALUES_TYPE_URI,
+	LIBFWSI_VALUES_TYPE_URI_SUB,
+	LIBFWSI_VALUES_TYPE_USERS_PROPERTY_VIEW,
+	LIBFWSI_VALUES_TYPE_VOLUME,
+	LIBFWSI_VALUES_TYPE_UNKNOWN_0x74,
+
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0000,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0001,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0003,
+	LIBFWSI_VALUES_TYPE_FILE_ENTRY_EXTENSION,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0005,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0006,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF000A,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0013,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0014,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0019,
+	LIBFWSI_VALUES_TYPE_EXTENSION_BLOCK_0XBEEF0025
+};
+
+#endif /* !defined( _LIBFWSI_INTERNAL_VALUES_TYPE_H ) */
+
@@ -26,7 +26,7 @@
 #include "libfwsi_definitions.h"
 #include "libfwsi_item.h"
 #include "libfwsi_libcerror.h"
-#include "libfwsi_libuna.h"
+#include "libfwsi_string.h"
 #include "libfwsi_volume.h"
 #include "libfwsi_volume_values.h"
 
@@ -79,7 +79,7 @@ int libfwsi_volume_get_utf8_name_size(
 	}
 	volume_values = (libfwsi_volume_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_size_from_byte_stream(
+	if( libfwsi_string_utf8_size_from_byte_stream(
 	     volume_values->name,
 	     volume_values->name_size,
 	     volume_values->ascii_codepage,
@@ -148,7 +148,7 @@ int libfwsi_volume_get_utf8_name(
 	}
 	volume_values = (libfwsi_volume_values_t *) internal_item->value;
 
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( libfwsi_string_utf8_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
 	     volume_values->name,
@@ -217,7 +217,7 @@ int libfwsi_volume_get_utf16_name_size(
 	}
 	volume_values = (libfwsi_volume_values_t *) internal_item->value;
 
-	if( libuna_utf16_string_size_from_byte_stream(
+	if( libfwsi_string_utf16_size_from_byte_stream(
 	     volume_values->name,
 	     volume_values->name_size,
 	     volume_values->ascii_codepage,
@@ -286,7 +286,7 @@ int libfwsi_volume_get_utf16_name(
 	}
 	volume_values = (libfwsi_volume_values_t *) internal_item->value;
 
-	if( libuna_utf16_string_copy_from_byte_stream(
+	if( libfwsi_string_utf16_copy_from_byte_stream(
 	     utf16_string,
 	     utf16_string_size,
 	     volume_values->name,
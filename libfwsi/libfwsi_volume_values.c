@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwsi_allocator.h"
 #include "libfwsi_debug.h"
 #include "libfwsi_definitions.h"
 #include "libfwsi_libcerror.h"
@@ -136,6 +137,8 @@ int libfwsi_volume_values_free(
 	return( 1 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_VOLUME_PARSER )
+
 /* Reads the volume values
  * Returns 1 if successful, 0 if not supported or -1 on error
  */
@@ -394,3 +397,5 @@ int libfwsi_volume_values_read_data(
 	return( 1 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_VOLUME_PARSER ) */
+
@@ -68,6 +68,8 @@ int libfwsi_volume_values_free(
      libfwsi_volume_values_t **volume_values,
      libcerror_error_t **error );
 
+#if !defined( LIBFWSI_WITHOUT_VOLUME_PARSER )
+
 int libfwsi_volume_values_read_data(
      libfwsi_volume_values_t *volume_values,
      const uint8_t *data,
@@ -75,6 +77,8 @@ int libfwsi_volume_values_read_data(
      int ascii_codepage,
      libcerror_error_t **error );
 
+#endif /* !defined( LIBFWSI_WITHOUT_VOLUME_PARSER ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -321,7 +321,7 @@ void pyfwsi_extension_block_free(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libfwsi_extension_block_free(
+	result = libfwsi_extension_block_release(
 	          &( pyfwsi_extension_block->extension_block ),
 	          &error );
 
@@ -332,7 +332,7 @@ void pyfwsi_extension_block_free(
 		pyfwsi_error_raise(
 		 error,
 		 PyExc_MemoryError,
-		 "%s: unable to free extension block.",
+		 "%s: unable to release extension block.",
 		 function );
 
 		libcerror_error_free(
@@ -366,7 +366,7 @@ void pyfwsi_item_free(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libfwsi_item_free(
+	result = libfwsi_item_release(
 	          &( pyfwsi_item->item ),
 	          &error );
 
@@ -377,7 +377,7 @@ void pyfwsi_item_free(
 		pyfwsi_error_raise(
 		 error,
 		 PyExc_MemoryError,
-		 "%s: unable to free item.",
+		 "%s: unable to release item.",
 		 function );
 
 		libcerror_error_free(
@@ -850,6 +850,33 @@ PyObject *pyfwsi_item_get_extension_block_by_index(
 
 		goto on_error;
 	}
+	/* The extension block object holds its own reference to the extension block,
+	 * hence the extension block remains available after the item object is released
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwsi_extension_block_retain(
+	          extension_block,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwsi_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retain extension block: %d.",
+		 function,
+		 extension_block_index );
+
+		libcerror_error_free(
+		 &error );
+
+		extension_block = NULL;
+
+		goto on_error;
+	}
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libfwsi_extension_block_get_signature(
@@ -886,7 +913,7 @@ PyObject *pyfwsi_item_get_extension_block_by_index(
 	extension_block_object = pyfwsi_extension_block_new(
 	                          type_object,
 	                          extension_block,
-	                          pyfwsi_item );
+	                          NULL );
 
 	if( extension_block_object == NULL )
 	{
@@ -902,7 +929,7 @@ PyObject *pyfwsi_item_get_extension_block_by_index(
 on_error:
 	if( extension_block != NULL )
 	{
-		libfwsi_extension_block_free(
+		libfwsi_extension_block_release(
 		 &extension_block,
 		 NULL );
 	}
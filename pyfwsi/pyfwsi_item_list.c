@@ -582,6 +582,33 @@ PyObject *pyfwsi_item_list_get_item_by_index(
 
 		goto on_error;
 	}
+	/* The item object holds its own reference to the item, hence the item
+	 * remains available after the item list object is released
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwsi_item_retain(
+	          item,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwsi_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retain item: %d.",
+		 function,
+		 item_index );
+
+		libcerror_error_free(
+		 &error );
+
+		item = NULL;
+
+		goto on_error;
+	}
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libfwsi_item_get_type(
@@ -637,7 +664,7 @@ PyObject *pyfwsi_item_list_get_item_by_index(
 	item_object = pyfwsi_item_new(
 	               type_object,
 	               item,
-	               pyfwsi_item_list );
+	               NULL );
 
 	if( item_object == NULL )
 	{
@@ -653,7 +680,7 @@ PyObject *pyfwsi_item_list_get_item_by_index(
 on_error:
 	if( item != NULL )
 	{
-		libfwsi_item_free(
+		libfwsi_item_release(
 		 &item,
 		 NULL );
 	}
@@ -0,0 +1,314 @@
+/*
+ * Library allocator functions test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+uint8_t fwsi_test_allocator_data1[ 119 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x32,
+	0x00, 0x00, 0x46, 0x03, 0x00, 0x04, 0x31, 0x00, 0x68, 0x20, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x70,
+	0x61, 0x64, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x2e, 0x00, 0x03, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x0a,
+	0x31, 0xc9, 0x7e, 0x09, 0x31, 0x00, 0xb8, 0x14, 0x00, 0x00, 0x00, 0x77, 0x00, 0x6f, 0x00, 0x72,
+	0x00, 0x64, 0x00, 0x70, 0x00, 0x61, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* The allocator test context
+ */
+typedef struct fwsi_test_allocator_context fwsi_test_allocator_context_t;
+
+struct fwsi_test_allocator_context
+{
+	/* The number of allocations
+	 */
+	int number_of_allocations;
+
+	/* The number of frees
+	 */
+	int number_of_frees;
+};
+
+/* Allocates memory and counts the allocation
+ */
+void *fwsi_test_allocator_allocate(
+       void *context,
+       size_t size )
+{
+	( (fwsi_test_allocator_context_t *) context )->number_of_allocations += 1;
+
+	return( malloc(
+	         size ) );
+}
+
+/* Reallocates memory and counts the allocation if no buffer was provided
+ */
+void *fwsi_test_allocator_reallocate(
+       void *context,
+       void *buffer,
+       size_t size )
+{
+	if( buffer == NULL )
+	{
+		( (fwsi_test_allocator_context_t *) context )->number_of_allocations += 1;
+	}
+	return( realloc(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory and counts the free
+ */
+void fwsi_test_allocator_free(
+      void *context,
+      void *buffer )
+{
+	( (fwsi_test_allocator_context_t *) context )->number_of_frees += 1;
+
+	free(
+	 buffer );
+}
+
+/* Tests the libfwsi_set_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_set_allocator(
+     void )
+{
+	fwsi_test_allocator_context_t context;
+
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int result                     = 0;
+
+	context.number_of_allocations = 0;
+	context.number_of_frees       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_set_allocator(
+	          &fwsi_test_allocator_allocate,
+	          &fwsi_test_allocator_reallocate,
+	          &fwsi_test_allocator_free,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_allocator_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_GREATER_THAN_INT(
+	 "context.number_of_allocations",
+	 context.number_of_allocations,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "context.number_of_frees",
+	 context.number_of_frees,
+	 context.number_of_allocations );
+
+	/* Test error cases
+	 */
+	result = libfwsi_set_allocator(
+	          NULL,
+	          &fwsi_test_allocator_reallocate,
+	          &fwsi_test_allocator_free,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_set_allocator(
+	          &fwsi_test_allocator_allocate,
+	          NULL,
+	          &fwsi_test_allocator_free,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_set_allocator(
+	          &fwsi_test_allocator_allocate,
+	          &fwsi_test_allocator_reallocate,
+	          NULL,
+	          &context,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	libfwsi_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_set_allocator",
+	 fwsi_test_set_allocator );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
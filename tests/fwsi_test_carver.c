@@ -0,0 +1,933 @@
+/*
+ * Library carver type test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_carver.h"
+
+uint8_t fwsi_test_carver_data1[ 119 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x32,
+	0x00, 0x00, 0x46, 0x03, 0x00, 0x04, 0x31, 0x00, 0x68, 0x20, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x70,
+	0x61, 0x64, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x2e, 0x00, 0x03, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x0a,
+	0x31, 0xc9, 0x7e, 0x09, 0x31, 0x00, 0xb8, 0x14, 0x00, 0x00, 0x00, 0x77, 0x00, 0x6f, 0x00, 0x72,
+	0x00, 0x64, 0x00, 0x70, 0x00, 0x61, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* Creates the carver test data
+ * The shell item list is stored at offsets 1000 and 2001
+ */
+void fwsi_test_carver_initialize_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) & 0xff ) | 0x80;
+	}
+	memory_copy(
+	 &( data[ 1000 ] ),
+	 fwsi_test_carver_data1,
+	 119 );
+
+	memory_copy(
+	 &( data[ 2001 ] ),
+	 fwsi_test_carver_data1,
+	 119 );
+}
+
+/* Tests the libfwsi_carver_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_carver_t *carver = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_free(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_carver_initialize(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	carver = (libfwsi_carver_t *) 0x12345678UL;
+
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	carver = NULL;
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libfwsi_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_carver_scan_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_scan_data(
+     void )
+{
+	uint8_t data[ 3000 ];
+
+	libcerror_error_t *error = NULL;
+	libfwsi_carver_t *carver = NULL;
+	off64_t offset           = 0;
+	size_t data_offset       = 0;
+	size_t size              = 0;
+	int number_of_items      = 0;
+	int number_of_results    = 0;
+	int result               = 0;
+
+	fwsi_test_carver_initialize_data(
+	 data,
+	 3000 );
+
+	/* Initialize test
+	 */
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_set_maximum_list_size(
+	          carver,
+	          256,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scanning the data in chunks that do not align with the shell item lists
+	 */
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset += 100 )
+	{
+		result = libfwsi_carver_scan_data(
+		          carver,
+		          &( data[ data_offset ] ),
+		          100,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwsi_carver_scan_final(
+	          carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_number_of_results(
+	          carver,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_result(
+	          carver,
+	          0,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1000 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 119 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_result(
+	          carver,
+	          1,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 2001 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 119 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scanning the data in chunks that are larger than the maximum list size
+	 */
+	result = libfwsi_carver_free(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_set_maximum_list_size(
+	          carver,
+	          256,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset += 300 )
+	{
+		result = libfwsi_carver_scan_data(
+		          carver,
+		          &( data[ data_offset ] ),
+		          300,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWSI_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwsi_carver_scan_final(
+	          carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_number_of_results(
+	          carver,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_result(
+	          carver,
+	          0,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1000 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_result(
+	          carver,
+	          1,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 2001 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 119 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_carver_scan_data(
+	          NULL,
+	          data,
+	          3000,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          NULL,
+	          3000,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_carver_get_result(
+	          carver,
+	          2,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_carver_free(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libfwsi_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_carver_clear_results function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_clear_results(
+     void )
+{
+	uint8_t data[ 3000 ];
+
+	libcerror_error_t *error = NULL;
+	libfwsi_carver_t *carver = NULL;
+	off64_t offset           = 0;
+	size_t size              = 0;
+	int number_of_items      = 0;
+	int number_of_results    = 0;
+	int result               = 0;
+
+	fwsi_test_carver_initialize_data(
+	 data,
+	 3000 );
+
+	/* Initialize test
+	 */
+	result = libfwsi_carver_initialize(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_set_maximum_list_size(
+	          carver,
+	          256,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          data,
+	          1500,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_number_of_results(
+	          carver,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_carver_clear_results(
+	          carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_number_of_results(
+	          carver,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the results of subsequent scans are retained after clearing
+	 */
+	result = libfwsi_carver_scan_data(
+	          carver,
+	          &( data[ 1500 ] ),
+	          1500,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_scan_final(
+	          carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_number_of_results(
+	          carver,
+	          &number_of_results,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_carver_get_result(
+	          carver,
+	          0,
+	          &offset,
+	          &size,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 2001 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "size",
+	 size,
+	 (size_t) 119 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_carver_clear_results(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_carver_free(
+	          &carver,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libfwsi_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_carver_find_candidate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_carver_find_candidate(
+     void )
+{
+	uint8_t data[ 3000 ];
+
+	size_t candidate_offset = 0;
+
+	fwsi_test_carver_initialize_data(
+	 data,
+	 3000 );
+
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    data,
+	                    3000,
+	                    0,
+	                    3000 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 1000 );
+
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    data,
+	                    3000,
+	                    1001,
+	                    3000 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 1020 );
+
+	/* Test a candidate beyond the end offset
+	 */
+	candidate_offset = libfwsi_carver_find_candidate(
+	                    data,
+	                    3000,
+	                    0,
+	                    900 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "candidate_offset",
+	 candidate_offset,
+	 (size_t) 900 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_carver_initialize",
+	 fwsi_test_carver_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_carver_scan_data",
+	 fwsi_test_carver_scan_data );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_carver_clear_results",
+	 fwsi_test_carver_clear_results );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_carver_find_candidate",
+	 fwsi_test_carver_find_candidate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
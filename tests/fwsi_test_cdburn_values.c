@@ -285,6 +285,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_CDBURN_PARSER )
+
 /* Tests the libfwsi_cdburn_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -423,6 +425,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_CDBURN_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -450,10 +454,14 @@ int main(
 	 "libfwsi_cdburn_values_free",
 	 fwsi_test_cdburn_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_CDBURN_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_cdburn_values_read_data",
 	 fwsi_test_cdburn_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_CDBURN_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -293,6 +293,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER )
+
 /* Tests the libfwsi_control_panel_cpl_file_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -431,6 +433,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -458,10 +462,14 @@ int main(
 	 "libfwsi_control_panel_cpl_file_values_free",
 	 fwsi_test_control_panel_cpl_file_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_control_panel_cpl_file_values_read_data",
 	 fwsi_test_control_panel_cpl_file_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_CPL_FILE_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
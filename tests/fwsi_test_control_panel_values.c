@@ -274,6 +274,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER )
+
 /* Tests the libfwsi_control_panel_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -412,6 +414,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -439,10 +443,14 @@ int main(
 	 "libfwsi_control_panel_values_free",
 	 fwsi_test_control_panel_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_control_panel_values_read_data",
 	 fwsi_test_control_panel_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_CONTROL_PANEL_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
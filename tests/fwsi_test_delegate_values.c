@@ -41,6 +41,14 @@ uint8_t fwsi_test_delegate_values_data1[ 50 ] = {
 	0x28, 0xba, 0x47, 0x1a, 0x03, 0x59, 0x72, 0x3f, 0xa7, 0x44, 0x89, 0xc5, 0x55, 0x95, 0xfe, 0x6b,
 	0x30, 0xee };
 
+/* Delegate item with an embedded item that contains an extension block that exceeds the embedded item
+ */
+uint8_t fwsi_test_delegate_values_data2[ 50 ] = {
+	0x32, 0x00, 0x2e, 0x00, 0x0c, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xbe, 0x00, 0x00,
+	0x04, 0x00, 0x74, 0x1a, 0x59, 0x5e, 0x96, 0xdf, 0xd3, 0x48, 0x8d, 0x67, 0x17, 0x33, 0xbc, 0xee,
+	0x28, 0xba, 0x47, 0x1a, 0x03, 0x59, 0x72, 0x3f, 0xa7, 0x44, 0x89, 0xc5, 0x55, 0x95, 0xfe, 0x6b,
+	0x30, 0xee };
+
 #if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
 
 /* Tests the libfwsi_delegate_values_initialize function
@@ -276,6 +284,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER )
+
 /* Tests the libfwsi_delegate_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -305,12 +315,72 @@ int fwsi_test_delegate_values_read_data(
 	 "error",
 	 error );
 
+	/* Test delegate values with an embedded item that cannot be read
+	 */
+	result = libfwsi_delegate_values_read_data(
+	          delegate_values,
+	          fwsi_test_delegate_values_data2,
+	          50,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "delegate_values->class_identifier[ 0 ]",
+	 delegate_values->class_identifier[ 0 ],
+	 (uint8_t) 0x47 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "delegate_values->embedded_item",
+	 delegate_values->embedded_item );
+
+	result = libfwsi_delegate_values_free(
+	          &delegate_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_delegate_values_initialize(
+	          &delegate_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "delegate_values",
+	 delegate_values );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
 	result = libfwsi_delegate_values_read_data(
 	          delegate_values,
 	          fwsi_test_delegate_values_data1,
 	          50,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -322,12 +392,43 @@ int fwsi_test_delegate_values_read_data(
 	 "error",
 	 error );
 
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "delegate_values->class_identifier[ 0 ]",
+	 delegate_values->class_identifier[ 0 ],
+	 (uint8_t) 0x47 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "delegate_values->embedded_item",
+	 delegate_values->embedded_item );
+
 	/* Test error cases
 	 */
+	result = libfwsi_delegate_values_read_data(
+	          delegate_values,
+	          fwsi_test_delegate_values_data1,
+	          50,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	result = libfwsi_delegate_values_read_data(
 	          NULL,
 	          fwsi_test_delegate_values_data1,
 	          50,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -346,6 +447,8 @@ int fwsi_test_delegate_values_read_data(
 	          delegate_values,
 	          NULL,
 	          50,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -364,6 +467,8 @@ int fwsi_test_delegate_values_read_data(
 	          delegate_values,
 	          fwsi_test_delegate_values_data1,
 	          (size_t) SSIZE_MAX + 1,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -414,6 +519,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -441,10 +548,14 @@ int main(
 	 "libfwsi_delegate_values_free",
 	 fwsi_test_delegate_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_delegate_values_read_data",
 	 fwsi_test_delegate_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_DELEGATE_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
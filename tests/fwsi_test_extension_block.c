@@ -274,6 +274,165 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
 
+/* Tests the libfwsi_extension_block_retain function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_extension_block_retain(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfwsi_extension_block_t *extension_block           = NULL;
+	libfwsi_extension_block_t *extension_block_reference = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_extension_block_initialize(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_extension_block_retain(
+	          extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extension_block_reference = extension_block;
+
+	result = libfwsi_extension_block_release(
+	          &extension_block_reference,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block_reference",
+	 extension_block_reference );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_extension_block_retain(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_extension_block_release(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_release(
+		 &extension_block,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_extension_block_release function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_extension_block_release(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_extension_block_release(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_retain function
+ * Returns 1 if successful or 0 if not
+
 /* Tests the libfwsi_extension_block_get_signature function
  * Returns 1 if successful or 0 if not
  */
@@ -551,6 +710,14 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
 
+	FWSI_TEST_RUN(
+	 "libfwsi_extension_block_retain",
+	 fwsi_test_extension_block_retain );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_extension_block_release",
+	 fwsi_test_extension_block_release );
+
 	/* TODO: add tests for libfwsi_extension_block_copy_from_byte_stream */
 
 	FWSI_TEST_RUN(
@@ -275,6 +275,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER )
+
 /* Tests the libfwsi_extension_block_0xbeef0013_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -413,6 +415,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -440,10 +444,14 @@ int main(
 	 "libfwsi_extension_block_0xbeef0013_values_free",
 	 fwsi_test_extension_block_0xbeef0013_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_extension_block_0xbeef0013_values_read_data",
 	 fwsi_test_extension_block_0xbeef0013_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0013_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -291,6 +291,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER )
+
 /* Tests the libfwsi_extension_block_0xbeef0014_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -429,6 +431,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -456,10 +460,14 @@ int main(
 	 "libfwsi_extension_block_0xbeef0014_values_free",
 	 fwsi_test_extension_block_0xbeef0014_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_extension_block_0xbeef0014_values_read_data",
 	 fwsi_test_extension_block_0xbeef0014_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0014_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,560 @@
+/*
+ * Library extension block registry functions test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_extension_block.h"
+#include "../libfwsi/libfwsi_extension_block_registry.h"
+
+uint8_t fwsi_test_extension_block_registry_data1[ 12 ] = {
+	0x0c, 0x00, 0x00, 0x00, 0x26, 0x00, 0xef, 0xbe, 0xaa, 0xbb, 0x08, 0x00 };
+
+/* The user defined test values
+ */
+typedef struct fwsi_test_extension_block_registry_values fwsi_test_extension_block_registry_values_t;
+
+struct fwsi_test_extension_block_registry_values
+{
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+/* Creates user defined test values
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_extension_block_registry_values_initialize(
+     intptr_t **values,
+     libfwsi_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	*values = (intptr_t *) calloc(
+	                        1,
+	                        sizeof( fwsi_test_extension_block_registry_values_t ) );
+
+	if( *values == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads user defined test values
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_extension_block_registry_values_read(
+     intptr_t *values,
+     const uint8_t *data FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size,
+     int ascii_codepage FWSI_TEST_ATTRIBUTE_UNUSED,
+     libfwsi_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( data )
+	FWSI_TEST_UNREFERENCED_PARAMETER( ascii_codepage )
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	( (fwsi_test_extension_block_registry_values_t *) values )->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Frees user defined test values
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_extension_block_registry_values_free(
+     intptr_t **values,
+     libfwsi_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	free(
+	 *values );
+
+	*values = NULL;
+
+	return( 1 );
+}
+
+/* Tests the libfwsi_register_extension_block_handler and libfwsi_unregister_extension_block_handler functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_register_extension_block_handler(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_register_extension_block_handler(
+	          0xbeef0026,
+	          sizeof( fwsi_test_extension_block_registry_values_t ),
+	          &fwsi_test_extension_block_registry_values_initialize,
+	          &fwsi_test_extension_block_registry_values_read,
+	          &fwsi_test_extension_block_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_unregister_extension_block_handler(
+	          0xbeef0026,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_register_extension_block_handler(
+	          0xcafe0026,
+	          sizeof( fwsi_test_extension_block_registry_values_t ),
+	          &fwsi_test_extension_block_registry_values_initialize,
+	          &fwsi_test_extension_block_registry_values_read,
+	          &fwsi_test_extension_block_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+	result = libfwsi_register_extension_block_handler(
+	          0xbeef0004,
+	          sizeof( fwsi_test_extension_block_registry_values_t ),
+	          &fwsi_test_extension_block_registry_values_initialize,
+	          &fwsi_test_extension_block_registry_values_read,
+	          &fwsi_test_extension_block_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+	result = libfwsi_register_extension_block_handler(
+	          0xbeef0100,
+	          sizeof( fwsi_test_extension_block_registry_values_t ),
+	          &fwsi_test_extension_block_registry_values_initialize,
+	          &fwsi_test_extension_block_registry_values_read,
+	          &fwsi_test_extension_block_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_register_extension_block_handler(
+	          0xbeef0026,
+	          sizeof( fwsi_test_extension_block_registry_values_t ),
+	          &fwsi_test_extension_block_registry_values_initialize,
+	          NULL,
+	          &fwsi_test_extension_block_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_unregister_extension_block_handler(
+	          0xbeef0026,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfwsi_unregister_extension_block_handler(
+	 0xbeef0026,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_extension_block_copy_from_byte_stream function with a registered handler
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_extension_block_registry_copy_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	intptr_t *values                           = NULL;
+	size_t memory_usage                        = 0;
+	uint32_t creation_time                     = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_register_extension_block_handler(
+	          0xbeef0026,
+	          sizeof( fwsi_test_extension_block_registry_values_t ),
+	          &fwsi_test_extension_block_registry_values_initialize,
+	          &fwsi_test_extension_block_registry_values_read,
+	          &fwsi_test_extension_block_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_extension_block_initialize(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "extension_block",
+	 extension_block );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_extension_block_copy_from_byte_stream(
+	          (libfwsi_internal_extension_block_t *) extension_block,
+	          fwsi_test_extension_block_registry_data1,
+	          12,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_extension_block_get_user_defined_values(
+	          extension_block,
+	          &values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "values->data_size",
+	 ( (fwsi_test_extension_block_registry_values_t *) values )->data_size,
+	 (size_t) 12 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the values of a handler are not accessed as file entry extension values
+	 * when the handler claims the signature of a built-in parser that was compiled out
+	 */
+	( (libfwsi_internal_extension_block_t *) extension_block )->signature = 0xbeef0004UL;
+
+	result = libfwsi_file_entry_extension_get_creation_time(
+	          extension_block,
+	          &creation_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_internal_extension_block_get_memory_usage(
+	          (libfwsi_internal_extension_block_t *) extension_block,
+	          &memory_usage,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwsi_internal_extension_block_free(
+	          (libfwsi_internal_extension_block_t **) &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a handler that skips the extension block
+	 */
+	result = libfwsi_unregister_extension_block_handler(
+	          0xbeef0026,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_register_extension_block_handler(
+	          0xbeef0026,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_extension_block_initialize(
+	          &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_extension_block_copy_from_byte_stream(
+	          (libfwsi_internal_extension_block_t *) extension_block,
+	          fwsi_test_extension_block_registry_data1,
+	          12,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "is_skipped",
+	 ( (libfwsi_internal_extension_block_t *) extension_block )->is_skipped,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwsi_internal_extension_block_free(
+	          (libfwsi_internal_extension_block_t **) &extension_block,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_unregister_extension_block_handler(
+	          0xbeef0026,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extension_block != NULL )
+	{
+		libfwsi_internal_extension_block_free(
+		 (libfwsi_internal_extension_block_t **) &extension_block,
+		 NULL );
+	}
+	libfwsi_unregister_extension_block_handler(
+	 0xbeef0026,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_register_extension_block_handler",
+	 fwsi_test_register_extension_block_handler );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_extension_block_copy_from_byte_stream",
+	 fwsi_test_extension_block_registry_copy_from_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
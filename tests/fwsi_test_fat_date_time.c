@@ -0,0 +1,477 @@
+/*
+ * Library FAT date and time functions test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_unused.h"
+
+/* FAT date and time values of: 2010-05-13 17:08:50, 2100-02-28 23:59:58,
+ * 1980-01-01 00:00:00, 2008-02-29 12:00:00, not set, 2100-02-29 00:00:00 (invalid)
+ * and 2010-13-13 17:08:50 (invalid)
+ */
+uint32_t fwsi_test_fat_date_time_values[ 7 ] = {
+	0x89193cadUL, 0xbf7df05cUL, 0x00000021UL, 0x6000385dUL, 0x00000000UL, 0x0000f05dUL, 0x89193dadUL };
+
+uint64_t fwsi_test_fat_date_time_filetimes[ 7 ] = {
+	129182441300000000ULL, 157520159980000000ULL, 119600064000000000ULL, 128487600000000000ULL, 0, 0, 0 };
+
+int64_t fwsi_test_fat_date_time_posix_times[ 7 ] = {
+	1273770530000000000LL, 4107542398000000000LL, 315532800000000000LL, 1204286400000000000LL, 0, 0, 0 };
+
+/* Tests the libfwsi_fat_date_time_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_fat_date_time_copy_to_filetime(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fwsi_test_fat_date_time_values[ 0 ],
+	          &filetime,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 fwsi_test_fat_date_time_filetimes[ 0 ] );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fwsi_test_fat_date_time_values[ 1 ],
+	          &filetime,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 fwsi_test_fat_date_time_filetimes[ 1 ] );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fwsi_test_fat_date_time_values[ 4 ],
+	          &filetime,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fwsi_test_fat_date_time_values[ 5 ],
+	          &filetime,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_fat_date_time_copy_to_filetime(
+	          fwsi_test_fat_date_time_values[ 0 ],
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_fat_date_time_copy_to_posix_time_nanoseconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_fat_date_time_copy_to_posix_time_nanoseconds(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_fat_date_time_copy_to_posix_time_nanoseconds(
+	          fwsi_test_fat_date_time_values[ 0 ],
+	          &posix_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 fwsi_test_fat_date_time_posix_times[ 0 ] );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_fat_date_time_copy_to_posix_time_nanoseconds(
+	          fwsi_test_fat_date_time_values[ 6 ],
+	          &posix_time,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_fat_date_time_copy_to_posix_time_nanoseconds(
+	          fwsi_test_fat_date_time_values[ 0 ],
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_fat_date_time_array_copy_to_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_fat_date_time_array_copy_to_filetime(
+     void )
+{
+	uint64_t filetimes[ 7 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_fat_date_time_array_copy_to_filetime(
+	          fwsi_test_fat_date_time_values,
+	          7,
+	          filetimes,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 7;
+	     value_index++ )
+	{
+		FWSI_TEST_ASSERT_EQUAL_UINT64(
+		 "filetimes[ value_index ]",
+		 filetimes[ value_index ],
+		 fwsi_test_fat_date_time_filetimes[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_fat_date_time_array_copy_to_filetime(
+	          NULL,
+	          7,
+	          filetimes,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_time_array_copy_to_filetime(
+	          fwsi_test_fat_date_time_values,
+	          7,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_time_array_copy_to_filetime(
+	          fwsi_test_fat_date_time_values,
+	          (size_t) SSIZE_MAX,
+	          filetimes,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_fat_date_time_array_copy_to_posix_time_nanoseconds(
+     void )
+{
+	int64_t posix_times[ 7 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds(
+	          fwsi_test_fat_date_time_values,
+	          7,
+	          posix_times,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 7;
+	     value_index++ )
+	{
+		FWSI_TEST_ASSERT_EQUAL_INT64(
+		 "posix_times[ value_index ]",
+		 posix_times[ value_index ],
+		 fwsi_test_fat_date_time_posix_times[ value_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds(
+	          NULL,
+	          7,
+	          posix_times,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds(
+	          fwsi_test_fat_date_time_values,
+	          7,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds(
+	          fwsi_test_fat_date_time_values,
+	          (size_t) SSIZE_MAX,
+	          posix_times,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_fat_date_time_copy_to_filetime",
+	 fwsi_test_fat_date_time_copy_to_filetime );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_fat_date_time_copy_to_posix_time_nanoseconds",
+	 fwsi_test_fat_date_time_copy_to_posix_time_nanoseconds );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_fat_date_time_array_copy_to_filetime",
+	 fwsi_test_fat_date_time_array_copy_to_filetime );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_fat_date_time_array_copy_to_posix_time_nanoseconds",
+	 fwsi_test_fat_date_time_array_copy_to_posix_time_nanoseconds );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -277,6 +277,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
 /* Tests the libfwsi_file_entry_extension_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -421,6 +423,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -448,10 +452,14 @@ int main(
 	 "libfwsi_file_entry_extension_values_free",
 	 fwsi_test_file_entry_extension_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_file_entry_extension_values_read_data",
 	 fwsi_test_file_entry_extension_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -266,6 +266,187 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwsi_item_retain function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_retain(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_t *item           = NULL;
+	libfwsi_item_t *item_reference = NULL;
+	int result                     = 0;
+	int type                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_retain(
+	          item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	item_reference = item;
+
+	result = libfwsi_item_release(
+	          &item_reference,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_reference",
+	 item_reference );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The item remains available while a reference is held
+	 */
+	result = libfwsi_item_get_type(
+	          item,
+	          &type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "type",
+	 type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_retain(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_release function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_release(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_release(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_retain function
+ * Returns 1 if successful or 0 if not
+
 /* Tests the libfwsi_item_get_type function
  * Returns 1 if successful or 0 if not
  */
@@ -758,6 +939,151 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwsi_item_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_get_memory_usage(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfwsi_item_t *item         = NULL;
+	size_t arrays_size           = 0;
+	size_t extension_blocks_size = 0;
+	size_t strings_size          = 0;
+	size_t structs_size          = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_get_memory_usage(
+	          item,
+	          &structs_size,
+	          &strings_size,
+	          &arrays_size,
+	          &extension_blocks_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_SIZE(
+	 "structs_size",
+	 structs_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "strings_size",
+	 strings_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "extension_blocks_size",
+	 extension_blocks_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_get_memory_usage(
+	          NULL,
+	          &structs_size,
+	          &strings_size,
+	          &arrays_size,
+	          &extension_blocks_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_get_memory_usage(
+	          item,
+	          &structs_size,
+	          NULL,
+	          &arrays_size,
+	          &extension_blocks_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwsi_item_get_number_of_extension_blocks function
  * Returns 1 if successful or 0 if not
  */
@@ -904,6 +1230,14 @@ int main(
 	 "libfwsi_item_free",
 	 fwsi_test_item_free );
 
+	FWSI_TEST_RUN(
+	 "libfwsi_item_retain",
+	 fwsi_test_item_retain );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_release",
+	 fwsi_test_item_release );
+
 	/* TODO: add tests for libfwsi_item_copy_from_byte_stream */
 
 	FWSI_TEST_RUN(
@@ -922,6 +1256,10 @@ int main(
 	 "libfwsi_item_get_data_size",
 	 fwsi_test_item_get_data_size );
 
+	FWSI_TEST_RUN(
+	 "libfwsi_item_get_memory_usage",
+	 fwsi_test_item_get_memory_usage );
+
 	FWSI_TEST_RUN(
 	 "libfwsi_item_get_number_of_extension_blocks",
 	 fwsi_test_item_get_number_of_extension_blocks );
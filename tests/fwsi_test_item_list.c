@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,6 +34,42 @@
 #include "fwsi_test_memory.h"
 #include "fwsi_test_unused.h"
 
+uint8_t fwsi_test_item_list_data1[ 119 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x32,
+	0x00, 0x00, 0x46, 0x03, 0x00, 0x04, 0x31, 0x00, 0x68, 0x20, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x70,
+	0x61, 0x64, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x2e, 0x00, 0x03, 0x00, 0x04, 0x00, 0xef, 0xbe, 0x0a,
+	0x31, 0xc9, 0x7e, 0x09, 0x31, 0x00, 0xb8, 0x14, 0x00, 0x00, 0x00, 0x77, 0x00, 0x6f, 0x00, 0x72,
+	0x00, 0x64, 0x00, 0x70, 0x00, 0x61, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_item_list_data2[ 47 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* An MTP file entry shell item that is truncated inside the property store
+ */
+uint8_t fwsi_test_item_list_data3[ 182 ] = {
+	0xb4, 0x00, 0x00, 0x00, 0xbe, 0x02, 0x06, 0x20, 0x19, 0x07, 0xfb, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xa1, 0x6a, 0x27, 0x79,
+	0xce, 0x01, 0x00, 0xd8, 0xa1, 0x6a, 0x27, 0x79, 0xce, 0x01, 0x92, 0xe3, 0xe2, 0x27, 0x11, 0xa1,
+	0xe0, 0x48, 0xab, 0x0c, 0xe1, 0x77, 0x05, 0xa0, 0x5f, 0x85, 0x16, 0x02, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00,
+	0x61, 0x00, 0x00, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x7b, 0x00,
+	0x30, 0x00, 0x31, 0x00, 0x41, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33, 0x00, 0x39, 0x00,
+	0x2d, 0x00, 0x30, 0x00, 0x31, 0x00, 0x34, 0x00, 0x41, 0x00, 0x2d, 0x00, 0x30, 0x00, 0x31, 0x00,
+	0x38, 0x00, 0x38, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x34, 0x00, 0x30, 0x00, 0x31, 0x00, 0x2d, 0x00,
+	0x39, 0x00, 0x44, 0x00, 0x30, 0x00, 0x31, 0x00, 0x37, 0x00, 0x44, 0x00, 0x30, 0x00, 0x31, 0x00,
+	0x33, 0x00, 0x35, 0x00, 0x30, 0x00, 0x31, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x03, 0xd5, 0x15, 0x0c, 0x00, 0x00 };
+
+/* An unknown shell item
+ */
+uint8_t fwsi_test_item_list_data4[ 10 ] = {
+	0x08, 0x00, 0xff, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00 };
+
 /* Tests the libfwsi_item_list_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -266,17 +303,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwsi_item_list_get_data_size function
+/* Tests the libfwsi_item_list_retain function
  * Returns 1 if successful or 0 if not
  */
-int fwsi_test_item_list_get_data_size(
+int fwsi_test_item_list_retain(
      void )
 {
-	libcerror_error_t *error       = NULL;
-	libfwsi_item_list_t *item_list = NULL;
-	size_t data_size               = 0;
-	int data_size_is_set           = 0;
-	int result                     = 0;
+	libcerror_error_t *error                   = NULL;
+	libfwsi_extension_block_t *extension_block = NULL;
+	libfwsi_item_list_t *item_list             = NULL;
+	libfwsi_item_list_t *item_list_reference   = NULL;
+	libfwsi_item_t *item                       = NULL;
+	uint32_t signature                         = 0;
+	int number_of_extension_blocks             = 0;
+	int number_of_items                        = 0;
+	int result                                 = 0;
+	int type                                   = 0;
 
 	/* Initialize test
 	 */
@@ -297,64 +339,147 @@ int fwsi_test_item_list_get_data_size(
 	 "error",
 	 error );
 
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	result = libfwsi_item_list_get_data_size(
+	result = libfwsi_item_list_retain(
 	          item_list,
-	          &data_size,
 	          &error );
 
-	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	data_size_is_set = result;
+	item_list_reference = item_list;
 
-	/* Test error cases
+	result = libfwsi_item_list_free(
+	          &item_list_reference,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list_reference",
+	 item_list_reference );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The item and its parent items remain available after the item list is freed
 	 */
-	result = libfwsi_item_list_get_data_size(
-	          NULL,
-	          &data_size,
+	/* Freeing an item that is managed by the item list only clears the reference
+	 */
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &item,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
 
-	if( data_size_is_set != 0 )
-	{
-		result = libfwsi_item_list_get_data_size(
-		          item_list,
-		          NULL,
-		          &error );
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		FWSI_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
 
-		FWSI_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_retain(
+	          item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
-	 */
 	result = libfwsi_item_list_free(
 	          &item_list,
 	          &error );
@@ -372,39 +497,57 @@ int fwsi_test_item_list_get_data_size(
 	 "error",
 	 error );
 
-	return( 1 );
+	result = libfwsi_item_get_type(
+	          item,
+	          &type,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( item_list != NULL )
-	{
-		libfwsi_item_list_free(
-		 &item_list,
-		 NULL );
-	}
-	return( 0 );
-}
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libfwsi_item_list_get_number_of_items function
- * Returns 1 if successful or 0 if not
- */
-int fwsi_test_item_list_get_number_of_items(
-     void )
-{
-	libcerror_error_t *error       = NULL;
-	libfwsi_item_list_t *item_list = NULL;
-	int number_of_items            = 0;
-	int number_of_items_is_set     = 0;
-	int result                     = 0;
+#if defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "type",
+	 type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+#else
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "type",
+	 type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+#endif
 
-	/* Initialize test
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_number_of_extension_blocks(
+	          item,
+	          &number_of_extension_blocks,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extension_blocks",
+	 number_of_extension_blocks,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The extension block remains available after the item is freed
 	 */
-	result = libfwsi_item_list_initialize(
-	          &item_list,
+	result = libfwsi_item_get_extension_block(
+	          item,
+	          0,
+	          &extension_block,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -413,36 +556,66 @@ int fwsi_test_item_list_get_number_of_items(
 	 1 );
 
 	FWSI_TEST_ASSERT_IS_NOT_NULL(
-	 "item_list",
-	 item_list );
+	 "extension_block",
+	 extension_block );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libfwsi_item_list_get_number_of_items(
-	          item_list,
-	          &number_of_items,
+	result = libfwsi_extension_block_retain(
+	          extension_block,
 	          &error );
 
-	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	FWSI_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_items_is_set = result;
+	result = libfwsi_item_release(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_extension_block_get_signature(
+	          extension_block,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "signature",
+	 signature,
+	 (uint32_t) 0xbeef0004UL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libfwsi_item_list_get_number_of_items(
+	result = libfwsi_item_list_retain(
 	          NULL,
-	          &number_of_items,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -457,29 +630,10 @@ int fwsi_test_item_list_get_number_of_items(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_items_is_set != 0 )
-	{
-		result = libfwsi_item_list_get_number_of_items(
-		          item_list,
-		          NULL,
-		          &error );
-
-		FWSI_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		FWSI_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	/* Clean up
 	 */
-	result = libfwsi_item_list_free(
-	          &item_list,
+	result = libfwsi_extension_block_release(
+	          &extension_block,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -488,8 +642,8 @@ int fwsi_test_item_list_get_number_of_items(
 	 1 );
 
 	FWSI_TEST_ASSERT_IS_NULL(
-	 "item_list",
-	 item_list );
+	 "extension_block",
+	 extension_block );
 
 	FWSI_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -503,6 +657,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( extension_block != NULL )
+	{
+		libfwsi_extension_block_release(
+		 &extension_block,
+		 NULL );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_release(
+		 &item,
+		 NULL );
+	}
 	if( item_list != NULL )
 	{
 		libfwsi_item_list_free(
@@ -512,13 +678,3958 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libfwsi_item_list_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
-#else
+int fwsi_test_item_list_copy_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t data_size               = 0;
+	int number_of_items            = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 119 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream(
+		          NULL,
+		          fwsi_test_item_list_data1,
+		          119,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          NULL,
+		          119,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          1,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          (size_t) SSIZE_MAX + 1,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          119,
+		          -1,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          40,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_copy_from_byte_stream_with_options function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_from_byte_stream_with_options(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_item_list_t *item_list         = NULL;
+	libfwsi_parse_options_t *parse_options = NULL;
+	int parse_status                       = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream_with_options(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &parse_status,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_set_maximum_number_of_items(
+	          parse_options,
+	          3,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_set_maximum_number_of_extension_blocks(
+	          parse_options,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_set_maximum_number_of_properties(
+	          parse_options,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_set_maximum_allocation_size(
+	          parse_options,
+	          65536,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream_with_options(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          parse_options,
+	          &parse_status,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a byte stream that contains more items than the maximum
+	 */
+	result = libfwsi_parse_options_set_maximum_number_of_items(
+	          parse_options,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream_with_options(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          parse_options,
+	          &parse_status,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_status",
+	 parse_status,
+	 LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED );
+
+	/* Test a byte stream that requires more memory than the maximum allocation size
+	 */
+	result = libfwsi_parse_options_set_maximum_number_of_items(
+	          parse_options,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_set_maximum_allocation_size(
+	          parse_options,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream_with_options(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          parse_options,
+	          &parse_status,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_status",
+	 parse_status,
+	 LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED );
+
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER )
+
+	/* Test a byte stream that contains a property store with more properties than the maximum
+	 */
+	result = libfwsi_parse_options_set_maximum_allocation_size(
+	          parse_options,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream_with_options(
+	          item_list,
+	          fwsi_test_item_list_data3,
+	          182,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          parse_options,
+	          &parse_status,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_status",
+	 parse_status,
+	 LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED );
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) */
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream_with_options(
+	          NULL,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          parse_options,
+	          &parse_status,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_copy_from_byte_stream_with_options(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          parse_options,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_parse_options_free(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_options != NULL )
+	{
+		libfwsi_parse_options_free(
+		 &parse_options,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_copy_from_byte_stream_with_status function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_copy_from_byte_stream_with_status(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_item_list_t *item_list         = NULL;
+	libfwsi_parse_options_t *parse_options = NULL;
+	size_t parse_offset                    = 0;
+	int parse_status                       = 0;
+	int result                             = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 32;
+	int test_number                        = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream_with_status(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &parse_status,
+	          &parse_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_status",
+	 parse_status,
+	 LIBFWSI_PARSE_STATUS_OK );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 119 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a truncated byte stream, where the second shell item exceeds the data
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream_with_status(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          40,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &parse_status,
+	          &parse_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_status",
+	 parse_status,
+	 LIBFWSI_PARSE_STATUS_ITEM_SIZE_OUT_OF_BOUNDS );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 20 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a byte stream that contains more items than the maximum
+	 */
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_set_maximum_number_of_items(
+	          parse_options,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream_with_status(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          parse_options,
+	          &parse_status,
+	          &parse_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "parse_status",
+	 parse_status,
+	 LIBFWSI_PARSE_STATUS_LIMIT_EXCEEDED );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_offset",
+	 parse_offset,
+	 (size_t) 20 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_free(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	/* Test libfwsi_item_list_copy_from_byte_stream_with_status with malloc failing
+	 * at every allocation, including those of the item values readers
+	 */
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_item_list_copy_from_byte_stream_with_status(
+		          item_list,
+		          fwsi_test_item_list_data1,
+		          119,
+		          LIBFWSI_CODEPAGE_WINDOWS_1252,
+		          NULL,
+		          &parse_status,
+		          &parse_offset,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "parse_status",
+			 parse_status,
+			 LIBFWSI_PARSE_STATUS_INSUFFICIENT_MEMORY );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_copy_from_byte_stream_with_status(
+	          NULL,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &parse_status,
+	          &parse_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_copy_from_byte_stream_with_status(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          NULL,
+	          &parse_offset,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_copy_from_byte_stream_with_status(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &parse_status,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_options != NULL )
+	{
+		libfwsi_parse_options_free(
+		 &parse_options,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_validate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_validate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t consumed          = 0;
+	int number_of_items      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          119,
+	          0,
+	          &consumed,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "consumed",
+	 consumed,
+	 (size_t) 119 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_VALIDATE_FLAG_REQUIRE_TERMINATOR | LIBFWSI_VALIDATE_FLAG_STRICT_EXTENSION_BLOCKS,
+	          &consumed,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "consumed",
+	 consumed,
+	 (size_t) 119 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a shell item list without terminator
+	 */
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          117,
+	          0,
+	          &consumed,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "consumed",
+	 consumed,
+	 (size_t) 117 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_items",
+	 number_of_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          117,
+	          LIBFWSI_VALIDATE_FLAG_REQUIRE_TERMINATOR,
+	          &consumed,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a truncated shell item list
+	 */
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          40,
+	          0,
+	          &consumed,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_validate(
+	          NULL,
+	          119,
+	          0,
+	          &consumed,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &consumed,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          119,
+	          0x80000000UL,
+	          &consumed,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          119,
+	          0,
+	          NULL,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_validate(
+	          fwsi_test_item_list_data1,
+	          119,
+	          0,
+	          &consumed,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_data_size(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t data_size               = 0;
+	int data_size_is_set           = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_data_size(
+	          item_list,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( data_size_is_set != 0 )
+	{
+		result = libfwsi_item_list_get_data_size(
+		          item_list,
+		          NULL,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_memory_usage(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t arrays_size             = 0;
+	size_t extension_blocks_size   = 0;
+	size_t strings_size            = 0;
+	size_t structs_size            = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_memory_usage(
+	          item_list,
+	          &structs_size,
+	          &strings_size,
+	          &arrays_size,
+	          &extension_blocks_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_SIZE(
+	 "structs_size",
+	 structs_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "strings_size",
+	 strings_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "extension_blocks_size",
+	 extension_blocks_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_memory_usage(
+	          item_list,
+	          &structs_size,
+	          &strings_size,
+	          &arrays_size,
+	          &extension_blocks_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+	FWSI_TEST_ASSERT_NOT_EQUAL_SIZE(
+	 "strings_size",
+	 strings_size,
+	 (size_t) 0 );
+#endif
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_SIZE(
+	 "arrays_size",
+	 arrays_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_SIZE(
+	 "extension_blocks_size",
+	 extension_blocks_size,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_memory_usage(
+	          NULL,
+	          &structs_size,
+	          &strings_size,
+	          &arrays_size,
+	          &extension_blocks_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_memory_usage(
+	          item_list,
+	          NULL,
+	          &strings_size,
+	          &arrays_size,
+	          &extension_blocks_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_list_get_memory_usage(
+	          item_list,
+	          &structs_size,
+	          &strings_size,
+	          &arrays_size,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_number_of_items function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_number_of_items(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int number_of_items            = 0;
+	int number_of_items_is_set     = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_number_of_items(
+	          item_list,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_items_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_number_of_items(
+	          NULL,
+	          &number_of_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_items_is_set != 0 )
+	{
+		result = libfwsi_item_list_get_number_of_items(
+		          item_list,
+		          NULL,
+		          &error );
+
+		FWSI_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWSI_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_item function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_item(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	libfwsi_item_t *item           = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          0,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item(
+	          item_list,
+	          2,
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_item(
+		          NULL,
+		          0,
+		          &item,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item(
+		          item_list,
+		          -1,
+		          &item,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item(
+		          item_list,
+		          3,
+		          &item,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item(
+		          item_list,
+		          0,
+		          NULL,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_item_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_item_type(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	int item_type                  = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_item_type(
+	          item_list,
+	          0,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER )
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+#else
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_ROOT_FOLDER );
+#endif
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item_type(
+	          item_list,
+	          1,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( LIBFWSI_WITHOUT_VOLUME_PARSER )
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+#else
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_VOLUME );
+#endif
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item_type(
+	          item_list,
+	          2,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+#else
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_FILE_ENTRY );
+#endif
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_item_type(
+		          NULL,
+		          0,
+		          &item_type,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_type(
+		          item_list,
+		          -1,
+		          &item_type,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_type(
+		          item_list,
+		          3,
+		          &item_type,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_type(
+		          item_list,
+		          0,
+		          NULL,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_item_class_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_item_class_type(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	uint8_t class_type             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_item_class_type(
+	          item_list,
+	          0,
+	          &class_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER )
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "class_type",
+	 class_type,
+	 0x00 );
+#else
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "class_type",
+	 class_type,
+	 0x1f );
+#endif
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item_class_type(
+	          item_list,
+	          2,
+	          &class_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER )
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "class_type",
+	 class_type,
+	 0x00 );
+#else
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "class_type",
+	 class_type,
+	 0x32 );
+#endif
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_item_class_type(
+		          NULL,
+		          0,
+		          &class_type,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_class_type(
+		          item_list,
+		          -1,
+		          &class_type,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_class_type(
+		          item_list,
+		          3,
+		          &class_type,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_class_type(
+		          item_list,
+		          0,
+		          NULL,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_item_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_item_signature(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	uint32_t signature             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_item_signature(
+	          item_list,
+	          0,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "signature",
+	 signature,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_item_signature(
+		          NULL,
+		          0,
+		          &signature,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_signature(
+		          item_list,
+		          -1,
+		          &signature,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_signature(
+		          item_list,
+		          3,
+		          &signature,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_signature(
+		          item_list,
+		          0,
+		          NULL,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_item_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_item_data_size(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	size_t data_size               = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_item_data_size(
+	          item_list,
+	          0,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 20 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item_data_size(
+	          item_list,
+	          1,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 25 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_item_data_size(
+	          item_list,
+	          2,
+	          &data_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 72 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_item_data_size(
+		          NULL,
+		          0,
+		          &data_size,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_data_size(
+		          item_list,
+		          -1,
+		          &data_size,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_data_size(
+		          item_list,
+		          3,
+		          &data_size,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_item_data_size(
+		          item_list,
+		          0,
+		          NULL,
+		          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "item_list",
+	 item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_compare(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfwsi_item_list_t *first_item_list  = NULL;
+	libfwsi_item_list_t *second_item_list = NULL;
+	libfwsi_item_list_t *third_item_list  = NULL;
+	libfwsi_item_list_t *fourth_item_list = NULL;
+	libfwsi_item_list_t *fifth_item_list  = NULL;
+	int result                            = 0;
+	uint8_t data[ 119 ];
+	uint8_t unknown_data[ 10 ];
+
+	/* Initialize test
+	 */
+	if( memory_copy(
+	     data,
+	     fwsi_test_item_list_data1,
+	     119 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Change the first character of the file entry name
+	 */
+	data[ 59 ] = (uint8_t) 'x';
+
+	result = libfwsi_item_list_initialize(
+	          &first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "first_item_list",
+	 first_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          first_item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "second_item_list",
+	 second_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          second_item_list,
+	          fwsi_test_item_list_data2,
+	          47,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &third_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "third_item_list",
+	 third_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          third_item_list,
+	          data,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_compare(
+	          first_item_list,
+	          first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_EQUAL );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_compare(
+	          first_item_list,
+	          second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_GREATER );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_compare(
+	          second_item_list,
+	          first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_LESS );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_compare(
+	          first_item_list,
+	          third_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_LESS );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_compare(
+	          third_item_list,
+	          first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_GREATER );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_compare(
+	          third_item_list,
+	          second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_GREATER );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test item lists with unknown shell items that differ in their data
+	 */
+	if( memory_copy(
+	     unknown_data,
+	     fwsi_test_item_list_data4,
+	     10 ) == NULL )
+	{
+		goto on_error;
+	}
+	unknown_data[ 5 ] = 0x04;
+
+	result = libfwsi_item_list_initialize(
+	          &fourth_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "fourth_item_list",
+	 fourth_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          fourth_item_list,
+	          fwsi_test_item_list_data4,
+	          10,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &fifth_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "fifth_item_list",
+	 fifth_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          fifth_item_list,
+	          unknown_data,
+	          10,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_compare(
+	          fourth_item_list,
+	          fifth_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWSI_COMPARE_EQUAL );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &fifth_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "fifth_item_list",
+	 fifth_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &fourth_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "fourth_item_list",
+	 fourth_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_compare(
+	          NULL,
+	          second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_compare(
+	          first_item_list,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "first_item_list",
+	 first_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "second_item_list",
+	 second_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &third_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "third_item_list",
+	 third_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( first_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &first_item_list,
+		 NULL );
+	}
+	if( second_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &second_item_list,
+		 NULL );
+	}
+	if( third_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &third_item_list,
+		 NULL );
+	}
+	if( fourth_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &fourth_item_list,
+		 NULL );
+	}
+	if( fifth_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &fifth_item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_diff function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_diff(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfwsi_item_list_t *first_item_list  = NULL;
+	libfwsi_item_list_t *second_item_list = NULL;
+	libfwsi_item_list_t *third_item_list  = NULL;
+	int first_number_of_differing_items   = 0;
+	int number_of_common_items            = 0;
+	int result                            = 0;
+	int second_number_of_differing_items  = 0;
+	uint8_t data[ 119 ];
+
+	/* Initialize test
+	 */
+	if( memory_copy(
+	     data,
+	     fwsi_test_item_list_data1,
+	     119 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Change the first character of the file entry name
+	 */
+	data[ 59 ] = (uint8_t) 'x';
+
+	result = libfwsi_item_list_initialize(
+	          &first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "first_item_list",
+	 first_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          first_item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "second_item_list",
+	 second_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          second_item_list,
+	          fwsi_test_item_list_data2,
+	          47,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &third_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "third_item_list",
+	 third_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          third_item_list,
+	          data,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_diff(
+	          first_item_list,
+	          first_item_list,
+	          &number_of_common_items,
+	          &first_number_of_differing_items,
+	          &second_number_of_differing_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_common_items",
+	 number_of_common_items,
+	 3 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "first_number_of_differing_items",
+	 first_number_of_differing_items,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "second_number_of_differing_items",
+	 second_number_of_differing_items,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          first_item_list,
+	          second_item_list,
+	          &number_of_common_items,
+	          &first_number_of_differing_items,
+	          &second_number_of_differing_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_common_items",
+	 number_of_common_items,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "first_number_of_differing_items",
+	 first_number_of_differing_items,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "second_number_of_differing_items",
+	 second_number_of_differing_items,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          second_item_list,
+	          third_item_list,
+	          &number_of_common_items,
+	          &first_number_of_differing_items,
+	          &second_number_of_differing_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_common_items",
+	 number_of_common_items,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "first_number_of_differing_items",
+	 first_number_of_differing_items,
+	 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "second_number_of_differing_items",
+	 second_number_of_differing_items,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_diff(
+	          first_item_list,
+	          third_item_list,
+	          &number_of_common_items,
+	          &first_number_of_differing_items,
+	          &second_number_of_differing_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_common_items",
+	 number_of_common_items,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "first_number_of_differing_items",
+	 first_number_of_differing_items,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "second_number_of_differing_items",
+	 second_number_of_differing_items,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_diff(
+	          NULL,
+	          second_item_list,
+	          &number_of_common_items,
+	          &first_number_of_differing_items,
+	          &second_number_of_differing_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_diff(
+	          first_item_list,
+	          NULL,
+	          &number_of_common_items,
+	          &first_number_of_differing_items,
+	          &second_number_of_differing_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_diff(
+	          first_item_list,
+	          second_item_list,
+	          NULL,
+	          &first_number_of_differing_items,
+	          &second_number_of_differing_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_diff(
+	          first_item_list,
+	          second_item_list,
+	          &number_of_common_items,
+	          NULL,
+	          &second_number_of_differing_items,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_diff(
+	          first_item_list,
+	          second_item_list,
+	          &number_of_common_items,
+	          &first_number_of_differing_items,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "first_item_list",
+	 first_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "second_item_list",
+	 second_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &third_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "third_item_list",
+	 third_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( first_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &first_item_list,
+		 NULL );
+	}
+	if( second_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &second_item_list,
+		 NULL );
+	}
+	if( third_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &third_item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_list_get_prefix_fingerprint function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_list_get_prefix_fingerprint(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfwsi_item_list_t *first_item_list  = NULL;
+	libfwsi_item_list_t *second_item_list = NULL;
+	uint64_t first_fingerprint            = 0;
+	uint64_t second_fingerprint           = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "first_item_list",
+	 first_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          first_item_list,
+	          fwsi_test_item_list_data1,
+	          119,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_initialize(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "second_item_list",
+	 second_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          second_item_list,
+	          fwsi_test_item_list_data2,
+	          47,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_list_get_prefix_fingerprint(
+	          first_item_list,
+	          0,
+	          &first_fingerprint,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "first_fingerprint",
+	 first_fingerprint,
+	 (uint64_t) 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_prefix_fingerprint(
+	          first_item_list,
+	          2,
+	          &first_fingerprint,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_prefix_fingerprint(
+	          second_item_list,
+	          2,
+	          &second_fingerprint,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "first_fingerprint",
+	 first_fingerprint,
+	 second_fingerprint );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_get_prefix_fingerprint(
+	          first_item_list,
+	          3,
+	          &first_fingerprint,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "first_fingerprint",
+	 (int64_t) first_fingerprint,
+	 (int64_t) second_fingerprint );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_list_get_prefix_fingerprint(
+	          NULL,
+	          0,
+	          &first_fingerprint,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_prefix_fingerprint(
+	          first_item_list,
+	          -1,
+	          &first_fingerprint,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_prefix_fingerprint(
+	          first_item_list,
+	          4,
+	          &first_fingerprint,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+
+	result = libfwsi_item_list_get_prefix_fingerprint(
+	          first_item_list,
+	          0,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_item_list_free(
+	          &first_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "first_item_list",
+	 first_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "second_item_list",
+	 second_item_list );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( first_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &first_item_list,
+		 NULL );
+	}
+	if( second_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &second_item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
 int main(
      int argc FWSI_TEST_ATTRIBUTE_UNUSED,
      char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
@@ -535,17 +4646,69 @@ int main(
 	 "libfwsi_item_list_free",
 	 fwsi_test_item_list_free );
 
-	/* TODO: add tests for libfwsi_item_list_copy_from_byte_stream */
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_retain",
+	 fwsi_test_item_list_retain );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream",
+	 fwsi_test_item_list_copy_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream_with_options",
+	 fwsi_test_item_list_copy_from_byte_stream_with_options );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_copy_from_byte_stream_with_status",
+	 fwsi_test_item_list_copy_from_byte_stream_with_status );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_validate",
+	 fwsi_test_item_list_validate );
 
 	FWSI_TEST_RUN(
 	 "libfwsi_item_list_get_data_size",
 	 fwsi_test_item_list_get_data_size );
 
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_memory_usage",
+	 fwsi_test_item_list_get_memory_usage );
+
 	FWSI_TEST_RUN(
 	 "libfwsi_item_list_get_number_of_items",
 	 fwsi_test_item_list_get_number_of_items );
 
-	/* TODO: add tests for libfwsi_item_list_get_item */
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_item",
+	 fwsi_test_item_list_get_item );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_item_type",
+	 fwsi_test_item_list_get_item_type );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_item_class_type",
+	 fwsi_test_item_list_get_item_class_type );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_item_signature",
+	 fwsi_test_item_list_get_item_signature );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_item_data_size",
+	 fwsi_test_item_list_get_item_data_size );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_compare",
+	 fwsi_test_item_list_compare );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_diff",
+	 fwsi_test_item_list_diff );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_list_get_prefix_fingerprint",
+	 fwsi_test_item_list_get_prefix_fingerprint );
 
 	return( EXIT_SUCCESS );
 
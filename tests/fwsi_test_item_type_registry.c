@@ -0,0 +1,658 @@
+/*
+ * Library item type registry functions test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_item_type_registry.h"
+
+uint8_t fwsi_test_item_type_registry_root_folder_data1[ 20 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d };
+
+uint8_t fwsi_test_item_type_registry_volume_data1[ 25 ] = {
+	0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The user defined test values
+ */
+typedef struct fwsi_test_item_type_registry_values fwsi_test_item_type_registry_values_t;
+
+struct fwsi_test_item_type_registry_values
+{
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+/* Matches items with class type 0x2f
+ * Returns 1 if match, 0 if not or -1 on error
+ */
+int fwsi_test_item_type_registry_match(
+     const uint8_t *data,
+     size_t data_size,
+     libfwsi_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( data_size >= 3 )
+	 && ( data[ 2 ] == 0x2f ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Creates user defined test values
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_item_type_registry_values_initialize(
+     intptr_t **values,
+     libfwsi_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	*values = (intptr_t *) calloc(
+	                        1,
+	                        sizeof( fwsi_test_item_type_registry_values_t ) );
+
+	if( *values == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads user defined test values
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_item_type_registry_values_read(
+     intptr_t *values,
+     const uint8_t *data FWSI_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size,
+     int ascii_codepage FWSI_TEST_ATTRIBUTE_UNUSED,
+     libfwsi_parse_options_t *parse_options FWSI_TEST_ATTRIBUTE_UNUSED,
+     libfwsi_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( data )
+	FWSI_TEST_UNREFERENCED_PARAMETER( ascii_codepage )
+	FWSI_TEST_UNREFERENCED_PARAMETER( parse_options )
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	( (fwsi_test_item_type_registry_values_t *) values )->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Frees user defined test values
+ * Returns 1 if successful or -1 on error
+ */
+int fwsi_test_item_type_registry_values_free(
+     intptr_t **values,
+     libfwsi_error_t **error FWSI_TEST_ATTRIBUTE_UNUSED )
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( error )
+
+	free(
+	 *values );
+
+	*values = NULL;
+
+	return( 1 );
+}
+
+/* Tests the libfwsi_register_item_type and libfwsi_unregister_item_type functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_register_item_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwsi_item_t *item     = NULL;
+	intptr_t *values         = NULL;
+	int item_type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_register_item_type(
+	          LIBFWSI_ITEM_TYPE_USER_DEFINED,
+	          &fwsi_test_item_type_registry_match,
+	          sizeof( fwsi_test_item_type_registry_values_t ),
+	          &fwsi_test_item_type_registry_values_initialize,
+	          &fwsi_test_item_type_registry_values_read,
+	          &fwsi_test_item_type_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_initialize(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "item",
+	 item );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_copy_from_byte_stream(
+	          item,
+	          fwsi_test_item_type_registry_volume_data1,
+	          25,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_type(
+	          item,
+	          &item_type,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_USER_DEFINED );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_get_user_defined_values(
+	          item,
+	          &values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "values",
+	 values );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "values->data_size",
+	 ( (fwsi_test_item_type_registry_values_t *) values )->data_size,
+	 (size_t) 25 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_free(
+	          &item,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_register_item_type(
+	          LIBFWSI_ITEM_TYPE_USER_DEFINED,
+	          &fwsi_test_item_type_registry_match,
+	          sizeof( fwsi_test_item_type_registry_values_t ),
+	          &fwsi_test_item_type_registry_values_initialize,
+	          &fwsi_test_item_type_registry_values_read,
+	          &fwsi_test_item_type_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_register_item_type(
+	          LIBFWSI_ITEM_TYPE_VOLUME,
+	          &fwsi_test_item_type_registry_match,
+	          sizeof( fwsi_test_item_type_registry_values_t ),
+	          &fwsi_test_item_type_registry_values_initialize,
+	          &fwsi_test_item_type_registry_values_read,
+	          &fwsi_test_item_type_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_register_item_type(
+	          LIBFWSI_ITEM_TYPE_USER_DEFINED + 1,
+	          NULL,
+	          sizeof( fwsi_test_item_type_registry_values_t ),
+	          &fwsi_test_item_type_registry_values_initialize,
+	          &fwsi_test_item_type_registry_values_read,
+	          &fwsi_test_item_type_registry_values_free,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_unregister_item_type(
+	          LIBFWSI_ITEM_TYPE_USER_DEFINED,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_unregister_item_type(
+	          LIBFWSI_ITEM_TYPE_USER_DEFINED,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libfwsi_item_free(
+		 &item,
+		 NULL );
+	}
+	libfwsi_unregister_item_type(
+	 LIBFWSI_ITEM_TYPE_USER_DEFINED,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_item_type_registry_classify function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_type_registry_classify(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t signature       = 0;
+	uint8_t class_type       = 0;
+	int item_type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_type_registry_classify(
+	          fwsi_test_item_type_registry_root_folder_data1,
+	          20,
+	          &item_type,
+	          &class_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( LIBFWSI_WITHOUT_ROOT_FOLDER_PARSER )
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+#else
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_ROOT_FOLDER );
+#endif
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "class_type",
+	 class_type,
+	 0x1f );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_type_registry_classify(
+	          fwsi_test_item_type_registry_volume_data1,
+	          25,
+	          &item_type,
+	          &class_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( LIBFWSI_WITHOUT_VOLUME_PARSER )
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_UNKNOWN );
+#else
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_type",
+	 item_type,
+	 LIBFWSI_ITEM_TYPE_VOLUME );
+#endif
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "class_type",
+	 class_type,
+	 0x2f );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_type_registry_classify(
+	          NULL,
+	          20,
+	          &item_type,
+	          &class_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_type_registry_classify(
+	          fwsi_test_item_type_registry_root_folder_data1,
+	          2,
+	          &item_type,
+	          &class_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_item_type_registry_classify(
+	          fwsi_test_item_type_registry_root_folder_data1,
+	          20,
+	          NULL,
+	          &class_type,
+	          &signature,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_item_type_registry_get_definition function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_item_type_registry_get_definition(
+     void )
+{
+	const libfwsi_item_type_definition_t *definition = NULL;
+	libcerror_error_t *error                         = NULL;
+	int result                                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_item_type_registry_get_definition(
+	          LIBFWSI_ITEM_TYPE_VOLUME,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &definition,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( LIBFWSI_WITHOUT_VOLUME_PARSER )
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "definition",
+	 definition );
+#else
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "definition",
+	 definition );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "definition->item_type",
+	 definition->item_type,
+	 LIBFWSI_ITEM_TYPE_VOLUME );
+#endif
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_type_registry_get_definition(
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          &definition,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "definition",
+	 definition );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_item_type_registry_get_definition(
+	          LIBFWSI_ITEM_TYPE_VOLUME,
+	          LIBFWSI_ITEM_TYPE_UNKNOWN,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_register_item_type",
+	 fwsi_test_register_item_type );
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_type_registry_classify",
+	 fwsi_test_item_type_registry_classify );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_item_type_registry_get_definition",
+	 fwsi_test_item_type_registry_get_definition );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -317,6 +317,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER )
+
 /* Tests the libfwsi_mtp_file_entry_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -352,6 +354,7 @@ int fwsi_test_mtp_file_entry_values_read_data(
 	          mtp_file_entry_values,
 	          fwsi_test_mtp_file_entry_values_data1,
 	          710,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -369,6 +372,7 @@ int fwsi_test_mtp_file_entry_values_read_data(
 	          NULL,
 	          fwsi_test_mtp_file_entry_values_data1,
 	          710,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -387,6 +391,7 @@ int fwsi_test_mtp_file_entry_values_read_data(
 	          mtp_file_entry_values,
 	          NULL,
 	          710,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -405,6 +410,7 @@ int fwsi_test_mtp_file_entry_values_read_data(
 	          mtp_file_entry_values,
 	          fwsi_test_mtp_file_entry_values_data1,
 	          (size_t) SSIZE_MAX + 1,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -455,6 +461,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -482,10 +490,14 @@ int main(
 	 "libfwsi_mtp_file_entry_values_free",
 	 fwsi_test_mtp_file_entry_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_mtp_file_entry_values_read_data",
 	 fwsi_test_mtp_file_entry_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
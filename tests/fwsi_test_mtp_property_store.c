@@ -0,0 +1,739 @@
+/*
+ * Library mtp_property_store type test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_mtp_property_store.h"
+
+/* Unknown, class identifier and number of properties, followed by a 32-bit integer property,
+ * a string property and a truncated property
+ */
+uint8_t fwsi_test_mtp_property_store_data1[ 112 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x03, 0x00, 0x00, 0x00, 0x7a, 0x05, 0xa3, 0x01, 0xd6, 0x74, 0x80, 0x4e,
+	0xbe, 0xa7, 0xdc, 0x4c, 0x21, 0x2c, 0xe5, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+	0x2a, 0x00, 0x00, 0x00, 0x7a, 0x05, 0xa3, 0x01, 0xd6, 0x74, 0x80, 0x4e, 0xbe, 0xa7, 0xdc, 0x4c,
+	0x21, 0x2c, 0xe5, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x61, 0x00, 0x62, 0x00, 0x00, 0x00, 0x7a, 0x05, 0xa3, 0x01, 0xd6, 0x74, 0x80, 0x4e, 0xbe, 0xa7,
+	0xdc, 0x4c, 0x21, 0x2c, 0xe5, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x2a, 0x00 };
+
+/* The property set identifier of the properties in the test data
+ */
+uint8_t fwsi_test_mtp_property_store_set_identifier1[ 16 ] = {
+	0x7a, 0x05, 0xa3, 0x01, 0xd6, 0x74, 0x80, 0x4e, 0xbe, 0xa7, 0xdc, 0x4c, 0x21, 0x2c, 0xe5, 0x0a };
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_mtp_property_store_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_mtp_property_store_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 1;
+	int number_of_memset_fail_tests              = 1;
+	int test_number                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwsi_mtp_property_store_initialize(
+	          &property_store,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "property_store",
+	 property_store );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_mtp_property_store_free(
+	          &property_store,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "property_store",
+	 property_store );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_mtp_property_store_initialize(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	property_store = (libfwsi_mtp_property_store_t *) 0x12345678UL;
+
+	result = libfwsi_mtp_property_store_initialize(
+	          &property_store,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	property_store = NULL;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_mtp_property_store_initialize with malloc failing
+		 */
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_mtp_property_store_initialize(
+		          &property_store,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+
+			if( property_store != NULL )
+			{
+				libfwsi_mtp_property_store_free(
+				 &property_store,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "property_store",
+			 property_store );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_mtp_property_store_initialize with memset failing
+		 */
+		fwsi_test_memset_attempts_before_fail = test_number;
+
+		result = libfwsi_mtp_property_store_initialize(
+		          &property_store,
+		          &error );
+
+		if( fwsi_test_memset_attempts_before_fail != -1 )
+		{
+			fwsi_test_memset_attempts_before_fail = -1;
+
+			if( property_store != NULL )
+			{
+				libfwsi_mtp_property_store_free(
+				 &property_store,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "property_store",
+			 property_store );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( property_store != NULL )
+	{
+		libfwsi_mtp_property_store_free(
+		 &property_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_mtp_property_store_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_mtp_property_store_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_mtp_property_store_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) || !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
+/* Tests the libfwsi_mtp_property_store_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_mtp_property_store_read_data(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libfwsi_mtp_property_store_t *property_store = NULL;
+	libfwsi_mtp_property_t *property             = NULL;
+	libfwsi_parse_options_t *parse_options       = NULL;
+	int number_of_properties                     = 0;
+	int property_index                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_mtp_property_store_initialize(
+	          &property_store,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "property_store",
+	 property_store );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_mtp_property_store_read_data(
+	          property_store,
+	          fwsi_test_mtp_property_store_data1,
+	          112,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_mtp_property_store_get_number_of_properties(
+	          property_store,
+	          &number_of_properties,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_properties",
+	 number_of_properties,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_mtp_property_store_get_property_by_index(
+	          property_store,
+	          1,
+	          &property,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "property",
+	 property );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "property->identifier",
+	 property->identifier,
+	 (uint32_t) 3 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "property->value_type",
+	 property->value_type,
+	 (uint32_t) 0x1f );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "property->value_data_size",
+	 property->value_data_size,
+	 (uint32_t) 6 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_mtp_property_store_get_index_by_identifier(
+	          property_store,
+	          fwsi_test_mtp_property_store_set_identifier1,
+	          16,
+	          3,
+	          &property_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "property_index",
+	 property_index,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_mtp_property_store_get_index_by_identifier(
+	          property_store,
+	          fwsi_test_mtp_property_store_set_identifier1,
+	          16,
+	          4,
+	          &property_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_mtp_property_store_read_data(
+	          property_store,
+	          fwsi_test_mtp_property_store_data1,
+	          112,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_mtp_property_store_get_property_by_index(
+	          property_store,
+	          2,
+	          &property,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_mtp_property_store_get_index_by_identifier(
+	          property_store,
+	          fwsi_test_mtp_property_store_set_identifier1,
+	          8,
+	          3,
+	          &property_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_mtp_property_store_free(
+	          &property_store,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "property_store",
+	 property_store );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfwsi_mtp_property_store_initialize(
+	          &property_store,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_mtp_property_store_read_data(
+	          NULL,
+	          fwsi_test_mtp_property_store_data1,
+	          112,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_mtp_property_store_read_data(
+	          property_store,
+	          NULL,
+	          112,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_mtp_property_store_read_data(
+	          property_store,
+	          fwsi_test_mtp_property_store_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with the number of properties exceeding the maximum
+	 */
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_set_maximum_number_of_properties(
+	          parse_options,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_mtp_property_store_read_data(
+	          property_store,
+	          fwsi_test_mtp_property_store_data1,
+	          112,
+	          (libfwsi_internal_parse_options_t *) parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "limit_exceeded",
+	 ( (libfwsi_internal_parse_options_t *) parse_options )->limit_exceeded,
+	 1 );
+
+	result = libfwsi_parse_options_free(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwsi_mtp_property_store_free(
+	          &property_store,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "property_store",
+	 property_store );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_options != NULL )
+	{
+		libfwsi_parse_options_free(
+		 &parse_options,
+		 NULL );
+	}
+	if( property_store != NULL )
+	{
+		libfwsi_mtp_property_store_free(
+		 &property_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) || !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_mtp_property_store_initialize",
+	 fwsi_test_mtp_property_store_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_mtp_property_store_free",
+	 fwsi_test_mtp_property_store_free );
+
+#if !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) || !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_mtp_property_store_read_data",
+	 fwsi_test_mtp_property_store_read_data );
+
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_FILE_ENTRY_PARSER ) || !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -352,6 +352,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
 /* Tests the libfwsi_mtp_volume_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -387,6 +389,7 @@ int fwsi_test_mtp_volume_values_read_data(
 	          mtp_volume_values,
 	          fwsi_test_mtp_volume_values_data1,
 	          1278,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -398,12 +401,37 @@ int fwsi_test_mtp_volume_values_read_data(
 	 "error",
 	 error );
 
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "mtp_volume_values->storage_name_size",
+	 mtp_volume_values->storage_name_size,
+	 (size_t) 16 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "mtp_volume_values->volume_identifier_size",
+	 mtp_volume_values->volume_identifier_size,
+	 (size_t) 80 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "mtp_volume_values->file_system_name_size",
+	 mtp_volume_values->file_system_name_size,
+	 (size_t) 42 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "mtp_volume_values->property_store",
+	 mtp_volume_values->property_store );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "mtp_volume_values->property_store->number_of_properties",
+	 mtp_volume_values->property_store->number_of_properties,
+	 15 );
+
 	/* Test error cases
 	 */
 	result = libfwsi_mtp_volume_values_read_data(
 	          NULL,
 	          fwsi_test_mtp_volume_values_data1,
 	          1278,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -422,6 +450,7 @@ int fwsi_test_mtp_volume_values_read_data(
 	          mtp_volume_values,
 	          NULL,
 	          1278,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -440,6 +469,7 @@ int fwsi_test_mtp_volume_values_read_data(
 	          mtp_volume_values,
 	          fwsi_test_mtp_volume_values_data1,
 	          (size_t) SSIZE_MAX + 1,
+	          NULL,
 	          &error );
 
 	FWSI_TEST_ASSERT_EQUAL_INT(
@@ -490,6 +520,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -517,10 +549,14 @@ int main(
 	 "libfwsi_mtp_volume_values_free",
 	 fwsi_test_mtp_volume_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_mtp_volume_values_read_data",
 	 fwsi_test_mtp_volume_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_MTP_VOLUME_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1815 @@
+/*
+ * Library name_search type test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+/* Shell item list of a root folder, volume and file entry item,
+ * where the file entry item has the name wordpad.exe and
+ * its file entry extension block the long name powershell.exe
+ */
+uint8_t fwsi_test_name_search_data1[ 143 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x32,
+	0x00, 0x00, 0x46, 0x03, 0x00, 0x04, 0x31, 0x00, 0x68, 0x20, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x70,
+	0x61, 0x64, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x46, 0x00, 0x07, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xe8,
+	0x38, 0x6f, 0x0b, 0xe8, 0x38, 0x6f, 0x0b, 0x26, 0x00, 0x00, 0x00, 0x58, 0xe8, 0x00, 0x00, 0x00,
+	0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x6f,
+	0x00, 0x77, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c,
+	0x00, 0x2e, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* Shell item list of a root folder, volume and file entry item,
+ * where the file entry item has the name wordpad.exe and
+ * its file entry extension block the long name powershell.exe with
+ * the o, e and s replaced by U+0141, U+011A and U+0179
+ */
+uint8_t fwsi_test_name_search_data2[ 143 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x32,
+	0x00, 0x00, 0x46, 0x03, 0x00, 0x04, 0x31, 0x00, 0x68, 0x20, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x70,
+	0x61, 0x64, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x46, 0x00, 0x07, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xe8,
+	0x38, 0x6f, 0x0b, 0xe8, 0x38, 0x6f, 0x0b, 0x26, 0x00, 0x00, 0x00, 0x58, 0xe8, 0x00, 0x00, 0x00,
+	0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x41,
+	0x01, 0x77, 0x00, 0x1a, 0x01, 0x72, 0x00, 0x79, 0x01, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c,
+	0x00, 0x2e, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_name_search_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_name_search_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfwsi_name_search_t *name_search = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 3;
+	int number_of_memset_fail_tests    = 2;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "*.exe",
+	          5,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "name_search",
+	 name_search );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "name_search",
+	 name_search );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_name_search_initialize(
+	          NULL,
+	          (uint8_t *) "*.exe",
+	          5,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_search = (libfwsi_name_search_t *) 0x12345678UL;
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "*.exe",
+	          5,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_search = NULL;
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          NULL,
+	          5,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "*.exe",
+	          5,
+	          -1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_name_search_initialize with malloc failing
+		 */
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_name_search_initialize(
+		          &name_search,
+		          (uint8_t *) "*.exe",
+		          5,
+		          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+
+			if( name_search != NULL )
+			{
+				libfwsi_name_search_free(
+				 &name_search,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "name_search",
+			 name_search );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_name_search_initialize with memset failing
+		 */
+		fwsi_test_memset_attempts_before_fail = test_number;
+
+		result = libfwsi_name_search_initialize(
+		          &name_search,
+		          (uint8_t *) "*.exe",
+		          5,
+		          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+		          &error );
+
+		if( fwsi_test_memset_attempts_before_fail != -1 )
+		{
+			fwsi_test_memset_attempts_before_fail = -1;
+
+			if( name_search != NULL )
+			{
+				libfwsi_name_search_free(
+				 &name_search,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "name_search",
+			 name_search );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_search != NULL )
+	{
+		libfwsi_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_name_search_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_name_search_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_name_search_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+/* Tests the libfwsi_name_search_append_item_list function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_name_search_append_item_list(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfwsi_item_list_t *item_list        = NULL;
+	libfwsi_item_list_t *second_item_list = NULL;
+	libfwsi_name_search_t *name_search    = NULL;
+	int item_index                        = 0;
+	int list_identifier                   = 0;
+	int number_of_hits                    = 0;
+	int result                            = 0;
+	uint8_t hit_flags                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_name_search_data1,
+	          143,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "WordPad.EXE",
+	          11,
+	          LIBFWSI_NAME_PATTERN_TYPE_LITERAL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hit_flags",
+	 hit_flags,
+	 LIBFWSI_NAME_SEARCH_HIT_FLAG_NAME );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "wordpad",
+	          7,
+	          LIBFWSI_NAME_PATTERN_TYPE_LITERAL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "notepad.exe",
+	          11,
+	          LIBFWSI_NAME_PATTERN_TYPE_LITERAL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "WORD",
+	          4,
+	          LIBFWSI_NAME_PATTERN_TYPE_PREFIX,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hit_flags",
+	 hit_flags,
+	 LIBFWSI_NAME_SEARCH_HIT_FLAG_NAME );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "PowerShell.exe",
+	          14,
+	          LIBFWSI_NAME_PATTERN_TYPE_LITERAL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hit_flags",
+	 hit_flags,
+	 LIBFWSI_NAME_SEARCH_HIT_FLAG_LONG_NAME );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "POWERSHELL",
+	          10,
+	          LIBFWSI_NAME_PATTERN_TYPE_PREFIX,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hit_flags",
+	 hit_flags,
+	 LIBFWSI_NAME_SEARCH_HIT_FLAG_LONG_NAME );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "powershelx",
+	          10,
+	          LIBFWSI_NAME_PATTERN_TYPE_PREFIX,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "*.EXE",
+	          5,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hit_flags",
+	 hit_flags,
+	 ( LIBFWSI_NAME_SEARCH_HIT_FLAG_NAME | LIBFWSI_NAME_SEARCH_HIT_FLAG_LONG_NAME ) );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "w?rdpad.*",
+	          9,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hit_flags",
+	 hit_flags,
+	 LIBFWSI_NAME_SEARCH_HIT_FLAG_NAME );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "*shell?exe",
+	          10,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hit_flags",
+	 hit_flags,
+	 LIBFWSI_NAME_SEARCH_HIT_FLAG_LONG_NAME );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "*.dll",
+	          5,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test case folding of Latin Extended-A characters
+	 */
+	result = libfwsi_item_list_initialize(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          second_item_list,
+	          fwsi_test_name_search_data2,
+	          143,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "p\xc5\x82w\xc4\x9br\xc5\xbahell.EXE",
+	          17,
+	          LIBFWSI_NAME_PATTERN_TYPE_LITERAL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          second_item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "hit_flags",
+	 hit_flags,
+	 LIBFWSI_NAME_SEARCH_HIT_FLAG_LONG_NAME );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &second_item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_initialize(
+	          &name_search,
+	          (uint8_t *) "*.exe",
+	          5,
+	          LIBFWSI_NAME_PATTERN_TYPE_GLOB,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          item_list,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_hits",
+	 number_of_hits,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          1,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_name_search_append_item_list(
+	          NULL,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_append_item_list(
+	          name_search,
+	          NULL,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          NULL,
+	          &number_of_hits,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_get_number_of_hits(
+	          name_search,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          NULL,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          -1,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          2,
+	          &list_identifier,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          NULL,
+	          &item_index,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          NULL,
+	          &hit_flags,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_name_search_get_hit_by_index(
+	          name_search,
+	          0,
+	          &list_identifier,
+	          &item_index,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_name_search_free(
+	          &name_search,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_search != NULL )
+	{
+		libfwsi_name_search_free(
+		 &name_search,
+		 NULL );
+	}
+	if( second_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &second_item_list,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_name_search_initialize",
+	 fwsi_test_name_search_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_name_search_free",
+	 fwsi_test_name_search_free );
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_name_search_append_item_list",
+	 fwsi_test_name_search_append_item_list );
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -274,6 +274,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER )
+
 /* Tests the libfwsi_network_location_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -418,6 +420,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -445,10 +449,14 @@ int main(
 	 "libfwsi_network_location_values_free",
 	 fwsi_test_network_location_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_network_location_values_read_data",
 	 fwsi_test_network_location_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_NETWORK_LOCATION_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
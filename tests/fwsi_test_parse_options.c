@@ -0,0 +1,628 @@
+/*
+ * Library parse_options type test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+/* Tests the libfwsi_parse_options_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_parse_options_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_parse_options_t *parse_options = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_parse_options_free(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_parse_options_initialize(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parse_options = (libfwsi_parse_options_t *) 0x12345678UL;
+
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	parse_options = NULL;
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_options != NULL )
+	{
+		libfwsi_parse_options_free(
+		 &parse_options,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_parse_options_set_maximum_number_of_items function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_parse_options_set_maximum_number_of_items(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_parse_options_t *parse_options = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_parse_options_set_maximum_number_of_items(
+	          parse_options,
+	          16,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_parse_options_set_maximum_number_of_items(
+	          NULL,
+	          16,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_parse_options_set_maximum_number_of_items(
+	          parse_options,
+	          -1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_parse_options_free(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_options != NULL )
+	{
+		libfwsi_parse_options_free(
+		 &parse_options,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_parse_options_set_maximum_number_of_extension_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_parse_options_set_maximum_number_of_extension_blocks(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_parse_options_t *parse_options = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_parse_options_set_maximum_number_of_extension_blocks(
+	          parse_options,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_parse_options_set_maximum_number_of_extension_blocks(
+	          NULL,
+	          4,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_parse_options_set_maximum_number_of_extension_blocks(
+	          parse_options,
+	          -1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_parse_options_free(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_options != NULL )
+	{
+		libfwsi_parse_options_free(
+		 &parse_options,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_parse_options_set_maximum_number_of_properties function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_parse_options_set_maximum_number_of_properties(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_parse_options_t *parse_options = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_parse_options_set_maximum_number_of_properties(
+	          parse_options,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_parse_options_set_maximum_number_of_properties(
+	          NULL,
+	          64,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_parse_options_free(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_options != NULL )
+	{
+		libfwsi_parse_options_free(
+		 &parse_options,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_parse_options_set_maximum_allocation_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_parse_options_set_maximum_allocation_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfwsi_parse_options_t *parse_options = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_parse_options_initialize(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_parse_options_set_maximum_allocation_size(
+	          parse_options,
+	          65536,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_parse_options_set_maximum_allocation_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_parse_options_set_maximum_allocation_size(
+	          parse_options,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_parse_options_free(
+	          &parse_options,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "parse_options",
+	 parse_options );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_options != NULL )
+	{
+		libfwsi_parse_options_free(
+		 &parse_options,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_parse_options_initialize",
+	 fwsi_test_parse_options_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_parse_options_set_maximum_number_of_items",
+	 fwsi_test_parse_options_set_maximum_number_of_items );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_parse_options_set_maximum_number_of_extension_blocks",
+	 fwsi_test_parse_options_set_maximum_number_of_extension_blocks );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_parse_options_set_maximum_number_of_properties",
+	 fwsi_test_parse_options_set_maximum_number_of_properties );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_parse_options_set_maximum_allocation_size",
+	 fwsi_test_parse_options_set_maximum_allocation_size );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
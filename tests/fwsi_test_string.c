@@ -0,0 +1,736 @@
+/*
+ * Library string functions test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_string.h"
+
+/* "Privet" in Windows 1251
+ */
+uint8_t fwsi_test_string_byte_stream1[ 7 ] = {
+	0xcf, 0xf0, 0xe8, 0xe2, 0xe5, 0xf2, 0x00 };
+
+uint8_t fwsi_test_string_utf8_string1[ 13 ] = {
+	0xd0, 0x9f, 0xd1, 0x80, 0xd0, 0xb8, 0xd0, 0xb2, 0xd0, 0xb5, 0xd1, 0x82, 0x00 };
+
+uint16_t fwsi_test_string_utf16_string1[ 7 ] = {
+	0x041f, 0x0440, 0x0438, 0x0432, 0x0435, 0x0442, 0x0000 };
+
+/* "Documents Nihon" in Windows 932
+ */
+uint8_t fwsi_test_string_byte_stream2[ 15 ] = {
+	0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0x93, 0xfa, 0x96, 0x7b, 0x00 };
+
+uint8_t fwsi_test_string_utf8_string2[ 17 ] = {
+	0x44, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x20, 0xe6, 0x97, 0xa5, 0xe6, 0x9c, 0xac,
+	0x00 };
+
+uint16_t fwsi_test_string_utf16_string2[ 13 ] = {
+	0x0044, 0x006f, 0x0063, 0x0075, 0x006d, 0x0065, 0x006e, 0x0074, 0x0073, 0x0020, 0x65e5, 0x672c,
+	0x0000 };
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_string_utf8_size_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_utf8_size_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_string_utf8_size_from_byte_stream(
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 13 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a double byte codepage
+	 */
+	result = libfwsi_string_utf8_size_from_byte_stream(
+	          fwsi_test_string_byte_stream2,
+	          15,
+	          LIBFWSI_CODEPAGE_WINDOWS_932,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 17 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a double byte codepage with a truncated lead byte
+	 */
+	result = libfwsi_string_utf8_size_from_byte_stream(
+	          fwsi_test_string_byte_stream2,
+	          13,
+	          LIBFWSI_CODEPAGE_WINDOWS_932,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 17 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a byte stream without end-of-string character
+	 */
+	result = libfwsi_string_utf8_size_from_byte_stream(
+	          fwsi_test_string_byte_stream1,
+	          6,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 13 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_string_utf8_size_from_byte_stream(
+	          NULL,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_utf8_size_from_byte_stream(
+	          fwsi_test_string_byte_stream1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &utf8_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_utf8_size_from_byte_stream(
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_utf8_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_utf8_copy_from_byte_stream(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_string_utf8_copy_from_byte_stream(
+	          utf8_string,
+	          32,
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          fwsi_test_string_utf8_string1,
+	          13 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a double byte codepage
+	 */
+	result = libfwsi_string_utf8_copy_from_byte_stream(
+	          utf8_string,
+	          17,
+	          fwsi_test_string_byte_stream2,
+	          15,
+	          LIBFWSI_CODEPAGE_WINDOWS_932,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          fwsi_test_string_utf8_string2,
+	          17 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a double byte codepage with UTF-8 string too small
+	 */
+	result = libfwsi_string_utf8_copy_from_byte_stream(
+	          utf8_string,
+	          15,
+	          fwsi_test_string_byte_stream2,
+	          15,
+	          LIBFWSI_CODEPAGE_WINDOWS_932,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_string_utf8_copy_from_byte_stream(
+	          NULL,
+	          16,
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_utf8_copy_from_byte_stream(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_utf8_copy_from_byte_stream(
+	          utf8_string,
+	          32,
+	          NULL,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test UTF-8 string too small
+	 */
+	result = libfwsi_string_utf8_copy_from_byte_stream(
+	          utf8_string,
+	          11,
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_utf8_copy_from_byte_stream(
+	          utf8_string,
+	          12,
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_utf16_size_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_utf16_size_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_string_utf16_size_from_byte_stream(
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &utf16_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 7 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a double byte codepage
+	 */
+	result = libfwsi_string_utf16_size_from_byte_stream(
+	          fwsi_test_string_byte_stream2,
+	          15,
+	          LIBFWSI_CODEPAGE_WINDOWS_932,
+	          &utf16_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 13 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_string_utf16_size_from_byte_stream(
+	          NULL,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &utf16_string_size,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_utf16_size_from_byte_stream(
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_string_utf16_copy_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_string_utf16_copy_from_byte_stream(
+     void )
+{
+	uint16_t utf16_string[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwsi_string_utf16_copy_from_byte_stream(
+	          utf16_string,
+	          16,
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          fwsi_test_string_utf16_string1,
+	          sizeof( uint16_t ) * 7 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a double byte codepage
+	 */
+	result = libfwsi_string_utf16_copy_from_byte_stream(
+	          utf16_string,
+	          16,
+	          fwsi_test_string_byte_stream2,
+	          15,
+	          LIBFWSI_CODEPAGE_WINDOWS_932,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          fwsi_test_string_utf16_string2,
+	          sizeof( uint16_t ) * 13 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwsi_string_utf16_copy_from_byte_stream(
+	          NULL,
+	          16,
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_string_utf16_copy_from_byte_stream(
+	          utf16_string,
+	          16,
+	          NULL,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test UTF-16 string too small
+	 */
+	result = libfwsi_string_utf16_copy_from_byte_stream(
+	          utf16_string,
+	          6,
+	          fwsi_test_string_byte_stream1,
+	          7,
+	          LIBFWSI_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_utf8_size_from_byte_stream",
+	 fwsi_test_string_utf8_size_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_utf8_copy_from_byte_stream",
+	 fwsi_test_string_utf8_copy_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_utf16_size_from_byte_stream",
+	 fwsi_test_string_utf16_size_from_byte_stream );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_string_utf16_copy_from_byte_stream",
+	 fwsi_test_string_utf16_copy_from_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1052 @@
+/*
+ * Library timeline type test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+#include "../libfwsi/libfwsi_timeline.h"
+
+/* Shell item list of a root folder, volume and file entry item, where the file entry item
+ * has a modification time of Aug 4, 2004 13:00:00 and its file entry extension block
+ * a creation and access time of Jul 8, 2008 01:27:30
+ */
+uint8_t fwsi_test_timeline_data1[ 143 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x32,
+	0x00, 0x00, 0x46, 0x03, 0x00, 0x04, 0x31, 0x00, 0x68, 0x20, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x70,
+	0x61, 0x64, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x46, 0x00, 0x07, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xe8,
+	0x38, 0x6f, 0x0b, 0xe8, 0x38, 0x6f, 0x0b, 0x26, 0x00, 0x00, 0x00, 0x58, 0xe8, 0x00, 0x00, 0x00,
+	0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x6f,
+	0x00, 0x77, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c,
+	0x00, 0x2e, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwsi_timeline_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_timeline_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfwsi_timeline_t *timeline = NULL;
+	int result                   = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwsi_timeline_initialize(
+	          &timeline,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline",
+	 timeline );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_free(
+	          &timeline,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "timeline",
+	 timeline );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_timeline_initialize(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timeline = (libfwsi_timeline_t *) 0x12345678UL;
+
+	result = libfwsi_timeline_initialize(
+	          &timeline,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timeline = NULL;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_timeline_initialize with malloc failing
+		 */
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_timeline_initialize(
+		          &timeline,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+
+			if( timeline != NULL )
+			{
+				libfwsi_timeline_free(
+				 &timeline,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "timeline",
+			 timeline );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_timeline_initialize with memset failing
+		 */
+		fwsi_test_memset_attempts_before_fail = test_number;
+
+		result = libfwsi_timeline_initialize(
+		          &timeline,
+		          &error );
+
+		if( fwsi_test_memset_attempts_before_fail != -1 )
+		{
+			fwsi_test_memset_attempts_before_fail = -1;
+
+			if( timeline != NULL )
+			{
+				libfwsi_timeline_free(
+				 &timeline,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "timeline",
+			 timeline );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		libfwsi_timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_timeline_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_timeline_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_timeline_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+/* Tests the libfwsi_timeline_append_item_list function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_timeline_append_item_list(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwsi_item_list_t *item_list = NULL;
+	libfwsi_timeline_t *timeline   = NULL;
+	uint64_t timestamp             = 0;
+	int item_index                 = 0;
+	int list_identifier            = 0;
+	int number_of_events           = 0;
+	int result                     = 0;
+	uint8_t kind                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_timeline_data1,
+	          143,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_initialize(
+	          &timeline,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_timeline_append_item_list(
+	          timeline,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_append_item_list(
+	          timeline,
+	          item_list,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_get_number_of_events(
+	          timeline,
+	          &number_of_events,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 number_of_events,
+	 6 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          1,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_CREATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_sort(
+	          timeline,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The modification times come before the creation and access times
+	 * and events with the same timestamp retain their order
+	 */
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          0,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 127360980000000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_MODIFICATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          1,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 127360980000000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_MODIFICATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          2,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_CREATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          3,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_ACCESS_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          4,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_CREATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          5,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_ACCESS_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_timeline_append_item_list(
+	          NULL,
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_append_item_list(
+	          timeline,
+	          NULL,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_sort(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_number_of_events(
+	          NULL,
+	          &number_of_events,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_number_of_events(
+	          timeline,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          NULL,
+	          0,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          -1,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          6,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          0,
+	          NULL,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          0,
+	          &timestamp,
+	          NULL,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          0,
+	          &timestamp,
+	          &kind,
+	          NULL,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_get_event_by_index(
+	          timeline,
+	          0,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_timeline_free(
+	          &timeline,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		libfwsi_timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+/* Tests the libfwsi_timeline_radix_sort_events function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_timeline_radix_sort_events(
+     void )
+{
+	libfwsi_timeline_event_t events_array[ 512 ];
+	libfwsi_timeline_event_t scratch_events_array[ 512 ];
+
+	libfwsi_timeline_event_t *events         = NULL;
+	libfwsi_timeline_event_t *scratch_events = NULL;
+	uint64_t random_value                    = 0;
+	int event_index                          = 0;
+
+	/* Initialize test
+	 * The timestamps are pseudo random with a limited number of distinct values
+	 * so that the sort order of events with the same timestamp can be tested
+	 */
+	random_value = 1;
+
+	for( event_index = 0;
+	     event_index < 512;
+	     event_index++ )
+	{
+		random_value = ( random_value * (uint64_t) 6364136223846793005 ) + (uint64_t) 1442695040888963407;
+
+		events_array[ event_index ].timestamp       = ( random_value >> 4 ) & (uint64_t) 0x0f000000000f0f00;
+		events_array[ event_index ].list_identifier = event_index;
+		events_array[ event_index ].item_index      = 0;
+		events_array[ event_index ].kind            = LIBFWSI_TIMELINE_EVENT_KIND_MODIFICATION_TIME;
+	}
+	events         = events_array;
+	scratch_events = scratch_events_array;
+
+	/* Test regular cases
+	 */
+	libfwsi_timeline_radix_sort_events(
+	 &events,
+	 &scratch_events,
+	 512 );
+
+	for( event_index = 1;
+	     event_index < 512;
+	     event_index++ )
+	{
+		FWSI_TEST_ASSERT_LESS_THAN_UINT64(
+		 "timestamp",
+		 events[ event_index - 1 ].timestamp,
+		 events[ event_index ].timestamp + 1 );
+
+		if( events[ event_index - 1 ].timestamp == events[ event_index ].timestamp )
+		{
+			FWSI_TEST_ASSERT_LESS_THAN_INT(
+			 "list_identifier",
+			 events[ event_index - 1 ].list_identifier,
+			 events[ event_index ].list_identifier );
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_timeline_initialize",
+	 fwsi_test_timeline_initialize );
+
+	FWSI_TEST_RUN(
+	 "libfwsi_timeline_free",
+	 fwsi_test_timeline_free );
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_timeline_append_item_list",
+	 fwsi_test_timeline_append_item_list );
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+#if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_timeline_radix_sort_events",
+	 fwsi_test_timeline_radix_sort_events );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1257 @@
+/*
+ * Library timeline_merge type test program
+ *
+ * Copyright (C) 2010-2018, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwsi_test_libcerror.h"
+#include "fwsi_test_libfwsi.h"
+#include "fwsi_test_macros.h"
+#include "fwsi_test_memory.h"
+#include "fwsi_test_unused.h"
+
+/* Shell item list of a root folder, volume and file entry item, where the file entry item
+ * has a modification time of Aug 4, 2004 13:00:00 and its file entry extension block
+ * a creation and access time of Jul 8, 2008 01:27:30
+ */
+uint8_t fwsi_test_timeline_merge_data1[ 143 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d, 0x19, 0x00, 0x2f, 0x43, 0x3a, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x32,
+	0x00, 0x00, 0x46, 0x03, 0x00, 0x04, 0x31, 0x00, 0x68, 0x20, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x70,
+	0x61, 0x64, 0x2e, 0x65, 0x78, 0x65, 0x00, 0x46, 0x00, 0x07, 0x00, 0x04, 0x00, 0xef, 0xbe, 0xe8,
+	0x38, 0x6f, 0x0b, 0xe8, 0x38, 0x6f, 0x0b, 0x26, 0x00, 0x00, 0x00, 0x58, 0xe8, 0x00, 0x00, 0x00,
+	0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x6f,
+	0x00, 0x77, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x68, 0x00, 0x65, 0x00, 0x6c, 0x00, 0x6c,
+	0x00, 0x2e, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00 };
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+/* Tests the libfwsi_timeline_merge_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_timeline_merge_initialize(
+     void )
+{
+	libfwsi_timeline_t *timelines[ 2 ] = {
+		NULL,
+		NULL };
+
+	libcerror_error_t *error                 = NULL;
+	libfwsi_item_list_t *item_list           = NULL;
+	libfwsi_timeline_merge_t *timeline_merge = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 4;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_timeline_merge_data1,
+	          143,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_initialize(
+	          &( timelines[ 0 ] ),
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_append_item_list(
+	          timelines[ 0 ],
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_initialize(
+	          &( timelines[ 1 ] ),
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_append_item_list(
+	          timelines[ 1 ],
+	          item_list,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with timelines that are not sorted
+	 */
+	result = libfwsi_timeline_merge_initialize(
+	          &timeline_merge,
+	          timelines,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "timeline_merge",
+	 timeline_merge );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_sort(
+	          timelines[ 0 ],
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_sort(
+	          timelines[ 1 ],
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_timeline_merge_initialize(
+	          &timeline_merge,
+	          timelines,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline_merge",
+	 timeline_merge );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_free(
+	          &timeline_merge,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "timeline_merge",
+	 timeline_merge );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_timeline_merge_initialize(
+	          NULL,
+	          timelines,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timeline_merge = (libfwsi_timeline_merge_t *) 0x12345678UL;
+
+	result = libfwsi_timeline_merge_initialize(
+	          &timeline_merge,
+	          timelines,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timeline_merge = NULL;
+
+	result = libfwsi_timeline_merge_initialize(
+	          &timeline_merge,
+	          NULL,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_merge_initialize(
+	          &timeline_merge,
+	          timelines,
+	          0,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWSI_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_timeline_merge_initialize with malloc failing
+		 */
+		fwsi_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwsi_timeline_merge_initialize(
+		          &timeline_merge,
+		          timelines,
+		          2,
+		          &error );
+
+		if( fwsi_test_malloc_attempts_before_fail != -1 )
+		{
+			fwsi_test_malloc_attempts_before_fail = -1;
+
+			if( timeline_merge != NULL )
+			{
+				libfwsi_timeline_merge_free(
+				 &timeline_merge,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "timeline_merge",
+			 timeline_merge );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwsi_timeline_merge_initialize with memset failing
+		 */
+		fwsi_test_memset_attempts_before_fail = test_number;
+
+		result = libfwsi_timeline_merge_initialize(
+		          &timeline_merge,
+		          timelines,
+		          2,
+		          &error );
+
+		if( fwsi_test_memset_attempts_before_fail != -1 )
+		{
+			fwsi_test_memset_attempts_before_fail = -1;
+
+			if( timeline_merge != NULL )
+			{
+				libfwsi_timeline_merge_free(
+				 &timeline_merge,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWSI_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWSI_TEST_ASSERT_IS_NULL(
+			 "timeline_merge",
+			 timeline_merge );
+
+			FWSI_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWSI_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfwsi_timeline_free(
+	          &( timelines[ 0 ] ),
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_free(
+	          &( timelines[ 1 ] ),
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline_merge != NULL )
+	{
+		libfwsi_timeline_merge_free(
+		 &timeline_merge,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	if( timelines[ 0 ] != NULL )
+	{
+		libfwsi_timeline_free(
+		 &( timelines[ 0 ] ),
+		 NULL );
+	}
+	if( timelines[ 1 ] != NULL )
+	{
+		libfwsi_timeline_free(
+		 &( timelines[ 1 ] ),
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+/* Tests the libfwsi_timeline_merge_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_timeline_merge_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwsi_timeline_merge_free(
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+/* Tests the libfwsi_timeline_merge_get_next_event function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_timeline_merge_get_next_event(
+     void )
+{
+	libfwsi_timeline_t *timelines[ 2 ] = {
+		NULL,
+		NULL };
+
+	libcerror_error_t *error                 = NULL;
+	libfwsi_item_list_t *item_list           = NULL;
+	libfwsi_timeline_merge_t *timeline_merge = NULL;
+	uint64_t timestamp                       = 0;
+	int item_index                           = 0;
+	int list_identifier                      = 0;
+	int result                               = 0;
+	uint8_t kind                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_item_list_initialize(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_copy_from_byte_stream(
+	          item_list,
+	          fwsi_test_timeline_merge_data1,
+	          143,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_initialize(
+	          &( timelines[ 0 ] ),
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_append_item_list(
+	          timelines[ 0 ],
+	          item_list,
+	          1,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_initialize(
+	          &( timelines[ 1 ] ),
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_append_item_list(
+	          timelines[ 1 ],
+	          item_list,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_sort(
+	          timelines[ 0 ],
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_sort(
+	          timelines[ 1 ],
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_initialize(
+	          &timeline_merge,
+	          timelines,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Events with the same timestamp are returned in order of the timelines
+	 */
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 127360980000000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_MODIFICATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 127360980000000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_MODIFICATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_CREATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_ACCESS_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_CREATION_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 128599540500000000 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "kind",
+	 kind,
+	 LIBFWSI_TIMELINE_EVENT_KIND_ACCESS_TIME );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "list_identifier",
+	 list_identifier,
+	 2 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 2 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_timeline_merge_get_next_event(
+	          NULL,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          NULL,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          NULL,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          NULL,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get next event with a timeline that was changed while merged
+	 */
+	result = libfwsi_timeline_merge_free(
+	          &timeline_merge,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_initialize(
+	          &timeline_merge,
+	          timelines,
+	          2,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_append_item_list(
+	          timelines[ 1 ],
+	          item_list,
+	          3,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_timeline_sort(
+	          timelines[ 1 ],
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_merge_get_next_event(
+	          timeline_merge,
+	          &timestamp,
+	          &kind,
+	          &list_identifier,
+	          &item_index,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_timeline_merge_free(
+	          &timeline_merge,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_free(
+	          &( timelines[ 0 ] ),
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_timeline_free(
+	          &( timelines[ 1 ] ),
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_item_list_free(
+	          &item_list,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline_merge != NULL )
+	{
+		libfwsi_timeline_merge_free(
+		 &timeline_merge,
+		 NULL );
+	}
+	if( item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &item_list,
+		 NULL );
+	}
+	if( timelines[ 0 ] != NULL )
+	{
+		libfwsi_timeline_free(
+		 &( timelines[ 0 ] ),
+		 NULL );
+	}
+	if( timelines[ 1 ] != NULL )
+	{
+		libfwsi_timeline_free(
+		 &( timelines[ 1 ] ),
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWSI_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWSI_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWSI_TEST_UNREFERENCED_PARAMETER( argc )
+	FWSI_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_timeline_merge_initialize",
+	 fwsi_test_timeline_merge_initialize );
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+	FWSI_TEST_RUN(
+	 "libfwsi_timeline_merge_free",
+	 fwsi_test_timeline_merge_free );
+
+#if !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER )
+
+	FWSI_TEST_RUN(
+	 "libfwsi_timeline_merge_get_next_event",
+	 fwsi_test_timeline_merge_get_next_event );
+
+#endif /* !defined( LIBFWSI_WITHOUT_FILE_ENTRY_PARSER ) && !defined( LIBFWSI_WITHOUT_EXTENSION_BLOCK_0XBEEF0004_PARSER ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
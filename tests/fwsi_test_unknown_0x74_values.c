@@ -281,6 +281,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER )
+
 /* Tests the libfwsi_unknown_0x74_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -425,6 +427,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -452,10 +456,14 @@ int main(
 	 "libfwsi_unknown_0x74_values_free",
 	 fwsi_test_unknown_0x74_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_unknown_0x74_values_read_data",
 	 fwsi_test_unknown_0x74_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_UNKNOWN_0X74_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
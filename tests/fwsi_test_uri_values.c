@@ -62,6 +62,15 @@ uint8_t fwsi_test_uri_values_data1[ 390 ] = {
 	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00,
 	0x70, 0x00, 0x00, 0x00, 0x64, 0x00 };
 
+/* URI data with the length-prefixed strings
+ */
+uint8_t fwsi_test_uri_values_data2[ 70 ] = {
+	0x46, 0x00, 0x61, 0x80, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x61, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x62, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x78, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
 
 /* Tests the libfwsi_uri_values_initialize function
@@ -297,6 +306,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
 /* Tests the libfwsi_uri_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -344,6 +355,25 @@ int fwsi_test_uri_values_read_data(
 	 "error",
 	 error );
 
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "uri_values->string_data",
+	 uri_values->string_data );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->uri_offset",
+	 uri_values->uri_offset,
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->uri_size",
+	 uri_values->uri_size,
+	 (size_t) 90 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->string_size[ 0 ]",
+	 uri_values->string_size[ 0 ],
+	 (size_t) 0 );
+
 	/* Test error cases
 	 */
 	result = libfwsi_uri_values_read_data(
@@ -403,8 +433,140 @@ int fwsi_test_uri_values_read_data(
 	libcerror_error_free(
 	 &error );
 
+	result = libfwsi_uri_values_read_data(
+	          uri_values,
+	          fwsi_test_uri_values_data1,
+	          390,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* TODO: test with invalid codepage */
 
+	/* Clean up
+	 */
+	result = libfwsi_uri_values_free(
+	          &uri_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "uri_values",
+	 uri_values );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfwsi_uri_values_initialize(
+	          &uri_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read data with the item data size exceeding the data
+	 */
+	result = libfwsi_uri_values_read_data(
+	          uri_values,
+	          fwsi_test_uri_values_data2,
+	          50,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with the length-prefixed strings
+	 */
+	result = libfwsi_uri_values_read_data(
+	          uri_values,
+	          fwsi_test_uri_values_data2,
+	          70,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->string_data_size",
+	 uri_values->string_data_size,
+	 (size_t) 22 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->string_offset[ 0 ]",
+	 uri_values->string_offset[ 0 ],
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->string_size[ 0 ]",
+	 uri_values->string_size[ 0 ],
+	 (size_t) 4 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->string_offset[ 1 ]",
+	 uri_values->string_offset[ 1 ],
+	 (size_t) 8 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->string_size[ 1 ]",
+	 uri_values->string_size[ 1 ],
+	 (size_t) 6 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->string_size[ 2 ]",
+	 uri_values->string_size[ 2 ],
+	 (size_t) 0 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->uri_offset",
+	 uri_values->uri_offset,
+	 (size_t) 18 );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "uri_values->uri_size",
+	 uri_values->uri_size,
+	 (size_t) 4 );
+
 	/* Clean up
 	 */
 	result = libfwsi_uri_values_free(
@@ -441,6 +603,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -468,10 +632,14 @@ int main(
 	 "libfwsi_uri_values_free",
 	 fwsi_test_uri_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_URI_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_uri_values_read_data",
 	 fwsi_test_uri_values_read_data );
 
+#endif /* !defined( LIBFWSI_WITHOUT_URI_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -39,6 +39,18 @@ uint8_t fwsi_test_users_property_view_values_data1[ 32 ] = {
 	0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0xee, 0xbb, 0xfe, 0x23, 0x00, 0x00, 0x10, 0x00, 0x71, 0xd5,
 	0xd8, 0x4b, 0x19, 0x6d, 0xd3, 0x48, 0xbe, 0x97, 0x42, 0x22, 0x20, 0x08, 0x0e, 0x43, 0x00, 0x00, };
 
+uint8_t fwsi_test_users_property_view_values_data2[ 77 ] = {
+	0x4d, 0x00, 0x00, 0x00, 0x47, 0x00, 0xee, 0xbb, 0xfe, 0x23, 0x2d, 0x00, 0x10, 0x00, 0x71, 0xd5,
+	0xd8, 0x4b, 0x19, 0x6d, 0xd3, 0x48, 0xbe, 0x97, 0x42, 0x22, 0x20, 0x08, 0x0e, 0x43, 0x2d, 0x00,
+	0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0x30, 0xf1, 0x25, 0xb7, 0xef, 0x47, 0x1a, 0x10, 0xa5, 0xf1,
+	0x02, 0x60, 0x8c, 0x9e, 0xeb, 0xac, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x13,
+	0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fwsi_test_users_property_view_values_data3[ 35 ] = {
+	0x23, 0x00, 0x00, 0x00, 0x1d, 0x00, 0xee, 0xbb, 0xfe, 0x23, 0x03, 0x00, 0x10, 0x00, 0x71, 0xd5,
+	0xd8, 0x4b, 0x19, 0x6d, 0xd3, 0x48, 0xbe, 0x97, 0x42, 0x22, 0x20, 0x08, 0x0e, 0x43, 0x03, 0x00,
+	0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT )
 
 /* Tests the libfwsi_users_property_view_values_initialize function
@@ -274,6 +286,8 @@ on_error:
 	return( 0 );
 }
 
+#if !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER )
+
 /* Tests the libfwsi_users_property_view_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -321,8 +335,101 @@ int fwsi_test_users_property_view_values_read_data(
 	 "error",
 	 error );
 
+	FWSI_TEST_ASSERT_EQUAL_UINT32(
+	 "users_property_view_values->signature",
+	 users_property_view_values->signature,
+	 0x23febbeeUL );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "users_property_view_values->has_known_folder_identifier",
+	 users_property_view_values->has_known_folder_identifier,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_UINT8(
+	 "users_property_view_values->known_folder_identifier[ 0 ]",
+	 users_property_view_values->known_folder_identifier[ 0 ],
+	 0x71 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "users_property_view_values->property_store_data",
+	 users_property_view_values->property_store_data );
+
+	result = libfwsi_users_property_view_values_free(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_initialize(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_read_data(
+	          users_property_view_values,
+	          fwsi_test_users_property_view_values_data2,
+	          77,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "users_property_view_values->property_store_data",
+	 users_property_view_values->property_store_data );
+
+	FWSI_TEST_ASSERT_EQUAL_SIZE(
+	 "users_property_view_values->property_store_data_size",
+	 users_property_view_values->property_store_data_size,
+	 (size_t) 45 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "users_property_view_values->property_storage",
+	 users_property_view_values->property_storage );
+
 	/* Test error cases
 	 */
+	result = libfwsi_users_property_view_values_read_data(
+	          users_property_view_values,
+	          fwsi_test_users_property_view_values_data2,
+	          77,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	result = libfwsi_users_property_view_values_read_data(
 	          NULL,
 	          fwsi_test_users_property_view_values_data1,
@@ -382,6 +489,349 @@ int fwsi_test_users_property_view_values_read_data(
 
 	/* TODO: test with invalid codepage */
 
+	/* Clean up
+	 */
+	result = libfwsi_users_property_view_values_free(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the property store size exceeds the data size
+	 */
+	result = libfwsi_users_property_view_values_initialize(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_read_data(
+	          users_property_view_values,
+	          fwsi_test_users_property_view_values_data2,
+	          60,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwsi_users_property_view_values_free(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "users_property_view_values",
+	 users_property_view_values );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( users_property_view_values != NULL )
+	{
+		libfwsi_users_property_view_values_free(
+		 &users_property_view_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwsi_users_property_view_values_get_property_storage function
+ * Returns 1 if successful or 0 if not
+ */
+int fwsi_test_users_property_view_values_get_property_storage(
+     void )
+{
+	libcerror_error_t *error                                         = NULL;
+	libfwps_storage_t *property_storage                              = NULL;
+	libfwps_storage_t *second_property_storage                       = NULL;
+	libfwsi_users_property_view_values_t *users_property_view_values = NULL;
+	int result                                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwsi_users_property_view_values_initialize(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "users_property_view_values",
+	 users_property_view_values );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_read_data(
+	          users_property_view_values,
+	          fwsi_test_users_property_view_values_data1,
+	          32,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwsi_users_property_view_values_get_property_storage(
+	          users_property_view_values,
+	          &property_storage,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "property_storage",
+	 property_storage );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_free(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_initialize(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_read_data(
+	          users_property_view_values,
+	          fwsi_test_users_property_view_values_data2,
+	          77,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_get_property_storage(
+	          users_property_view_values,
+	          &property_storage,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "property_storage",
+	 property_storage );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The property storage is created once
+	 */
+	second_property_storage = NULL;
+
+	result = libfwsi_users_property_view_values_get_property_storage(
+	          users_property_view_values,
+	          &second_property_storage,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "second_property_storage == property_storage",
+	 (int) ( second_property_storage == property_storage ),
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwsi_users_property_view_values_get_property_storage(
+	          NULL,
+	          &property_storage,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwsi_users_property_view_values_get_property_storage(
+	          users_property_view_values,
+	          NULL,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test property store data that cannot be decoded
+	 */
+	result = libfwsi_users_property_view_values_free(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_initialize(
+	          &users_property_view_values,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwsi_users_property_view_values_read_data(
+	          users_property_view_values,
+	          fwsi_test_users_property_view_values_data3,
+	          35,
+	          LIBFWSI_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_IS_NOT_NULL(
+	 "users_property_view_values->property_store_data",
+	 users_property_view_values->property_store_data );
+
+	property_storage = NULL;
+
+	result = libfwsi_users_property_view_values_get_property_storage(
+	          users_property_view_values,
+	          &property_storage,
+	          &error );
+
+	FWSI_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "property_storage",
+	 property_storage );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWSI_TEST_ASSERT_IS_NULL(
+	 "users_property_view_values->property_storage",
+	 users_property_view_values->property_storage );
+
 	/* Clean up
 	 */
 	result = libfwsi_users_property_view_values_free(
@@ -418,6 +868,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 /* The main program
@@ -445,10 +897,18 @@ int main(
 	 "libfwsi_users_property_view_values_free",
 	 fwsi_test_users_property_view_values_free );
 
+#if !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER )
+
 	FWSI_TEST_RUN(
 	 "libfwsi_users_property_view_values_read_data",
 	 fwsi_test_users_property_view_values_read_data );
 
+	FWSI_TEST_RUN(
+	 "libfwsi_users_property_view_values_get_property_storage",
+	 fwsi_test_users_property_view_values_get_property_storage );
+
+#endif /* !defined( LIBFWSI_WITHOUT_USERS_PROPERTY_VIEW_PARSER ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWSI_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
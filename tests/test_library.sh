@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="cdburn_values compressed_folder_values control_panel_category_values control_panel_cpl_file_values control_panel_values delegate_values error extension_block extension_block_0xbeef0000_values extension_block_0xbeef0001_values extension_block_0xbeef0003_values extension_block_0xbeef0005_values extension_block_0xbeef0006_values extension_block_0xbeef000a_values extension_block_0xbeef0013_values extension_block_0xbeef0014_values extension_block_0xbeef0019_values extension_block_0xbeef0025_values file_entry_extension_values file_entry_values game_folder_values item item_list mtp_file_entry_values mtp_volume_values network_location_values root_folder_values support unknown_0x74_values uri_values uri_sub_values users_property_view_values volume_values";
+LIBRARY_TESTS="allocator carver cdburn_values compressed_folder_values control_panel_category_values control_panel_cpl_file_values control_panel_values delegate_values error extension_block extension_block_0xbeef0000_values extension_block_0xbeef0001_values extension_block_0xbeef0003_values extension_block_0xbeef0005_values extension_block_0xbeef0006_values extension_block_0xbeef000a_values extension_block_0xbeef0013_values extension_block_0xbeef0014_values extension_block_0xbeef0019_values extension_block_0xbeef0025_values extension_block_registry fat_date_time file_entry_extension_values file_entry_values file_reference_index filter game_folder_values item item_list item_list_parser item_list_view item_type_registry mtp_file_entry_values mtp_property_store mtp_volume_values name_search network_location_values parse_options root_folder_values string support timeline timeline_merge unknown_0x74_values uri_values uri_sub_values users_property_view_values volume_values";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 